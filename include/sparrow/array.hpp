@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <stdexcept>
+
 #include "sparrow/array_api.hpp"
 #include "sparrow/layout/dispatch.hpp"
 
@@ -43,4 +45,48 @@ namespace sparrow
     {
         return sparrow::visit(std::forward<F>(func), *p_array);
     }
+
+    template <layout A>
+    A& array::as()
+    {
+        A* res = try_as<A>();
+        if (res == nullptr)
+        {
+            throw std::runtime_error("array does not hold the requested layout");
+        }
+        return *res;
+    }
+
+    template <layout A>
+    const A& array::as() const
+    {
+        const A* res = try_as<A>();
+        if (res == nullptr)
+        {
+            throw std::runtime_error("array does not hold the requested layout");
+        }
+        return *res;
+    }
+
+    template <layout A>
+    A* array::try_as()
+    {
+        return holds<A>() ? &unwrap_array<A>(*p_array) : nullptr;
+    }
+
+    template <layout A>
+    const A* array::try_as() const
+    {
+        return holds<A>() ? &unwrap_array<A>(*p_array) : nullptr;
+    }
+
+    template <layout A>
+    bool array::holds() const
+    {
+        static_assert(
+            mpl::contains<A>(detail::dispatched_array_types{}),
+            "A must be one of the layouts supported by sparrow::array"
+        );
+        return p_array && p_array->kind() == detail::array_kind_of<A>();
+    }
 }
\ No newline at end of file
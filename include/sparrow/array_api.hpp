@@ -66,7 +66,31 @@ namespace sparrow
         template <class F>
         visit_result_t<F> visit(F&& func);
 
+        /**
+         * Returns a reference to the layout held by this array. Throws
+         * std::runtime_error if the array does not hold a layout of type A.
+         */
+        template <layout A>
+        A& as();
+
+        template <layout A>
+        const A& as() const;
+
+        /**
+         * Returns a pointer to the layout held by this array, or nullptr
+         * if the array does not hold a layout of type A.
+         */
+        template <layout A>
+        A* try_as();
+
+        template <layout A>
+        const A* try_as() const;
+
     private:
+
+        template <layout A>
+        bool holds() const;
+
         SPARROW_API cloning_ptr<array_wrapper> extract_array_wrapper() &&;
 
         cloning_ptr<array_wrapper> p_array = nullptr;
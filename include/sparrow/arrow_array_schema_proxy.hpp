@@ -451,8 +451,8 @@ namespace sparrow
         }
         SPARROW_ASSERT_TRUE(has_bitmap(data_type()))
         auto bitmap = get_non_owning_dynamic_bitset();
-        const auto it = bitmap.insert(sparrow::next(bitmap.cbegin(), index), range.begin(), range.end());
-        return static_cast<size_t>(std::distance(bitmap.begin(), it));
+        const auto it = bitmap.insert(sparrow::next(bitmap.cbegin(), index + offset()), range.begin(), range.end());
+        return static_cast<size_t>(std::distance(bitmap.begin(), it)) - offset();
     }
 
 }
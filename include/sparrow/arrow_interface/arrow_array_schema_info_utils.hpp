@@ -15,6 +15,7 @@
 #pragma once
 
 #include <algorithm>
+#include <string_view>
 
 #include "sparrow/buffer/buffer_adaptor.hpp"
 #include "sparrow/buffer/buffer_view.hpp"
@@ -51,12 +52,29 @@ namespace sparrow
             case data_type::INT64:
             case data_type::DOUBLE:
             case data_type::HALF_FLOAT:
-            case data_type::TIMESTAMP:
-            case data_type::FIXED_SIZE_BINARY:
+            case data_type::DATE_DAYS:
+            case data_type::DATE_MILLISECONDS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+            case data_type::TIME_MICROSECONDS:
+            case data_type::TIME_NANOSECONDS:
+            case data_type::TIMESTAMP_SECONDS:
+            case data_type::TIMESTAMP_MILLISECONDS:
+            case data_type::TIMESTAMP_MICROSECONDS:
+            case data_type::TIMESTAMP_NANOSECONDS:
+            case data_type::DURATION_SECONDS:
+            case data_type::DURATION_MILLISECONDS:
+            case data_type::DURATION_MICROSECONDS:
+            case data_type::DURATION_NANOSECONDS:
             case data_type::DECIMAL:
+            case data_type::DECIMAL256:
             case data_type::FIXED_WIDTH_BINARY:
             case data_type::STRING:
             case data_type::BINARY:
+            case data_type::LARGE_STRING:
+            case data_type::LARGE_BINARY:
+            case data_type::STRING_VIEW:
+            case data_type::BINARY_VIEW:
                 return 0;
             case data_type::LIST:
             case data_type::LARGE_LIST:
@@ -87,6 +105,9 @@ namespace sparrow
         // children_count_valid;
     }
 
+    /// Size in bytes of an element of the VIEWS buffer of the binary view layouts.
+    inline constexpr std::size_t binary_view_size = 16;
+
     enum class buffer_type : uint8_t
     {
         VALIDITY,
@@ -117,15 +138,37 @@ namespace sparrow
             case data_type::INT64:
             case data_type::DOUBLE:
             case data_type::HALF_FLOAT:
-            case data_type::TIMESTAMP:
-            case data_type::FIXED_SIZE_BINARY:
+            case data_type::DATE_DAYS:
+            case data_type::DATE_MILLISECONDS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+            case data_type::TIME_MICROSECONDS:
+            case data_type::TIME_NANOSECONDS:
+            case data_type::TIMESTAMP_SECONDS:
+            case data_type::TIMESTAMP_MILLISECONDS:
+            case data_type::TIMESTAMP_MICROSECONDS:
+            case data_type::TIMESTAMP_NANOSECONDS:
+            case data_type::DURATION_SECONDS:
+            case data_type::DURATION_MILLISECONDS:
+            case data_type::DURATION_MICROSECONDS:
+            case data_type::DURATION_NANOSECONDS:
             case data_type::DECIMAL:
+            case data_type::DECIMAL256:
             case data_type::FIXED_WIDTH_BINARY:
                 return {buffer_type::VALIDITY, buffer_type::DATA};
             case data_type::BINARY:
             case data_type::STRING:
                 return {buffer_type::VALIDITY, buffer_type::OFFSETS_32BIT, buffer_type::DATA};
+            case data_type::LARGE_BINARY:
+            case data_type::LARGE_STRING:
+                return {buffer_type::VALIDITY, buffer_type::OFFSETS_64BIT, buffer_type::DATA};
+            case data_type::STRING_VIEW:
+            case data_type::BINARY_VIEW:
+                // The views are followed by a variable number of data buffers and
+                // a buffer holding their sizes, see has_variadic_buffers.
+                return {buffer_type::VALIDITY, buffer_type::VIEWS};
             case data_type::LIST:
+            case data_type::MAP:
                 return {buffer_type::VALIDITY, buffer_type::OFFSETS_32BIT};
             case data_type::LARGE_LIST:
                 return {buffer_type::VALIDITY, buffer_type::OFFSETS_64BIT};
@@ -141,7 +184,6 @@ namespace sparrow
             case data_type::DENSE_UNION:
                 return {buffer_type::TYPE_IDS, buffer_type::OFFSETS_32BIT};
             case data_type::NA:
-            case data_type::MAP:
             case data_type::RUN_ENCODED:
                 return {};
         }
@@ -165,8 +207,12 @@ namespace sparrow
         switch (data_type)
         {
             case data_type::STRING:
+            case data_type::BINARY:
+            case data_type::LARGE_STRING:
+            case data_type::LARGE_BINARY:
             case data_type::LIST:
             case data_type::LARGE_LIST:
+            case data_type::MAP:
                 return length + offset + 1;
             case data_type::LIST_VIEW:
             case data_type::LARGE_LIST_VIEW:
@@ -178,14 +224,15 @@ namespace sparrow
     }
 
     /// @returns The number of bytes required according to the provided buffer type, length, offset and data
-    /// type.
+    /// type. The format is only read for the width of fixed-size binaries.
     inline std::size_t compute_buffer_size(
         buffer_type bt,
         size_t length,
         size_t offset,
         data_type dt,
         const std::vector<sparrow::buffer_view<uint8_t>>& previous_buffers,
-        buffer_type previous_buffer_type
+        buffer_type previous_buffer_type,
+        std::string_view format = {}
     )
     {
         constexpr size_t bit_per_byte = 8;
@@ -194,7 +241,9 @@ namespace sparrow
             case buffer_type::VALIDITY:
                 return (length + offset + bit_per_byte - 1) / bit_per_byte;
             case buffer_type::DATA:
-                if (bt == buffer_type::DATA && (dt == data_type::STRING || dt == data_type::BINARY))
+                if (bt == buffer_type::DATA
+                    && (dt == data_type::STRING || dt == data_type::BINARY || dt == data_type::LARGE_STRING
+                        || dt == data_type::LARGE_BINARY))
                 {
                     SPARROW_ASSERT_TRUE(
                         previous_buffer_type == buffer_type::OFFSETS_32BIT
@@ -215,6 +264,24 @@ namespace sparrow
                         return static_cast<std::size_t>(offset_buf.back());
                     }
                 }
+                if (dt == data_type::FIXED_WIDTH_BINARY)
+                {
+                    const auto width = parse_fixed_width_binary_format(format);
+                    SPARROW_ASSERT_TRUE(width.has_value());
+                    return *width * (length + offset);
+                }
+                if (data_type_is_temporal(dt))
+                {
+                    return temporal_value_size(dt) * (length + offset);
+                }
+                if (dt == data_type::DECIMAL)
+                {
+                    return sizeof(int128_t) * (length + offset);
+                }
+                if (dt == data_type::DECIMAL256)
+                {
+                    return sizeof(int256_t) * (length + offset);
+                }
                 return primitive_bytes_count(dt, length + offset);
             case buffer_type::OFFSETS_32BIT:
             case buffer_type::SIZES_32BIT:
@@ -223,9 +290,7 @@ namespace sparrow
             case buffer_type::SIZES_64BIT:
                 return get_offset_element_count(dt, length, offset) * sizeof(std::int64_t);
             case buffer_type::VIEWS:
-                // TODO: Implement
-                SPARROW_ASSERT(false, "Not implemented");
-                return 0;
+                return (length + offset) * binary_view_size;
             case buffer_type::TYPE_IDS:
                 return length + offset;
         }
@@ -249,14 +314,31 @@ namespace sparrow
             case data_type::HALF_FLOAT:
             case data_type::FLOAT:
             case data_type::DOUBLE:
-            case data_type::TIMESTAMP:
+            case data_type::DATE_DAYS:
+            case data_type::DATE_MILLISECONDS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+            case data_type::TIME_MICROSECONDS:
+            case data_type::TIME_NANOSECONDS:
+            case data_type::TIMESTAMP_SECONDS:
+            case data_type::TIMESTAMP_MILLISECONDS:
+            case data_type::TIMESTAMP_MICROSECONDS:
+            case data_type::TIMESTAMP_NANOSECONDS:
+            case data_type::DURATION_SECONDS:
+            case data_type::DURATION_MILLISECONDS:
+            case data_type::DURATION_MICROSECONDS:
+            case data_type::DURATION_NANOSECONDS:
             case data_type::DECIMAL:
+            case data_type::DECIMAL256:
             case data_type::LIST:
             case data_type::STRUCT:
             case data_type::MAP:
             case data_type::STRING:
             case data_type::BINARY:
-            case data_type::FIXED_SIZE_BINARY:
+            case data_type::LARGE_STRING:
+            case data_type::LARGE_BINARY:
+            case data_type::STRING_VIEW:
+            case data_type::BINARY_VIEW:
             case data_type::FIXED_WIDTH_BINARY:
             case data_type::LARGE_LIST:
             case data_type::LIST_VIEW:
@@ -271,4 +353,12 @@ namespace sparrow
         }
         mpl::unreachable();
     }
+
+    /// @returns `true` if the buffers described by get_buffer_types_from_data_type are
+    /// followed by a variable number of data buffers and a last buffer holding the sizes
+    /// (as int64_t) of these data buffers, `false` otherwise.
+    constexpr bool has_variadic_buffers(data_type dt)
+    {
+        return dt == data_type::STRING_VIEW || dt == data_type::BINARY_VIEW;
+    }
 }
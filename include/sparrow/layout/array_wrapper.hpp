@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <variant>
 
@@ -63,6 +64,209 @@ namespace sparrow
         };
     }
 
+    /**
+     * Tag identifying the concrete layout held by an array_wrapper.
+     * It is resolved once when the wrapper is built, and is used as
+     * an index in the dispatch tables of visit and array_factory.
+     * The order of the enumerators must match the one of
+     * detail::dispatched_array_types in dispatch.hpp.
+     */
+    enum class array_kind : std::uint8_t
+    {
+        NA,
+        BOOL,
+        UINT8,
+        INT8,
+        UINT16,
+        INT16,
+        UINT32,
+        INT32,
+        UINT64,
+        INT64,
+        HALF_FLOAT,
+        FLOAT,
+        DOUBLE,
+        DECIMAL,
+        DECIMAL256,
+        DATE_DAYS,
+        DATE_MILLISECONDS,
+        TIME_SECONDS,
+        TIME_MILLISECONDS,
+        TIME_MICROSECONDS,
+        TIME_NANOSECONDS,
+        TIMESTAMP_SECONDS,
+        TIMESTAMP_MILLISECONDS,
+        TIMESTAMP_MICROSECONDS,
+        TIMESTAMP_NANOSECONDS,
+        DURATION_SECONDS,
+        DURATION_MILLISECONDS,
+        DURATION_MICROSECONDS,
+        DURATION_NANOSECONDS,
+        STRING,
+        LARGE_STRING,
+        STRING_VIEW,
+        BINARY,
+        LARGE_BINARY,
+        BINARY_VIEW,
+        FIXED_WIDTH_BINARY,
+        RUN_ENCODED,
+        LIST,
+        LARGE_LIST,
+        LIST_VIEW,
+        LARGE_LIST_VIEW,
+        FIXED_SIZED_LIST,
+        MAP,
+        STRUCT,
+        DENSE_UNION,
+        SPARSE_UNION,
+        DICTIONARY_UINT8,
+        DICTIONARY_INT8,
+        DICTIONARY_UINT16,
+        DICTIONARY_INT16,
+        DICTIONARY_UINT32,
+        DICTIONARY_INT32,
+        DICTIONARY_UINT64,
+        DICTIONARY_INT64,
+        UNSUPPORTED
+    };
+
+    /// @returns the number of supported array kinds, i.e. the size of the dispatch tables.
+    constexpr std::size_t array_kind_count()
+    {
+        return static_cast<std::size_t>(array_kind::UNSUPPORTED);
+    }
+
+    /**
+     * Resolves the array_kind of an array given its data_type and
+     * whether it is dictionary encoded. Returns array_kind::UNSUPPORTED
+     * if no layout is available for this combination.
+     */
+    constexpr array_kind get_array_kind(data_type dt, bool is_dictionary)
+    {
+        if (is_dictionary)
+        {
+            switch (dt)
+            {
+                case data_type::UINT8:
+                    return array_kind::DICTIONARY_UINT8;
+                case data_type::INT8:
+                    return array_kind::DICTIONARY_INT8;
+                case data_type::UINT16:
+                    return array_kind::DICTIONARY_UINT16;
+                case data_type::INT16:
+                    return array_kind::DICTIONARY_INT16;
+                case data_type::UINT32:
+                    return array_kind::DICTIONARY_UINT32;
+                case data_type::INT32:
+                    return array_kind::DICTIONARY_INT32;
+                case data_type::UINT64:
+                    return array_kind::DICTIONARY_UINT64;
+                case data_type::INT64:
+                    return array_kind::DICTIONARY_INT64;
+                default:
+                    return array_kind::UNSUPPORTED;
+            }
+        }
+
+        switch (dt)
+        {
+            case data_type::NA:
+                return array_kind::NA;
+            case data_type::BOOL:
+                return array_kind::BOOL;
+            case data_type::UINT8:
+                return array_kind::UINT8;
+            case data_type::INT8:
+                return array_kind::INT8;
+            case data_type::UINT16:
+                return array_kind::UINT16;
+            case data_type::INT16:
+                return array_kind::INT16;
+            case data_type::UINT32:
+                return array_kind::UINT32;
+            case data_type::INT32:
+                return array_kind::INT32;
+            case data_type::UINT64:
+                return array_kind::UINT64;
+            case data_type::INT64:
+                return array_kind::INT64;
+            case data_type::HALF_FLOAT:
+                return array_kind::HALF_FLOAT;
+            case data_type::FLOAT:
+                return array_kind::FLOAT;
+            case data_type::DOUBLE:
+                return array_kind::DOUBLE;
+            case data_type::DECIMAL:
+                return array_kind::DECIMAL;
+            case data_type::DECIMAL256:
+                return array_kind::DECIMAL256;
+            case data_type::DATE_DAYS:
+                return array_kind::DATE_DAYS;
+            case data_type::DATE_MILLISECONDS:
+                return array_kind::DATE_MILLISECONDS;
+            case data_type::TIME_SECONDS:
+                return array_kind::TIME_SECONDS;
+            case data_type::TIME_MILLISECONDS:
+                return array_kind::TIME_MILLISECONDS;
+            case data_type::TIME_MICROSECONDS:
+                return array_kind::TIME_MICROSECONDS;
+            case data_type::TIME_NANOSECONDS:
+                return array_kind::TIME_NANOSECONDS;
+            case data_type::TIMESTAMP_SECONDS:
+                return array_kind::TIMESTAMP_SECONDS;
+            case data_type::TIMESTAMP_MILLISECONDS:
+                return array_kind::TIMESTAMP_MILLISECONDS;
+            case data_type::TIMESTAMP_MICROSECONDS:
+                return array_kind::TIMESTAMP_MICROSECONDS;
+            case data_type::TIMESTAMP_NANOSECONDS:
+                return array_kind::TIMESTAMP_NANOSECONDS;
+            case data_type::DURATION_SECONDS:
+                return array_kind::DURATION_SECONDS;
+            case data_type::DURATION_MILLISECONDS:
+                return array_kind::DURATION_MILLISECONDS;
+            case data_type::DURATION_MICROSECONDS:
+                return array_kind::DURATION_MICROSECONDS;
+            case data_type::DURATION_NANOSECONDS:
+                return array_kind::DURATION_NANOSECONDS;
+            case data_type::STRING:
+                return array_kind::STRING;
+            case data_type::LARGE_STRING:
+                return array_kind::LARGE_STRING;
+            case data_type::STRING_VIEW:
+                return array_kind::STRING_VIEW;
+            case data_type::BINARY:
+                return array_kind::BINARY;
+            case data_type::LARGE_BINARY:
+                return array_kind::LARGE_BINARY;
+            case data_type::BINARY_VIEW:
+                return array_kind::BINARY_VIEW;
+            case data_type::FIXED_WIDTH_BINARY:
+                return array_kind::FIXED_WIDTH_BINARY;
+            case data_type::RUN_ENCODED:
+                return array_kind::RUN_ENCODED;
+            case data_type::LIST:
+                return array_kind::LIST;
+            case data_type::LARGE_LIST:
+                return array_kind::LARGE_LIST;
+            case data_type::LIST_VIEW:
+                return array_kind::LIST_VIEW;
+            case data_type::LARGE_LIST_VIEW:
+                return array_kind::LARGE_LIST_VIEW;
+            case data_type::FIXED_SIZED_LIST:
+                return array_kind::FIXED_SIZED_LIST;
+            case data_type::MAP:
+                return array_kind::MAP;
+            case data_type::STRUCT:
+                return array_kind::STRUCT;
+            case data_type::DENSE_UNION:
+                return array_kind::DENSE_UNION;
+            case data_type::SPARSE_UNION:
+                return array_kind::SPARSE_UNION;
+            default:
+                return array_kind::UNSUPPORTED;
+        }
+    }
+
     /**
      * Base class for array type erasure
      */
@@ -82,6 +286,7 @@ namespace sparrow
 
         enum data_type data_type() const;
         bool is_dictionary() const;
+        array_kind kind() const;
 
         [[nodiscard]] arrow_proxy extract_arrow_proxy() &&;
         [[nodiscard]] arrow_proxy& get_arrow_proxy();
@@ -89,12 +294,13 @@ namespace sparrow
 
     protected:
 
-        array_wrapper(enum data_type dt);
+        array_wrapper(enum data_type dt, array_kind kind);
         array_wrapper(const array_wrapper&) = default;
 
     private:
 
         enum data_type m_data_type;
+        array_kind m_kind;
         virtual bool is_dictionary_impl() const = 0;
         virtual arrow_proxy& get_arrow_proxy_impl() = 0;
         virtual const arrow_proxy& get_arrow_proxy_impl() const = 0;
@@ -121,6 +327,7 @@ namespace sparrow
         using wrapper_ptr = array_wrapper::wrapper_ptr;
 
         constexpr enum data_type get_data_type() const;
+        constexpr array_kind get_kind() const;
 
         array_wrapper_impl(const array_wrapper_impl&);
         bool is_dictionary_impl() const override;
@@ -159,6 +366,11 @@ namespace sparrow
         return is_dictionary_impl();
     }
 
+    inline array_kind array_wrapper::kind() const
+    {
+        return m_kind;
+    }
+
     inline arrow_proxy& array_wrapper::get_arrow_proxy()
     {
         return get_arrow_proxy_impl();
@@ -175,8 +387,9 @@ namespace sparrow
     }
 
 
-    inline array_wrapper::array_wrapper(enum data_type dt)
+    inline array_wrapper::array_wrapper(enum data_type dt, array_kind kind)
         : m_data_type(dt)
+        , m_kind(kind)
     {
     }
 
@@ -186,7 +399,7 @@ namespace sparrow
 
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(T&& ar)
-        : array_wrapper(this->get_data_type())
+        : array_wrapper(this->get_data_type(), this->get_kind())
         , m_storage(value_ptr<T>(std::move(ar)))
         , p_array(std::get<value_ptr<T>>(m_storage).get())
     {
@@ -194,7 +407,7 @@ namespace sparrow
 
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(T* ar)
-        : array_wrapper(this->get_data_type())
+        : array_wrapper(this->get_data_type(), this->get_kind())
         , m_storage(ar)
         , p_array(ar)
     {
@@ -202,7 +415,7 @@ namespace sparrow
 
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(std::shared_ptr<T> ar)
-        : array_wrapper(this->get_data_type())
+        : array_wrapper(this->get_data_type(), this->get_kind())
         , m_storage(std::move(ar))
         , p_array(std::get<std::shared_ptr<T>>(m_storage).get())
     {
@@ -226,6 +439,12 @@ namespace sparrow
         return detail::get_data_type_from_array<T>::get();
     }
 
+    template <class T>
+    constexpr array_kind array_wrapper_impl<T>::get_kind() const
+    {
+        return get_array_kind(get_data_type(), detail::is_dictionary_encoded_array<T>::get());
+    }
+
     template <class T>
     array_wrapper_impl<T>::array_wrapper_impl(const array_wrapper_impl& rhs)
         : array_wrapper(rhs)
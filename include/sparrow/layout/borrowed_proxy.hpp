@@ -0,0 +1,143 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/c_interface.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow::detail
+{
+    // Description of an array built over buffers and children that it does
+    // not own. The buffers of the array are borrowed_buffers followed by
+    // owned_buffers. When owner is set, the array shares the ownership of
+    // the borrowed memory; otherwise the borrowed memory must outlive the
+    // array.
+    struct borrowed_proxy_parts
+    {
+        std::int64_t length = 0;
+        std::int64_t null_count = 0;
+        std::int64_t offset = 0;
+        std::string format;
+        const char* name = nullptr;
+        const char* metadata = nullptr;
+        std::int64_t flags = 0;
+        std::vector<const void*> borrowed_buffers;
+        std::vector<buffer<std::uint8_t>> owned_buffers;
+        std::vector<ArrowArray*> array_children;
+        std::vector<ArrowSchema*> schema_children;
+        std::shared_ptr<const void> owner;
+    };
+
+    // Private data of the borrowed array and schema. The release callbacks
+    // free this storage only: the borrowed buffers and children are left
+    // untouched.
+    struct borrowed_array_data
+    {
+        std::shared_ptr<const void> owner;
+        std::vector<buffer<std::uint8_t>> owned_buffers;
+        std::vector<const void*> buffers;
+        std::vector<ArrowArray*> children;
+    };
+
+    struct borrowed_schema_data
+    {
+        std::string format;
+        std::vector<ArrowSchema*> children;
+    };
+
+    inline void release_borrowed_array(ArrowArray* array)
+    {
+        delete static_cast<borrowed_array_data*>(array->private_data);
+        array->private_data = nullptr;
+        array->release = nullptr;
+    }
+
+    inline void release_borrowed_schema(ArrowSchema* schema)
+    {
+        delete static_cast<borrowed_schema_data*>(schema->private_data);
+        schema->private_data = nullptr;
+        schema->release = nullptr;
+    }
+
+    // Returns the length, null count, offset, format, name, metadata, flags
+    // and buffers of source, without its children.
+    inline borrowed_proxy_parts borrow_parts(const arrow_proxy& source)
+    {
+        const ArrowArray& source_array = source.array();
+        const ArrowSchema& source_schema = source.schema();
+        borrowed_proxy_parts parts;
+        parts.length = source_array.length;
+        parts.null_count = source_array.null_count;
+        parts.offset = source_array.offset;
+        parts.format = source_schema.format;
+        parts.name = source_schema.name;
+        parts.metadata = source_schema.metadata;
+        parts.flags = source_schema.flags;
+        parts.borrowed_buffers.assign(source_array.buffers, source_array.buffers + source_array.n_buffers);
+        return parts;
+    }
+
+    inline arrow_proxy make_borrowed_proxy(borrowed_proxy_parts parts)
+    {
+        SPARROW_ASSERT_TRUE(parts.array_children.size() == parts.schema_children.size());
+
+        auto array_data = std::make_unique<borrowed_array_data>();
+        array_data->owner = std::move(parts.owner);
+        array_data->owned_buffers = std::move(parts.owned_buffers);
+        array_data->buffers = std::move(parts.borrowed_buffers);
+        for (const auto& owned : array_data->owned_buffers)
+        {
+            array_data->buffers.push_back(owned.data());
+        }
+        array_data->children = std::move(parts.array_children);
+
+        auto schema_data = std::make_unique<borrowed_schema_data>();
+        schema_data->format = std::move(parts.format);
+        schema_data->children = std::move(parts.schema_children);
+
+        ArrowArray array{};
+        array.length = parts.length;
+        array.null_count = parts.null_count;
+        array.offset = parts.offset;
+        array.n_buffers = static_cast<std::int64_t>(array_data->buffers.size());
+        array.buffers = array_data->buffers.data();
+        array.n_children = static_cast<std::int64_t>(array_data->children.size());
+        array.children = array_data->children.data();
+        array.dictionary = nullptr;
+        array.release = &release_borrowed_array;
+        array.private_data = array_data.release();
+
+        ArrowSchema schema{};
+        schema.format = schema_data->format.c_str();
+        schema.name = parts.name;
+        schema.metadata = parts.metadata;
+        schema.flags = parts.flags;
+        schema.n_children = static_cast<std::int64_t>(schema_data->children.size());
+        schema.children = schema_data->children.data();
+        schema.dictionary = nullptr;
+        schema.release = &release_borrowed_schema;
+        schema.private_data = schema_data.release();
+
+        return arrow_proxy(std::move(array), std::move(schema));
+    }
+}
@@ -0,0 +1,262 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+
+namespace sparrow
+{
+    /// Maximum number of rows (or runs for run-end encoded arrays) in a chunk.
+    inline constexpr std::size_t chunk_size = 1024;
+
+    /**
+     * Validity of the rows of a chunk, packed in 64-bit words.
+     *
+     * Bit i % 64 of words[i / 64] is set if row i of the chunk is valid.
+     * Bits past the size of the chunk are always cleared, so the words
+     * can be combined without masking the tail. all_valid is set when
+     * every row of the chunk is valid.
+     */
+    struct chunk_validity
+    {
+        static constexpr std::size_t word_count = chunk_size / 64;
+
+        std::array<std::uint64_t, word_count> words = {};
+        bool all_valid = true;
+
+        [[nodiscard]] constexpr bool operator[](std::size_t i) const
+        {
+            return (words[i / 64] >> (i % 64)) & 1u;
+        }
+    };
+
+    /**
+     * Chunk of a primitive array.
+     *
+     * values points to the size values of the chunk, and row i
+     * of the chunk is row first + i of the array.
+     */
+    template <class T>
+    struct primitive_chunk
+    {
+        std::size_t first = 0;
+        std::size_t size = 0;
+        const T* values = nullptr;
+        chunk_validity validity;
+    };
+
+    /**
+     * Chunk of a variable size binary array.
+     *
+     * offsets points to the size + 1 offsets delimiting the values
+     * of the chunk in data, row i of the chunk is row first + i of
+     * the array.
+     */
+    template <class OT, class D>
+    struct binary_chunk
+    {
+        using value_type = std::conditional_t<std::same_as<D, char>, std::string_view, std::span<const D>>;
+
+        std::size_t first = 0;
+        std::size_t size = 0;
+        const OT* offsets = nullptr;
+        const D* data = nullptr;
+        chunk_validity validity;
+
+        [[nodiscard]] value_type value(std::size_t i) const
+        {
+            const auto begin = static_cast<std::size_t>(offsets[i]);
+            const auto end = static_cast<std::size_t>(offsets[i + 1]);
+            return value_type(data + begin, end - begin);
+        }
+    };
+
+    /**
+     * Chunk of a run-end encoded array.
+     *
+     * A run chunk holds size runs instead of size rows. run_ends points
+     * to the accumulated lengths of these runs, i.e. run k of the chunk
+     * covers the rows [run_begin(k), run_ends[k]) of the array. The value
+     * of run k is element first + k of values.
+     */
+    template <class R>
+    struct run_chunk
+    {
+        std::size_t first = 0;
+        std::size_t size = 0;
+        const R* run_ends = nullptr;
+        std::size_t first_row = 0;
+        const array_wrapper* values = nullptr;
+
+        [[nodiscard]] constexpr std::size_t run_begin(std::size_t k) const
+        {
+            return k == 0 ? first_row : static_cast<std::size_t>(run_ends[k - 1]);
+        }
+
+        [[nodiscard]] constexpr std::size_t run_length(std::size_t k) const
+        {
+            return static_cast<std::size_t>(run_ends[k]) - run_begin(k);
+        }
+    };
+
+    /**
+     * Calls func with consecutive primitive_chunk objects covering ar.
+     * The chunk object is reused between calls, func must copy what it
+     * needs to keep.
+     */
+    template <class T, class F>
+    void for_each_chunk(const primitive_array<T>& ar, F&& func);
+
+    /**
+     * Calls func with consecutive binary_chunk objects covering ar.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT, class F>
+    void for_each_chunk(const variable_size_binary_array<T, CR, OT>& ar, F&& func);
+
+    /**
+     * Calls func with consecutive run_chunk objects covering the runs of ar.
+     * func is called with run_chunk<R> where R is the type of the run ends,
+     * therefore it must accept any of them.
+     */
+    template <class F>
+    void for_each_chunk(const run_end_encoded_array& ar, F&& func);
+
+    /************************************
+     * chunked iteration implementation *
+     ************************************/
+
+    namespace detail
+    {
+        // Reads count (<= 64) bits starting at bit pos of bitmap, without
+        // reading past the byte holding the last requested bit.
+        inline std::uint64_t read_bitmap_word(const std::uint8_t* bitmap, std::size_t pos, std::size_t count)
+        {
+            const std::uint8_t* first = bitmap + pos / 8;
+            const std::size_t shift = pos % 8;
+            const std::size_t byte_count = (shift + count + 7) / 8;
+            std::uint64_t word = 0;
+            for (std::size_t k = 0; k < std::min(byte_count, std::size_t(8)); ++k)
+            {
+                word |= static_cast<std::uint64_t>(first[k]) << (8 * k);
+            }
+            word >>= shift;
+            if (byte_count > 8)
+            {
+                word |= static_cast<std::uint64_t>(first[8]) << (64 - shift);
+            }
+            return count == 64 ? word : word & ((std::uint64_t(1) << count) - 1);
+        }
+
+        inline void fill_chunk_validity(const validity_view& view, std::size_t first, std::size_t size, chunk_validity& res)
+        {
+            const std::size_t word_count = (size + 63) / 64;
+            res.all_valid = true;
+            for (std::size_t w = 0; w < word_count; ++w)
+            {
+                const std::size_t count = std::min(size - w * 64, std::size_t(64));
+                const std::uint64_t full = count == 64 ? std::numeric_limits<std::uint64_t>::max()
+                                                       : (std::uint64_t(1) << count) - 1;
+                if (view.all_valid())
+                {
+                    res.words[w] = full;
+                }
+                else
+                {
+                    res.words[w] = read_bitmap_word(view.data(), view.offset() + first + w * 64, count);
+                    res.all_valid = res.all_valid && res.words[w] == full;
+                }
+            }
+            std::fill(res.words.begin() + static_cast<std::ptrdiff_t>(word_count), res.words.end(), std::uint64_t(0));
+        }
+    }
+
+    template <class T, class F>
+    void for_each_chunk(const primitive_array<T>& ar, F&& func)
+    {
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+        const T* values = ar.data();
+        primitive_chunk<T> chunk;
+        for (std::size_t first = 0; first < ar.size(); first += chunk_size)
+        {
+            chunk.first = first;
+            chunk.size = std::min(chunk_size, ar.size() - first);
+            chunk.values = values + first;
+            detail::fill_chunk_validity(validity, first, chunk.size, chunk.validity);
+            func(std::as_const(chunk));
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT, class F>
+    void for_each_chunk(const variable_size_binary_array<T, CR, OT>& ar, F&& func)
+    {
+        using data_value_type = typename variable_size_binary_array<T, CR, OT>::data_value_type;
+        constexpr std::size_t offset_buffer_index = 1;
+        constexpr std::size_t data_buffer_index = 2;
+
+        const arrow_proxy& proxy = ar.get_arrow_proxy();
+        const validity_view validity = detail::make_validity_view(proxy);
+        const OT* offsets = proxy.buffers()[offset_buffer_index].template data<const OT>()
+                            + static_cast<std::size_t>(proxy.offset());
+        const data_value_type* data = proxy.buffers()[data_buffer_index].template data<const data_value_type>();
+        binary_chunk<OT, data_value_type> chunk;
+        chunk.data = data;
+        for (std::size_t first = 0; first < ar.size(); first += chunk_size)
+        {
+            chunk.first = first;
+            chunk.size = std::min(chunk_size, ar.size() - first);
+            chunk.offsets = offsets + first;
+            detail::fill_chunk_validity(validity, first, chunk.size, chunk.validity);
+            func(std::as_const(chunk));
+        }
+    }
+
+    template <class F>
+    void for_each_chunk(const run_end_encoded_array& ar, F&& func)
+    {
+        std::visit(
+            [&ar, &func](auto run_ends)
+            {
+                using run_end_type = std::remove_const_t<std::remove_pointer_t<decltype(run_ends)>>;
+                run_chunk<run_end_type> chunk;
+                chunk.values = &ar.encoded_values();
+                const std::size_t run_count = ar.run_count();
+                for (std::size_t first = 0; first < run_count; first += chunk_size)
+                {
+                    chunk.first = first;
+                    chunk.size = std::min(chunk_size, run_count - first);
+                    chunk.run_ends = run_ends + first;
+                    chunk.first_row = first == 0 ? 0 : static_cast<std::size_t>(run_ends[first - 1]);
+                    func(std::as_const(chunk));
+                }
+            },
+            ar.run_ends()
+        );
+    }
+}
@@ -0,0 +1,329 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_bitmap_base.hpp"
+#include "sparrow/layout/layout_utils.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/decimal.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
+#include "sparrow/utils/mp_utils.hpp"
+#include "sparrow/utils/nullable.hpp"
+
+namespace sparrow
+{
+    template <class T>
+    class decimal_array;
+
+    using decimal128_array = decimal_array<decimal128_t>;
+    using decimal256_array = decimal_array<decimal256_t>;
+
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+
+        template <class T>
+        struct get_data_type_from_array<sparrow::decimal_array<T>>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return arrow_traits<T>::type_id;
+            }
+        };
+    }
+
+    template <class T>
+    struct array_inner_types<decimal_array<T>> : array_inner_types_base
+    {
+        using array_type = decimal_array<T>;
+
+        using inner_value_type = T;
+        using inner_reference = T;
+        using inner_const_reference = T;
+
+        using const_value_iterator = functor_index_iterator<
+            detail::layout_value_functor<const array_type, inner_value_type>>;
+        using iterator_tag = std::random_access_iterator_tag;
+    };
+
+    /**
+     * Array of decimal numbers (the Arrow Decimal128 and Decimal256 layouts,
+     * "d:precision,scale" and "d:precision,scale,256").
+     *
+     * The data buffer holds the unscaled values as little endian two's
+     * complement integers; the precision and the scale, shared by all the
+     * elements, are read from the format. Elements are decimal values
+     * carrying the scale of the array. Arithmetic, comparison and conversion
+     * kernels are declared in decimal_kernels.hpp.
+     *
+     * @tparam T decimal128_t or decimal256_t.
+     */
+    template <class T>
+    class decimal_array final : public array_bitmap_base<decimal_array<T>>
+    {
+    public:
+
+        using self_type = decimal_array<T>;
+        using base_type = array_bitmap_base<self_type>;
+        using inner_types = array_inner_types<self_type>;
+        using inner_value_type = typename inner_types::inner_value_type;
+        using inner_reference = typename inner_types::inner_reference;
+        using inner_const_reference = typename inner_types::inner_const_reference;
+        using integer_type = typename T::integer_type;
+        using bitmap_type = typename base_type::bitmap_type;
+        using bitmap_const_reference = typename base_type::bitmap_const_reference;
+        using value_type = nullable<inner_value_type>;
+        using const_reference = nullable<inner_const_reference, bitmap_const_reference>;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using iterator_tag = typename base_type::iterator_tag;
+
+        using const_bitmap_range = typename base_type::const_bitmap_range;
+        using const_value_iterator = typename inner_types::const_value_iterator;
+
+        explicit decimal_array(arrow_proxy);
+
+        template <class... Args>
+            requires(mpl::excludes_copy_and_move_ctor_v<decimal_array<T>, Args...>)
+        decimal_array(Args&&... args)
+            : decimal_array(create_proxy(std::forward<Args>(args)...))
+        {
+        }
+
+        using base_type::get_arrow_proxy;
+        using base_type::size;
+
+        /// Maximum number of significant digits of the elements.
+        [[nodiscard]] std::size_t precision() const;
+        /// Number of digits after the decimal point of the elements.
+        [[nodiscard]] std::int32_t scale() const;
+
+        /// Unscaled values of the elements, including the null ones.
+        [[nodiscard]] const integer_type* data() const;
+
+    private:
+
+        /**
+         * Builds an array from unscaled values. The values are not checked
+         * against the precision.
+         */
+        template <validity_bitmap_input VB = validity_bitmap>
+        static arrow_proxy create_proxy(
+            u8_buffer<integer_type>&& data_buffer,
+            std::size_t precision,
+            std::int32_t scale,
+            VB&& validity_input = validity_bitmap{}
+        );
+
+        /**
+         * Builds an array from decimal values, rescaled to \c scale.
+         *
+         * @throws std::overflow_error if a value does not fit \c precision.
+         */
+        template <std::ranges::input_range R, validity_bitmap_input VB = validity_bitmap>
+            requires std::convertible_to<std::ranges::range_value_t<R>, T>
+        static arrow_proxy create_proxy(
+            R&& values,
+            std::size_t precision,
+            std::int32_t scale,
+            VB&& validity_input = validity_bitmap{}
+        );
+
+        inner_const_reference value(size_type i) const;
+
+        const_value_iterator value_cbegin() const;
+        const_value_iterator value_cend() const;
+
+        static constexpr size_type DATA_BUFFER_INDEX = 1;
+
+        decimal_format m_format;
+
+        friend class array_crtp_base<self_type>;
+        friend class detail::layout_value_functor<const self_type, inner_value_type>;
+    };
+
+    /********************************
+     * decimal_array implementation *
+     ********************************/
+
+    namespace detail
+    {
+        /// Format string of decimals of type T with the given precision and scale.
+        template <class T>
+        std::string decimal_format_string(std::size_t precision, std::int32_t scale)
+        {
+            std::string format = "d:" + std::to_string(precision) + "," + std::to_string(scale);
+            if constexpr (arrow_traits<T>::type_id == data_type::DECIMAL256)
+            {
+                format += ",256";
+            }
+            return format;
+        }
+
+        /// Returns true if value has at most precision digits.
+        template <class I>
+        bool fits_precision(const I& value, const I& bound)
+        {
+            return value < bound && -bound < value;
+        }
+
+        /// 10^precision, the exclusive bound of the values of that precision.
+        template <class I>
+        I precision_bound(std::size_t precision)
+        {
+            I bound;
+            const bool overflow = pow10_overflow(precision, bound);
+            SPARROW_ASSERT_TRUE(!overflow);
+            static_cast<void>(overflow);
+            return bound;
+        }
+    }
+
+    template <class T>
+    decimal_array<T>::decimal_array(arrow_proxy proxy)
+        : base_type(std::move(proxy))
+    {
+        SPARROW_ASSERT_TRUE(get_arrow_proxy().data_type() == detail::get_data_type_from_array<self_type>::get());
+        const auto format = parse_decimal_format(get_arrow_proxy().format());
+        SPARROW_ASSERT_TRUE(format.has_value());
+        m_format = *format;
+    }
+
+    template <class T>
+    std::size_t decimal_array<T>::precision() const
+    {
+        return m_format.precision;
+    }
+
+    template <class T>
+    std::int32_t decimal_array<T>::scale() const
+    {
+        return m_format.scale;
+    }
+
+    template <class T>
+    auto decimal_array<T>::data() const -> const integer_type*
+    {
+        return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<const integer_type>()
+               + static_cast<size_type>(get_arrow_proxy().offset());
+    }
+
+    template <class T>
+    template <validity_bitmap_input VB>
+    arrow_proxy decimal_array<T>::create_proxy(
+        u8_buffer<integer_type>&& data_buffer,
+        std::size_t precision,
+        std::int32_t scale,
+        VB&& validity_input
+    )
+    {
+        SPARROW_ASSERT_TRUE(precision > 0 && precision <= T::max_precision);
+        const auto size = data_buffer.size();
+        validity_bitmap bitmap = ensure_validity_bitmap(size, std::forward<VB>(validity_input));
+        const auto null_count = bitmap.null_count();
+
+        ArrowSchema schema = make_arrow_schema(
+            detail::decimal_format_string<T>(precision, scale),
+            std::nullopt,  // name
+            std::nullopt,  // metadata
+            std::nullopt,  // flags
+            0,             // n_children
+            nullptr,       // children
+            nullptr        // dictionary
+        );
+
+        std::vector<buffer<std::uint8_t>> buffers(2);
+        buffers[0] = std::move(bitmap).extract_storage();
+        buffers[1] = std::move(data_buffer).extract_storage();
+
+        ArrowArray arr = make_arrow_array(
+            static_cast<std::int64_t>(size),  // length
+            static_cast<std::int64_t>(null_count),
+            0,  // offset
+            std::move(buffers),
+            0,        // n_children
+            nullptr,  // children
+            nullptr   // dictionary
+        );
+        return arrow_proxy(std::move(arr), std::move(schema));
+    }
+
+    template <class T>
+    template <std::ranges::input_range R, validity_bitmap_input VB>
+        requires std::convertible_to<std::ranges::range_value_t<R>, T>
+    arrow_proxy decimal_array<T>::create_proxy(
+        R&& values,
+        std::size_t precision,
+        std::int32_t scale,
+        VB&& validity_input
+    )
+    {
+        SPARROW_ASSERT_TRUE(precision > 0 && precision <= T::max_precision);
+        const auto bound = detail::precision_bound<integer_type>(precision);
+        std::vector<integer_type> unscaled;
+        for (const auto& v : values)
+        {
+            const integer_type rescaled = static_cast<T>(v).rescale(scale).value();
+            if (!detail::fits_precision(rescaled, bound))
+            {
+                throw std::overflow_error("decimal value exceeds the precision of the array");
+            }
+            unscaled.push_back(rescaled);
+        }
+        return create_proxy(
+            u8_buffer<integer_type>(std::move(unscaled)),
+            precision,
+            scale,
+            std::forward<VB>(validity_input)
+        );
+    }
+
+    template <class T>
+    auto decimal_array<T>::value(size_type i) const -> inner_const_reference
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return T(data()[i], scale());
+    }
+
+    template <class T>
+    auto decimal_array<T>::value_cbegin() const -> const_value_iterator
+    {
+        return const_value_iterator(detail::layout_value_functor<const self_type, inner_value_type>(this), 0);
+    }
+
+    template <class T>
+    auto decimal_array<T>::value_cend() const -> const_value_iterator
+    {
+        return const_value_iterator(
+            detail::layout_value_functor<const self_type, inner_value_type>(this),
+            this->size()
+        );
+    }
+}
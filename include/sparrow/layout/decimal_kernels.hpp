@@ -0,0 +1,579 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/decimal_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_array_builder.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/utils/decimal.hpp"
+#include "sparrow/utils/wide_integer.hpp"
+
+namespace sparrow
+{
+    /**
+     * Kernels over decimal arrays, working on the unscaled integers of the
+     * data buffers. The element-wise kernels take arrays of the same size;
+     * an element of the result is null if an operand is null.
+     *
+     * Operands of different scales are brought to the same scale once,
+     * before the main loop, which then only adds, subtracts or compares
+     * integers. Overflow is detected on the non-null elements only.
+     */
+
+    /**
+     * Element-wise sum. The scale of the result is the larger scale of the
+     * operands, and its precision is the one needed to hold any sum of the
+     * operands, capped to the maximum precision of T.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     * @throws std::overflow_error if a sum exceeds the precision of the result.
+     */
+    template <class T>
+    [[nodiscard]] decimal_array<T> decimal_add(const decimal_array<T>& lhs, const decimal_array<T>& rhs);
+
+    /// Element-wise difference, with the same rules as decimal_add.
+    template <class T>
+    [[nodiscard]] decimal_array<T> decimal_subtract(const decimal_array<T>& lhs, const decimal_array<T>& rhs);
+
+    /**
+     * Element-wise product. The scale of the result is the sum of the scales
+     * of the operands, and its precision the sum of their precisions plus
+     * one, capped to the maximum precision of T.
+     *
+     * @throws std::invalid_argument if the arrays have different sizes.
+     * @throws std::overflow_error if a product exceeds the precision of the result.
+     */
+    template <class T>
+    [[nodiscard]] decimal_array<T> decimal_multiply(const decimal_array<T>& lhs, const decimal_array<T>& rhs);
+
+    /**
+     * Element-wise product rescaled to \c scale, rounding half away from
+     * zero. The exact product is computed on twice as many bits before it is
+     * rescaled, so that it is rounded only once.
+     */
+    template <class T>
+    [[nodiscard]] decimal_array<T>
+    decimal_multiply(const decimal_array<T>& lhs, const decimal_array<T>& rhs, std::int32_t scale);
+
+    /**
+     * Comparison predicates: the bit i of the result is set if neither
+     * operand is null at i and the comparison holds. Values are compared
+     * numerically, whatever their scales.
+     */
+
+    template <class T>
+    [[nodiscard]] validity_bitmap decimal_equal(const decimal_array<T>& lhs, const decimal_array<T>& rhs);
+
+    template <class T>
+    [[nodiscard]] validity_bitmap decimal_equal(const decimal_array<T>& ar, const T& value);
+
+    template <class T>
+    [[nodiscard]] validity_bitmap decimal_less(const decimal_array<T>& lhs, const decimal_array<T>& rhs);
+
+    template <class T>
+    [[nodiscard]] validity_bitmap decimal_less(const decimal_array<T>& ar, const T& value);
+
+    template <class T>
+    [[nodiscard]] validity_bitmap decimal_greater(const decimal_array<T>& ar, const T& value);
+
+    /**
+     * Sum of the non-null elements, with the scale of \c ar. Intermediate
+     * sums may wrap around as long as the final sum fits T.
+     *
+     * @throws std::overflow_error if the sum does not fit T.
+     */
+    template <class T>
+    [[nodiscard]] T decimal_sum(const decimal_array<T>& ar);
+
+    /// Nearest double of each element.
+    template <class T>
+    [[nodiscard]] primitive_array<double> decimal_to_double(const decimal_array<T>& ar);
+
+    /// Decimal representation of each element, e.g. "-12.50" for a scale of 2.
+    template <class T>
+    [[nodiscard]] string_array decimal_to_string(const decimal_array<T>& ar);
+
+    /**
+     * Decimals of the given precision and scale nearest to the elements of
+     * \c ar, rounding half away from zero.
+     *
+     * @throws std::invalid_argument if a non-null element is not finite.
+     * @throws std::overflow_error if a value exceeds \c precision.
+     */
+    template <class T>
+    [[nodiscard]] decimal_array<T>
+    decimal_from_double(const primitive_array<double>& ar, std::size_t precision, std::int32_t scale);
+
+    /**
+     * Parses the elements of \c ar, as decimal::from_string does, into
+     * decimals of the given precision and scale.
+     *
+     * @throws std::invalid_argument if a non-null element is not a decimal number.
+     * @throws std::overflow_error if a value exceeds \c precision.
+     */
+    template <class T, std::ranges::sized_range S, class CR, layout_offset OT>
+    [[nodiscard]] decimal_array<T>
+    decimal_from_string(const variable_size_binary_array<S, CR, OT>& ar, std::size_t precision, std::int32_t scale);
+
+    /**********************************
+     * decimal kernels implementation *
+     **********************************/
+
+    namespace detail
+    {
+        template <class T>
+        std::size_t clamp_decimal_precision(std::int64_t precision)
+        {
+            return static_cast<std::size_t>(
+                std::clamp(precision, std::int64_t(1), static_cast<std::int64_t>(T::max_precision))
+            );
+        }
+
+        template <class T>
+        validity_view decimal_validity(const decimal_array<T>& ar)
+        {
+            return make_validity_view(ar.get_arrow_proxy());
+        }
+
+        inline void check_same_size(std::size_t lhs, std::size_t rhs)
+        {
+            if (lhs != rhs)
+            {
+                throw std::invalid_argument("the operands of a decimal kernel must have the same size");
+            }
+        }
+
+        // Unscaled values of ar, rescaled up to scale. The data of ar is used
+        // directly if its scale is already scale, storage holds the rescaled
+        // values otherwise.
+        template <class T>
+        std::span<const typename T::integer_type> upscaled_values(
+            const decimal_array<T>& ar,
+            std::int32_t scale,
+            const validity_bitmap& validity,
+            std::vector<typename T::integer_type>& storage
+        )
+        {
+            using integer_type = typename T::integer_type;
+            const std::size_t n = ar.size();
+            const integer_type* data = ar.data();
+            if (scale == ar.scale())
+            {
+                return {data, n};
+            }
+            integer_type factor;
+            if (pow10_overflow(static_cast<std::size_t>(scale - ar.scale()), factor))
+            {
+                throw std::overflow_error("decimal rescale overflow");
+            }
+            storage.resize(n);
+            bool overflow = false;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const bool element_overflow = mul_overflow(data[i], factor, storage[i]);
+                overflow = overflow || (element_overflow && validity.test(i));
+            }
+            if (overflow)
+            {
+                throw std::overflow_error("decimal rescale overflow");
+            }
+            return storage;
+        }
+
+        // Element-wise addition or subtraction; op sets its last argument and
+        // returns true on overflow.
+        template <class T, class F>
+        decimal_array<T> decimal_additive(const decimal_array<T>& lhs, const decimal_array<T>& rhs, F&& op)
+        {
+            using integer_type = typename T::integer_type;
+            check_same_size(lhs.size(), rhs.size());
+            const std::size_t n = lhs.size();
+            const std::int32_t scale = std::max(lhs.scale(), rhs.scale());
+            const std::int64_t integer_digits = std::max(
+                static_cast<std::int64_t>(lhs.precision()) - lhs.scale(),
+                static_cast<std::int64_t>(rhs.precision()) - rhs.scale()
+            );
+            const std::size_t precision = clamp_decimal_precision<T>(integer_digits + scale + 1);
+
+            validity_bitmap validity = and_validity(decimal_validity(lhs), decimal_validity(rhs));
+            std::vector<integer_type> lhs_storage;
+            std::vector<integer_type> rhs_storage;
+            const auto a = upscaled_values(lhs, scale, validity, lhs_storage);
+            const auto b = upscaled_values(rhs, scale, validity, rhs_storage);
+
+            const integer_type bound = precision_bound<integer_type>(precision);
+            u8_buffer<integer_type> result(n);
+            integer_type* out = result.data();
+            bool overflow = false;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const bool element_overflow = op(a[i], b[i], out[i]) || !fits_precision(out[i], bound);
+                overflow = overflow || (element_overflow && validity.test(i));
+            }
+            if (overflow)
+            {
+                throw std::overflow_error("decimal result exceeds its precision");
+            }
+            return decimal_array<T>(std::move(result), precision, scale, std::move(validity));
+        }
+
+        // Sets bit i of the result if neither operand is null at i and
+        // pred(lhs[i] <=> rhs[i]) holds.
+        template <class T, class P>
+        validity_bitmap decimal_compare(const decimal_array<T>& lhs, const decimal_array<T>& rhs, P&& pred)
+        {
+            check_same_size(lhs.size(), rhs.size());
+            const std::size_t n = lhs.size();
+            const validity_bitmap validity = and_validity(decimal_validity(lhs), decimal_validity(rhs));
+            validity_bitmap result(n, false);
+            const auto* a = lhs.data();
+            const auto* b = rhs.data();
+            if (lhs.scale() == rhs.scale())
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (pred(a[i] <=> b[i]) && validity.test(i))
+                    {
+                        result.set(i, true);
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (validity.test(i) && pred(T(a[i], lhs.scale()) <=> T(b[i], rhs.scale())))
+                    {
+                        result.set(i, true);
+                    }
+                }
+            }
+            return result;
+        }
+
+        // Sets bit i of the result if ar is not null at i and
+        // pred(ar[i] <=> value) holds.
+        template <class T, class P>
+        validity_bitmap decimal_compare(const decimal_array<T>& ar, const T& value, P&& pred)
+        {
+            using integer_type = typename T::integer_type;
+            const std::size_t n = ar.size();
+            const validity_view validity = decimal_validity(ar);
+            validity_bitmap result(n, false);
+            const integer_type* data = ar.data();
+
+            // The value is brought to the scale of the array once if it is
+            // exact, otherwise elements are compared as decimals.
+            integer_type scaled;
+            const std::int64_t delta = static_cast<std::int64_t>(ar.scale()) - value.scale();
+            if (delta >= 0 && !scale_overflow(value.value(), delta, scaled))
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (pred(data[i] <=> scaled) && validity[i])
+                    {
+                        result.set(i, true);
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (validity[i] && pred(T(data[i], ar.scale()) <=> value))
+                    {
+                        result.set(i, true);
+                    }
+                }
+            }
+            return result;
+        }
+
+        inline bool is_eq_ordering(std::strong_ordering order)
+        {
+            return order == std::strong_ordering::equal;
+        }
+
+        inline bool is_lt_ordering(std::strong_ordering order)
+        {
+            return order == std::strong_ordering::less;
+        }
+
+        inline bool is_gt_ordering(std::strong_ordering order)
+        {
+            return order == std::strong_ordering::greater;
+        }
+    }
+
+    template <class T>
+    decimal_array<T> decimal_add(const decimal_array<T>& lhs, const decimal_array<T>& rhs)
+    {
+        using integer_type = typename T::integer_type;
+        return detail::decimal_additive(
+            lhs,
+            rhs,
+            [](const integer_type& a, const integer_type& b, integer_type& out)
+            {
+                return add_overflow(a, b, out);
+            }
+        );
+    }
+
+    template <class T>
+    decimal_array<T> decimal_subtract(const decimal_array<T>& lhs, const decimal_array<T>& rhs)
+    {
+        using integer_type = typename T::integer_type;
+        return detail::decimal_additive(
+            lhs,
+            rhs,
+            [](const integer_type& a, const integer_type& b, integer_type& out)
+            {
+                return sub_overflow(a, b, out);
+            }
+        );
+    }
+
+    template <class T>
+    decimal_array<T> decimal_multiply(const decimal_array<T>& lhs, const decimal_array<T>& rhs)
+    {
+        return decimal_multiply(lhs, rhs, lhs.scale() + rhs.scale());
+    }
+
+    template <class T>
+    decimal_array<T> decimal_multiply(const decimal_array<T>& lhs, const decimal_array<T>& rhs, std::int32_t scale)
+    {
+        using integer_type = typename T::integer_type;
+        using wide_type = wide_integer<2 * integer_type::word_count>;
+        detail::check_same_size(lhs.size(), rhs.size());
+        const std::size_t n = lhs.size();
+        const std::int64_t product_scale = static_cast<std::int64_t>(lhs.scale()) + rhs.scale();
+        const std::int64_t integer_digits = static_cast<std::int64_t>(lhs.precision()) - lhs.scale()
+                                            + static_cast<std::int64_t>(rhs.precision()) - rhs.scale();
+        const std::size_t precision = detail::clamp_decimal_precision<T>(integer_digits + scale + 1);
+
+        validity_bitmap validity = detail::and_validity(detail::decimal_validity(lhs), detail::decimal_validity(rhs));
+        const integer_type* a = lhs.data();
+        const integer_type* b = rhs.data();
+        const integer_type bound = detail::precision_bound<integer_type>(precision);
+        u8_buffer<integer_type> result(n);
+        integer_type* out = result.data();
+        bool overflow = false;
+        if (product_scale == scale)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const bool element_overflow = mul_overflow(a[i], b[i], out[i])
+                                              || !detail::fits_precision(out[i], bound);
+                overflow = overflow || (element_overflow && validity.test(i));
+            }
+        }
+        else
+        {
+            const std::int64_t delta = scale - product_scale;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                // The product of two integers of N words always fits 2N words.
+                const wide_type product = wide_type(a[i]) * wide_type(b[i]);
+                wide_type rescaled;
+                bool element_overflow = detail::scale_overflow(product, delta, rescaled);
+                out[i] = integer_type(rescaled);
+                element_overflow = element_overflow || wide_type(out[i]) != rescaled
+                                   || !detail::fits_precision(out[i], bound);
+                overflow = overflow || (element_overflow && validity.test(i));
+            }
+        }
+        if (overflow)
+        {
+            throw std::overflow_error("decimal result exceeds its precision");
+        }
+        return decimal_array<T>(std::move(result), precision, scale, std::move(validity));
+    }
+
+    template <class T>
+    validity_bitmap decimal_equal(const decimal_array<T>& lhs, const decimal_array<T>& rhs)
+    {
+        return detail::decimal_compare(lhs, rhs, &detail::is_eq_ordering);
+    }
+
+    template <class T>
+    validity_bitmap decimal_equal(const decimal_array<T>& ar, const T& value)
+    {
+        return detail::decimal_compare(ar, value, &detail::is_eq_ordering);
+    }
+
+    template <class T>
+    validity_bitmap decimal_less(const decimal_array<T>& lhs, const decimal_array<T>& rhs)
+    {
+        return detail::decimal_compare(lhs, rhs, &detail::is_lt_ordering);
+    }
+
+    template <class T>
+    validity_bitmap decimal_less(const decimal_array<T>& ar, const T& value)
+    {
+        return detail::decimal_compare(ar, value, &detail::is_lt_ordering);
+    }
+
+    template <class T>
+    validity_bitmap decimal_greater(const decimal_array<T>& ar, const T& value)
+    {
+        return detail::decimal_compare(ar, value, &detail::is_gt_ordering);
+    }
+
+    template <class T>
+    T decimal_sum(const decimal_array<T>& ar)
+    {
+        using integer_type = typename T::integer_type;
+        const std::size_t n = ar.size();
+        const validity_view validity = detail::decimal_validity(ar);
+        const integer_type* data = ar.data();
+
+        // Each wrap around is counted with its direction; the final sum is
+        // exact if they cancel out.
+        integer_type sum;
+        std::int64_t wraps = 0;
+        const auto accumulate = [&](const integer_type& value)
+        {
+            const bool overflow = add_overflow(sum, value, sum);
+            wraps += overflow ? (value.is_negative() ? -1 : 1) : 0;
+        };
+        if (validity.all_valid())
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                accumulate(data[i]);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (validity[i])
+                {
+                    accumulate(data[i]);
+                }
+            }
+        }
+        if (wraps != 0)
+        {
+            throw std::overflow_error("decimal sum overflow");
+        }
+        return T(sum, ar.scale());
+    }
+
+    template <class T>
+    primitive_array<double> decimal_to_double(const decimal_array<T>& ar)
+    {
+        const std::size_t n = ar.size();
+        const auto* data = ar.data();
+        u8_buffer<double> result(n);
+        double* out = result.data();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = static_cast<double>(T(data[i], ar.scale()));
+        }
+        return primitive_array<double>(std::move(result), detail::copy_validity(detail::decimal_validity(ar)));
+    }
+
+    template <class T>
+    string_array decimal_to_string(const decimal_array<T>& ar)
+    {
+        const std::size_t n = ar.size();
+        const validity_view validity = detail::decimal_validity(ar);
+        const auto* data = ar.data();
+        string_array_builder builder;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (validity[i])
+            {
+                builder.push_back(T(data[i], ar.scale()).to_string());
+            }
+            else
+            {
+                builder.push_back(nullval);
+            }
+        }
+        return builder.finish();
+    }
+
+    template <class T>
+    decimal_array<T> decimal_from_double(const primitive_array<double>& ar, std::size_t precision, std::int32_t scale)
+    {
+        using integer_type = typename T::integer_type;
+        SPARROW_ASSERT_TRUE(precision > 0 && precision <= T::max_precision);
+        const typed_view<double> view(ar);
+        const std::size_t n = view.size();
+        const integer_type bound = detail::precision_bound<integer_type>(precision);
+        u8_buffer<integer_type> result(n);
+        integer_type* out = result.data();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = integer_type();
+            if (view.has_value(i))
+            {
+                out[i] = T::from_double(view.data()[i], scale).value();
+                if (!detail::fits_precision(out[i], bound))
+                {
+                    throw std::overflow_error("decimal value exceeds the precision of the array");
+                }
+            }
+        }
+        return decimal_array<T>(std::move(result), precision, scale, detail::copy_validity(view.validity()));
+    }
+
+    template <class T, std::ranges::sized_range S, class CR, layout_offset OT>
+    decimal_array<T>
+    decimal_from_string(const variable_size_binary_array<S, CR, OT>& ar, std::size_t precision, std::int32_t scale)
+    {
+        using integer_type = typename T::integer_type;
+        SPARROW_ASSERT_TRUE(precision > 0 && precision <= T::max_precision);
+        const auto bufs = detail::get_binary_buffers(ar);
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+        const std::size_t n = ar.size();
+        const integer_type bound = detail::precision_bound<integer_type>(precision);
+        u8_buffer<integer_type> result(n);
+        integer_type* out = result.data();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = integer_type();
+            if (validity[i])
+            {
+                const std::string_view str(
+                    reinterpret_cast<const char*>(bufs.value_data(i)),
+                    bufs.value_size(i)
+                );
+                out[i] = T::from_string(str, scale).value();
+                if (!detail::fits_precision(out[i], bound))
+                {
+                    throw std::overflow_error("decimal value exceeds the precision of the array");
+                }
+            }
+        }
+        return decimal_array<T>(std::move(result), precision, scale, detail::copy_validity(validity));
+    }
+}
@@ -0,0 +1,439 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_dictionary_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_array_builder.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/bit.hpp"
+
+namespace sparrow
+{
+    /**
+     * Dictionary encodes \c ar: each distinct non-null value is stored once in
+     * the dictionary, in order of first appearance, and each element is
+     * replaced with the index of its value in the dictionary. Null elements
+     * have null keys.
+     *
+     * Primitive values are compared by their bit pattern, so that NaNs with the
+     * same payload share a single dictionary entry.
+     *
+     * @param ar the array to encode.
+     * @param index_type the integer type of the keys. When not specified, the
+     *        smallest signed integer type that can index the dictionary is used.
+     * @return a sparrow owned proxy over the keys, whose dictionary is set.
+     * @throws std::invalid_argument if \c index_type is not an integer type.
+     * @throws std::length_error if \c index_type cannot index the dictionary.
+     */
+    template <class T>
+        requires(!std::same_as<T, bool>)
+    arrow_proxy dictionary_encode(const primitive_array<T>& ar, std::optional<data_type> index_type = std::nullopt);
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    arrow_proxy dictionary_encode(
+        const variable_size_binary_array<T, CR, OT>& ar,
+        std::optional<data_type> index_type = std::nullopt
+    );
+
+    /**
+     * Materializes the values of \c ar into an array of type \c A, which must
+     * be the type of the dictionary of \c ar. An element is null if its key
+     * or the dictionary entry it refers to is null.
+     *
+     * @see typed_dictionary_view::decode
+     */
+    template <class A, std::integral IT>
+    A decode(const dictionary_encoded_array<IT>& ar);
+
+    /************************************
+     * dictionary_encode implementation *
+     ************************************/
+
+    namespace detail
+    {
+        // Open addressing hash table with linear probing, mapping the values
+        // of an array to their index in the dictionary. The table only stores
+        // indices: the first element holding a value stands for it and the
+        // comparison of values is delegated to the caller.
+        class dictionary_hash_table
+        {
+        public:
+
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            explicit dictionary_hash_table(std::size_t expected_size)
+            {
+                std::size_t capacity = 16;
+                while (capacity < 2 * expected_size)
+                {
+                    capacity *= 2;
+                }
+                m_slots.assign(capacity, npos);
+            }
+
+            // Returns the index in the dictionary of the value of element, or
+            // npos if it is not found.
+            template <class Equal>
+            std::size_t find(std::uint64_t hash, std::size_t element, Equal&& equal) const
+            {
+                const std::size_t mask = m_slots.size() - 1;
+                std::size_t pos = static_cast<std::size_t>(hash) & mask;
+                while (m_slots[pos] != npos)
+                {
+                    const std::size_t index = m_slots[pos];
+                    if (m_hashes[index] == hash && equal(m_representatives[index], element))
+                    {
+                        return index;
+                    }
+                    pos = (pos + 1) & mask;
+                }
+                return npos;
+            }
+
+            // Returns the index in the dictionary of the value of element,
+            // inserting it if it is not found. equal(i, j) compares the values
+            // of the elements i and j.
+            template <class Equal>
+            std::size_t find_or_insert(std::uint64_t hash, std::size_t element, Equal&& equal)
+            {
+                const std::size_t mask = m_slots.size() - 1;
+                std::size_t pos = static_cast<std::size_t>(hash) & mask;
+                while (m_slots[pos] != npos)
+                {
+                    const std::size_t index = m_slots[pos];
+                    if (m_hashes[index] == hash && equal(m_representatives[index], element))
+                    {
+                        return index;
+                    }
+                    pos = (pos + 1) & mask;
+                }
+                const std::size_t index = m_representatives.size();
+                m_slots[pos] = index;
+                m_hashes.push_back(hash);
+                m_representatives.push_back(element);
+                if (2 * m_representatives.size() > m_slots.size())
+                {
+                    grow();
+                }
+                return index;
+            }
+
+            std::size_t size() const noexcept
+            {
+                return m_representatives.size();
+            }
+
+            // The element standing for each entry of the dictionary.
+            const std::vector<std::size_t>& representatives() const noexcept
+            {
+                return m_representatives;
+            }
+
+        private:
+
+            void grow()
+            {
+                std::vector<std::size_t> slots(2 * m_slots.size(), npos);
+                const std::size_t mask = slots.size() - 1;
+                for (std::size_t index = 0; index < m_hashes.size(); ++index)
+                {
+                    std::size_t pos = static_cast<std::size_t>(m_hashes[index]) & mask;
+                    while (slots[pos] != npos)
+                    {
+                        pos = (pos + 1) & mask;
+                    }
+                    slots[pos] = index;
+                }
+                m_slots = std::move(slots);
+            }
+
+            std::vector<std::size_t> m_slots;
+            std::vector<std::uint64_t> m_hashes;
+            std::vector<std::size_t> m_representatives;
+        };
+
+        template <class T>
+        std::uint64_t bits_of(const T& value)
+        {
+            static_assert(sizeof(T) <= sizeof(std::uint64_t));
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            return bits;
+        }
+
+        // Returns the validity bitmap of the proxy, or nullptr if it has no
+        // null element.
+        inline const std::uint8_t* validity_data(const arrow_proxy& proxy)
+        {
+            return proxy.null_count() == 0 ? nullptr : proxy.buffers()[0].data();
+        }
+
+        // Fills keys with the dictionary index of each non null element and
+        // returns the hash table. Hashes are computed by blocks before the
+        // table is probed, so that the hashing loop can be vectorized and the
+        // probing loop does not wait on it.
+        template <class Hash, class Equal>
+        dictionary_hash_table hash_encode(
+            std::size_t size,
+            const std::uint8_t* validity,
+            std::size_t array_offset,
+            Hash&& hash,
+            Equal&& equal,
+            std::vector<std::size_t>& keys
+        )
+        {
+            constexpr std::size_t block_size = 256;
+            std::array<std::uint64_t, block_size> hashes;
+            dictionary_hash_table table(std::min<std::size_t>(size, 1024));
+            keys.assign(size, 0);
+            const dynamic_bitset_view<const std::uint8_t> valid(
+                validity,
+                validity == nullptr ? 0 : array_offset + size
+            );
+            for (std::size_t first = 0; first < size; first += block_size)
+            {
+                const std::size_t count = std::min(block_size, size - first);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    hashes[i] = hash(first + i);
+                }
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    const std::size_t element = first + i;
+                    if (validity == nullptr || valid.test(array_offset + element))
+                    {
+                        keys[element] = table.find_or_insert(hashes[i], element, equal);
+                    }
+                }
+            }
+            return table;
+        }
+
+        template <class F>
+        decltype(auto) visit_index_type(data_type dt, F&& f)
+        {
+            switch (dt)
+            {
+                case data_type::INT8:
+                    return f(std::type_identity<std::int8_t>{});
+                case data_type::UINT8:
+                    return f(std::type_identity<std::uint8_t>{});
+                case data_type::INT16:
+                    return f(std::type_identity<std::int16_t>{});
+                case data_type::UINT16:
+                    return f(std::type_identity<std::uint16_t>{});
+                case data_type::INT32:
+                    return f(std::type_identity<std::int32_t>{});
+                case data_type::UINT32:
+                    return f(std::type_identity<std::uint32_t>{});
+                case data_type::INT64:
+                    return f(std::type_identity<std::int64_t>{});
+                case data_type::UINT64:
+                    return f(std::type_identity<std::uint64_t>{});
+                default:
+                    throw std::invalid_argument("dictionary index type must be an integer type");
+            }
+        }
+
+        inline data_type smallest_index_type(std::size_t dictionary_size)
+        {
+            // The largest key is dictionary_size - 1.
+            if (dictionary_size <= static_cast<std::size_t>(std::numeric_limits<std::int8_t>::max()) + 1)
+            {
+                return data_type::INT8;
+            }
+            if (dictionary_size <= static_cast<std::size_t>(std::numeric_limits<std::int16_t>::max()) + 1)
+            {
+                return data_type::INT16;
+            }
+            if (dictionary_size <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()) + 1)
+            {
+                return data_type::INT32;
+            }
+            return data_type::INT64;
+        }
+
+        // Builds the keys array and attaches the dictionary to it.
+        inline arrow_proxy make_dictionary_encoded_proxy(
+            const std::vector<std::size_t>& keys,
+            const std::uint8_t* validity,
+            std::size_t array_offset,
+            arrow_proxy dictionary,
+            std::size_t dictionary_size,
+            std::optional<data_type> index_type
+        )
+        {
+            const data_type dt = index_type.value_or(smallest_index_type(dictionary_size));
+            arrow_proxy proxy = visit_index_type(
+                dt,
+                [&]<class IT>(std::type_identity<IT>) -> arrow_proxy
+                {
+                    if (dictionary_size > 0
+                        && dictionary_size - 1 > static_cast<std::size_t>(std::numeric_limits<IT>::max()))
+                    {
+                        throw std::length_error("dictionary size exceeds the capacity of the index type");
+                    }
+                    u8_buffer<IT> key_buffer(keys.size());
+                    IT* out = key_buffer.data();
+                    for (std::size_t i = 0; i < keys.size(); ++i)
+                    {
+                        out[i] = static_cast<IT>(keys[i]);
+                    }
+                    validity_bitmap bitmap(keys.size(), true);
+                    if (validity != nullptr)
+                    {
+                        const dynamic_bitset_view<const std::uint8_t> valid(validity, array_offset + keys.size());
+                        for (std::size_t i = 0; i < keys.size(); ++i)
+                        {
+                            if (!valid.test(array_offset + i))
+                            {
+                                bitmap.set(i, false);
+                            }
+                        }
+                    }
+                    primitive_array<IT> key_array(std::move(key_buffer), std::move(bitmap));
+                    return array_access::extract_arrow_proxy(std::move(key_array));
+                }
+            );
+            proxy.set_dictionary(
+                new ArrowArray(dictionary.extract_array()),
+                new ArrowSchema(dictionary.extract_schema())
+            );
+            return proxy;
+        }
+    }
+
+    template <class T>
+        requires(!std::same_as<T, bool>)
+    arrow_proxy dictionary_encode(const primitive_array<T>& ar, std::optional<data_type> index_type)
+    {
+        const T* values = ar.data();
+        const arrow_proxy& source = ar.get_arrow_proxy();
+        const std::uint8_t* validity = detail::validity_data(source);
+        const auto array_offset = static_cast<std::size_t>(source.offset());
+
+        std::vector<std::size_t> keys;
+        const detail::dictionary_hash_table table = detail::hash_encode(
+            ar.size(),
+            validity,
+            array_offset,
+            [values](std::size_t i)
+            {
+                return detail::mix_hash(detail::bits_of(values[i]));
+            },
+            [values](std::size_t i, std::size_t j)
+            {
+                return std::memcmp(values + i, values + j, sizeof(T)) == 0;
+            },
+            keys
+        );
+
+        const auto& representatives = table.representatives();
+        u8_buffer<T> dictionary_values(representatives.size());
+        T* out = dictionary_values.data();
+        for (std::size_t i = 0; i < representatives.size(); ++i)
+        {
+            out[i] = values[representatives[i]];
+        }
+        primitive_array<T> dictionary(std::move(dictionary_values));
+        return detail::make_dictionary_encoded_proxy(
+            keys,
+            validity,
+            array_offset,
+            detail::array_access::extract_arrow_proxy(std::move(dictionary)),
+            representatives.size(),
+            index_type
+        );
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    arrow_proxy
+    dictionary_encode(const variable_size_binary_array<T, CR, OT>& ar, std::optional<data_type> index_type)
+    {
+        using data_value_type = typename variable_size_binary_array<T, CR, OT>::data_value_type;
+        const auto bufs = detail::get_binary_buffers(ar);
+        const auto bytes = [&bufs](std::size_t i)
+        {
+            return std::string_view(reinterpret_cast<const char*>(bufs.value_data(i)), bufs.value_size(i));
+        };
+
+        std::vector<std::size_t> keys;
+        const detail::dictionary_hash_table table = detail::hash_encode(
+            bufs.size,
+            bufs.validity,
+            bufs.array_offset,
+            [&bytes](std::size_t i)
+            {
+                return detail::mix_hash(std::hash<std::string_view>{}(bytes(i)));
+            },
+            [&bytes](std::size_t i, std::size_t j)
+            {
+                return bytes(i) == bytes(j);
+            },
+            keys
+        );
+
+        const auto& representatives = table.representatives();
+        std::size_t total_size = 0;
+        for (const std::size_t i : representatives)
+        {
+            total_size += bufs.value_size(i);
+        }
+        variable_size_binary_array_builder<T, CR, OT> builder;
+        builder.reserve(representatives.size(), total_size);
+        for (const std::size_t i : representatives)
+        {
+            builder.push_back(
+                CR(reinterpret_cast<const data_value_type*>(bufs.value_data(i)), bufs.value_size(i))
+            );
+        }
+        return detail::make_dictionary_encoded_proxy(
+            keys,
+            bufs.validity,
+            bufs.array_offset,
+            detail::array_access::extract_arrow_proxy(builder.finish()),
+            representatives.size(),
+            index_type
+        );
+    }
+
+    template <class A, std::integral IT>
+    A decode(const dictionary_encoded_array<IT>& ar)
+    {
+        return typed_dictionary_view<IT, A>(ar).decode();
+    }
+}
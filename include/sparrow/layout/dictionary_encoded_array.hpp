@@ -103,6 +103,8 @@ namespace sparrow
         using iterator = functor_index_iterator<functor_type>;
         using const_iterator = functor_index_iterator<const_functor_type>;
 
+        using keys_layout = primitive_array<IT>;
+
         explicit dictionary_encoded_array(arrow_proxy);
 
         dictionary_encoded_array(const self_type&);
@@ -124,9 +126,14 @@ namespace sparrow
         const_iterator cbegin() const;
         const_iterator cend() const;
 
+        /// Returns the keys, i.e. the indices of the elements in the dictionary.
+        const keys_layout& keys() const;
+
+        /// Returns a non owning proxy over the dictionary.
+        arrow_proxy dictionary_proxy() const;
+
     private:
 
-        using keys_layout = primitive_array<IT>;
         using values_layout = cloning_ptr<array_wrapper>;
 
         const inner_value_type& dummy_inner_value() const;
@@ -221,7 +228,7 @@ namespace sparrow
         const auto index = m_keys_layout[i];
         if (index.has_value())
         {
-            return array_element(*p_values_layout, index.value());
+            return array_element(*p_values_layout, static_cast<std::size_t>(index.value()));
         }
         else
         {
@@ -265,6 +272,20 @@ namespace sparrow
         return const_iterator(const_functor_type(this), size());
     }
 
+    template <std::integral IT>
+    auto dictionary_encoded_array<IT>::keys() const -> const keys_layout&
+    {
+        return m_keys_layout;
+    }
+
+    template <std::integral IT>
+    arrow_proxy dictionary_encoded_array<IT>::dictionary_proxy() const
+    {
+        const auto& dictionary = m_proxy.dictionary();
+        SPARROW_ASSERT_TRUE(dictionary);
+        return arrow_proxy{&(dictionary->array()), &(dictionary->schema())};
+    }
+
     template <std::integral IT>
     auto dictionary_encoded_array<IT>::dummy_inner_value() const -> const inner_value_type&
     {
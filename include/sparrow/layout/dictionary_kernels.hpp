@@ -0,0 +1,245 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_dictionary_view.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+
+namespace sparrow
+{
+    /**
+     * Predicate kernels over dictionary encoded arrays that do not decode
+     * the elements: the predicate is evaluated once per dictionary entry
+     * into a lookup table, which is then gathered through the keys.
+     *
+     * Predicates return a bitmap with one bit per element of the array;
+     * elements with a null key or referring to a null dictionary entry never
+     * match. \c A is the type of the dictionary, as in typed_dictionary_view.
+     */
+
+    /**
+     * Maps \c entry_matches, a bitmap with one bit per dictionary entry,
+     * through the keys of \c ar. This allows to reuse kernels written for
+     * the type of the dictionary, e.g. starts_with on a string dictionary.
+     */
+    template <std::integral IT>
+    validity_bitmap gather_matches(const dictionary_encoded_array<IT>& ar, const validity_bitmap& entry_matches);
+
+    /// Elements whose value satisfies \c pred.
+    template <class A, std::integral IT, class P>
+    validity_bitmap dictionary_match(const dictionary_encoded_array<IT>& ar, P&& pred);
+
+    /// Elements equal to \c value.
+    template <class A, std::integral IT, class U>
+    validity_bitmap dictionary_equal(const dictionary_encoded_array<IT>& ar, const U& value);
+
+    /**
+     * Elements equal to one of \c values. The range of values is iterated
+     * once, so that single pass ranges are supported.
+     */
+    template <class A, std::integral IT, std::ranges::input_range R>
+    validity_bitmap dictionary_is_in(const dictionary_encoded_array<IT>& ar, R&& values);
+
+    /*************************************
+     * dictionary kernels implementation *
+     *************************************/
+
+    namespace detail
+    {
+        // Gathers lookup[key] for every element; lookup holds one byte per
+        // dictionary entry, 1 if the entry matches. Null keys may hold any
+        // value, they are read as key 0 and masked afterwards. Non-null keys
+        // out of the range of the dictionary throw std::out_of_range.
+        template <std::integral IT>
+        validity_bitmap gather_lookup(const typed_view<IT>& keys, const std::vector<std::uint8_t>& lookup)
+        {
+            const std::size_t size = keys.size();
+            validity_bitmap result(size, false);
+            if (lookup.empty() || size == 0)
+            {
+                return result;
+            }
+
+            const IT* key_data = keys.data();
+            const std::size_t lookup_size = lookup.size();
+            // Keys out of range, including negative ones, are marked with a
+            // value that is neither 0 nor 1.
+            constexpr std::uint8_t out_of_range = 2;
+            std::vector<std::uint8_t> matches(size);
+            // Flat byte gather that the compiler can vectorize.
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const auto key = static_cast<std::size_t>(key_data[i]);
+                matches[i] = key < lookup_size ? lookup[key] : out_of_range;
+            }
+            const validity_view& validity = keys.validity();
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (matches[i] != 0 && validity[i])
+                {
+                    if (matches[i] == out_of_range)
+                    {
+                        throw std::out_of_range("dictionary key out of range");
+                    }
+                    result.set(i, true);
+                }
+            }
+            return result;
+        }
+
+        // Conversion of the values looked for by dictionary_is_in to a
+        // sorted vector, so that the range of values is iterated once and
+        // each dictionary entry is then searched in O(log(values)).
+        template <class A>
+        struct is_in_values;
+
+        template <class T>
+        struct is_in_values<primitive_array<T>>
+        {
+            using value_type = T;
+
+            // Values that no entry can be equal to are skipped.
+            template <class V>
+            static std::optional<T> convert(const V& value)
+            {
+                const auto converted = static_cast<T>(value);
+                return converted == value ? std::optional<T>(converted) : std::nullopt;
+            }
+
+            static const T& key(const T& entry)
+            {
+                return entry;
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct is_in_values<variable_size_binary_array<T, CR, OT>>
+        {
+            using value_type = std::string;
+
+            template <class V>
+            static std::optional<std::string> convert(const V& value)
+            {
+                return std::string(key(value));
+            }
+
+            template <class V>
+            static std::string_view key(const V& value)
+            {
+                if constexpr (std::constructible_from<std::string_view, const V&>)
+                {
+                    return std::string_view(value);
+                }
+                else
+                {
+                    return std::string_view(
+                        reinterpret_cast<const char*>(std::ranges::data(value)),
+                        std::ranges::size(value)
+                    );
+                }
+            }
+        };
+
+        template <class A, std::ranges::input_range R>
+        std::vector<typename is_in_values<A>::value_type> sorted_is_in_values(R&& values)
+        {
+            std::vector<typename is_in_values<A>::value_type> res;
+            for (auto&& value : values)
+            {
+                if (auto converted = is_in_values<A>::convert(value))
+                {
+                    res.push_back(std::move(*converted));
+                }
+            }
+            std::sort(res.begin(), res.end());
+            res.erase(std::unique(res.begin(), res.end()), res.end());
+            return res;
+        }
+
+        template <class A, std::integral IT, class P>
+        std::vector<std::uint8_t> make_lookup(const typed_dictionary_view<IT, A>& view, P&& pred)
+        {
+            const auto& dictionary = view.dictionary();
+            std::vector<std::uint8_t> lookup(dictionary.size(), 0);
+            for (std::size_t i = 0; i < lookup.size(); ++i)
+            {
+                const auto entry = dictionary[i];
+                lookup[i] = static_cast<std::uint8_t>(entry.has_value() && pred(entry.get()));
+            }
+            return lookup;
+        }
+    }
+
+    template <std::integral IT>
+    validity_bitmap gather_matches(const dictionary_encoded_array<IT>& ar, const validity_bitmap& entry_matches)
+    {
+        std::vector<std::uint8_t> lookup(entry_matches.size());
+        for (std::size_t i = 0; i < lookup.size(); ++i)
+        {
+            lookup[i] = static_cast<std::uint8_t>(entry_matches.test(i));
+        }
+        return detail::gather_lookup(typed_view<IT>(ar.keys()), lookup);
+    }
+
+    template <class A, std::integral IT, class P>
+    validity_bitmap dictionary_match(const dictionary_encoded_array<IT>& ar, P&& pred)
+    {
+        const typed_dictionary_view<IT, A> view(ar);
+        return detail::gather_lookup(view.keys(), detail::make_lookup(view, std::forward<P>(pred)));
+    }
+
+    template <class A, std::integral IT, class U>
+    validity_bitmap dictionary_equal(const dictionary_encoded_array<IT>& ar, const U& value)
+    {
+        return dictionary_match<A>(
+            ar,
+            [&value](const auto& entry)
+            {
+                return entry == value;
+            }
+        );
+    }
+
+    template <class A, std::integral IT, std::ranges::input_range R>
+    validity_bitmap dictionary_is_in(const dictionary_encoded_array<IT>& ar, R&& values)
+    {
+        const auto sorted_values = detail::sorted_is_in_values<A>(std::forward<R>(values));
+        return dictionary_match<A>(
+            ar,
+            [&sorted_values](const auto& entry)
+            {
+                return std::binary_search(
+                    sorted_values.begin(),
+                    sorted_values.end(),
+                    detail::is_in_values<A>::key(entry)
+                );
+            }
+        );
+    }
+}
@@ -0,0 +1,518 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/borrowed_proxy.hpp"
+#include "sparrow/layout/dictionary_encode.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    namespace detail
+    {
+        template <class A>
+        struct unifier_storage;
+    }
+
+    /**
+     * Merges the dictionaries of a stream of dictionary encoded batches into
+     * a single master dictionary.
+     *
+     * Each call to unify adds the entries of a batch dictionary that are not
+     * yet in the master dictionary and returns a remap table: entry k of the
+     * table is the index in the master dictionary of entry k of the batch
+     * dictionary. transpose applies the table to the keys of the batch. The
+     * master dictionary only grows, so the keys transposed for earlier
+     * batches stay valid and all the batches of a stream share the buffers
+     * of the master dictionary.
+     *
+     * Null entries of the batch dictionaries are all mapped to a single null
+     * entry of the master dictionary.
+     *
+     * @tparam IT the type of the keys.
+     * @tparam A the type of the dictionaries, primitive_array<T> or
+     *         variable_size_binary_array<T, CR, OT>.
+     */
+    template <std::integral IT, class A>
+    class dictionary_unifier
+    {
+    public:
+
+        using key_type = IT;
+        using dictionary_type = A;
+        using remap_type = std::vector<IT>;
+        using size_type = std::size_t;
+
+        dictionary_unifier();
+
+        /// Number of entries of the master dictionary.
+        [[nodiscard]] size_type size() const noexcept;
+
+        /**
+         * Merges \c dictionary into the master dictionary and returns its
+         * remap table. Throws std::length_error if the master dictionary
+         * cannot be indexed with \c IT anymore.
+         */
+        remap_type unify(const dictionary_type& dictionary);
+
+        /// Merges the dictionary of \c batch into the master dictionary.
+        remap_type unify(const dictionary_encoded_array<IT>& batch);
+
+        /**
+         * Returns the keys of \c batch mapped through \c remap. Null keys
+         * stay null.
+         */
+        [[nodiscard]] static primitive_array<IT>
+        transpose(const dictionary_encoded_array<IT>& batch, const remap_type& remap);
+
+        /**
+         * Unifies the dictionary of \c batch and returns a sparrow owned
+         * proxy over its transposed keys. Its dictionary is the current
+         * master dictionary, whose buffers are shared with the unifier and
+         * with the other batches instead of being copied: it stays valid
+         * when the master dictionary grows. The unifier and the batches it
+         * returns must not be used concurrently from different threads.
+         */
+        [[nodiscard]] arrow_proxy unify_batch(const dictionary_encoded_array<IT>& batch);
+
+        /// Returns a copy of the master dictionary.
+        [[nodiscard]] dictionary_type dictionary() const;
+
+    private:
+
+        using storage_type = detail::unifier_storage<A>;
+
+        IT append_null();
+
+        // Throws if a new entry cannot be indexed with IT.
+        void check_capacity() const;
+
+        storage_type m_storage;
+        detail::dictionary_hash_table m_table;
+        size_type m_null_index = detail::dictionary_hash_table::npos;
+    };
+
+    /*************************************
+     * dictionary_unifier implementation *
+     *************************************/
+
+    namespace detail
+    {
+        // Buffers of the master dictionary: the validity bitmap followed by
+        // the buffers of the layout. They are shared with the dictionaries of
+        // the batches returned by unify_batch, which only read a prefix of
+        // them. Entries are only appended, and a buffer that is shared is
+        // replaced with a larger copy instead of being reallocated in place,
+        // so that the batches keep reading valid memory.
+        class unifier_buffers
+        {
+        public:
+
+            using buffer_type = buffer<std::uint8_t>;
+
+            explicit unifier_buffers(std::size_t count)
+                : m_buffers(count)
+            {
+                for (auto& b : m_buffers)
+                {
+                    b = std::make_shared<buffer_type>(min_capacity, std::uint8_t(0));
+                }
+            }
+
+            std::size_t count() const noexcept
+            {
+                return m_buffers.size();
+            }
+
+            std::uint8_t* data(std::size_t i)
+            {
+                return m_buffers[i]->data();
+            }
+
+            const std::uint8_t* data(std::size_t i) const
+            {
+                return m_buffers[i]->data();
+            }
+
+            // Makes the buffer i hold at least size bytes; new bytes are set
+            // to 0 and the capacity grows geometrically.
+            void reserve(std::size_t i, std::size_t size)
+            {
+                auto& current = m_buffers[i];
+                if (current->size() >= size)
+                {
+                    return;
+                }
+                const std::size_t new_size = std::max(size, 2 * current->size());
+                if (current.use_count() == 1)
+                {
+                    current->resize(new_size, std::uint8_t(0));
+                }
+                else
+                {
+                    auto grown = std::make_shared<buffer_type>(new_size, std::uint8_t(0));
+                    std::memcpy(grown->data(), current->data(), current->size());
+                    current = std::move(grown);
+                }
+            }
+
+            // Sets the bit i of the validity bitmap (the buffer 0) to valid.
+            void set_validity(std::size_t i, bool valid)
+            {
+                reserve(0, i / 8 + 1);
+                data(0)[i / 8] |= static_cast<std::uint8_t>(static_cast<unsigned>(valid) << (i % 8));
+            }
+
+            // Returns an object keeping the current buffers alive.
+            std::shared_ptr<const void> share() const
+            {
+                return std::make_shared<const std::vector<std::shared_ptr<buffer_type>>>(m_buffers);
+            }
+
+        private:
+
+            static constexpr std::size_t min_capacity = 64;
+
+            std::vector<std::shared_ptr<buffer_type>> m_buffers;
+        };
+
+        // Proxy over the first size entries of buffers, sharing their
+        // ownership.
+        template <class A>
+        arrow_proxy make_unifier_proxy(const unifier_buffers& buffers, std::size_t size, std::size_t null_count)
+        {
+            borrowed_proxy_parts parts;
+            parts.length = static_cast<std::int64_t>(size);
+            parts.null_count = static_cast<std::int64_t>(null_count);
+            parts.format = data_type_to_format(get_data_type_from_array<A>::get());
+            parts.flags = static_cast<std::int64_t>(ArrowFlag::NULLABLE);
+            for (std::size_t i = 0; i < buffers.count(); ++i)
+            {
+                parts.borrowed_buffers.push_back(buffers.data(i));
+            }
+            parts.owner = buffers.share();
+            return make_borrowed_proxy(std::move(parts));
+        }
+
+        template <class T>
+        struct unifier_storage<primitive_array<T>>
+        {
+            using array_type = primitive_array<T>;
+
+            unifier_buffers buffers{2};
+            std::size_t count = 0;
+            std::size_t null_count = 0;
+
+            std::size_t size() const noexcept
+            {
+                return count;
+            }
+
+            const T* values() const
+            {
+                return reinterpret_cast<const T*>(buffers.data(1));
+            }
+
+            static std::uint64_t hash(const T& value)
+            {
+                return mix_hash(bits_of(value));
+            }
+
+            bool equal(std::size_t entry, const T& value) const
+            {
+                return std::memcmp(values() + entry, &value, sizeof(T)) == 0;
+            }
+
+            void push_back(const T& value, bool valid)
+            {
+                buffers.reserve(1, (count + 1) * sizeof(T));
+                std::memcpy(buffers.data(1) + count * sizeof(T), &value, sizeof(T));
+                buffers.set_validity(count, valid);
+                null_count += static_cast<std::size_t>(!valid);
+                ++count;
+            }
+
+            void push_back(nullval_t)
+            {
+                push_back(T{}, false);
+            }
+
+            // Calls f(i, value) for every non-null entry of dictionary and
+            // g(i) for every null entry.
+            template <class F, class G>
+            static void for_each(const array_type& dictionary, F&& f, G&& g)
+            {
+                const T* data = dictionary.data();
+                for (std::size_t i = 0; i < dictionary.size(); ++i)
+                {
+                    if (dictionary.has_value(i))
+                    {
+                        f(i, data[i]);
+                    }
+                    else
+                    {
+                        g(i);
+                    }
+                }
+            }
+
+            arrow_proxy share() const
+            {
+                return make_unifier_proxy<array_type>(buffers, count, null_count);
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct unifier_storage<variable_size_binary_array<T, CR, OT>>
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+
+            unifier_buffers buffers{3};
+            std::size_t count = 0;
+            std::size_t null_count = 0;
+            std::size_t data_size = 0;
+
+            std::size_t size() const noexcept
+            {
+                return count;
+            }
+
+            std::size_t offset(std::size_t entry) const
+            {
+                OT value;
+                std::memcpy(&value, buffers.data(1) + entry * sizeof(OT), sizeof(OT));
+                return static_cast<std::size_t>(value);
+            }
+
+            std::string_view value(std::size_t entry) const
+            {
+                const std::size_t begin = offset(entry);
+                return std::string_view(reinterpret_cast<const char*>(buffers.data(2)) + begin, offset(entry + 1) - begin);
+            }
+
+            static std::uint64_t hash(std::string_view value)
+            {
+                return mix_hash(std::hash<std::string_view>{}(value));
+            }
+
+            bool equal(std::size_t entry, std::string_view value) const
+            {
+                return this->value(entry) == value;
+            }
+
+            void push_back(std::string_view value, bool valid)
+            {
+                if (value.size() > static_cast<std::size_t>(std::numeric_limits<OT>::max()) - data_size)
+                {
+                    throw std::length_error("variable size binary data exceeds the capacity of the offset type");
+                }
+                buffers.reserve(2, data_size + value.size());
+                if (!value.empty())
+                {
+                    std::memcpy(buffers.data(2) + data_size, value.data(), value.size());
+                }
+                data_size += value.size();
+                buffers.reserve(1, (count + 2) * sizeof(OT));
+                const auto end = static_cast<OT>(data_size);
+                std::memcpy(buffers.data(1) + (count + 1) * sizeof(OT), &end, sizeof(OT));
+                buffers.set_validity(count, valid);
+                null_count += static_cast<std::size_t>(!valid);
+                ++count;
+            }
+
+            void push_back(nullval_t)
+            {
+                push_back(std::string_view(), false);
+            }
+
+            template <class F, class G>
+            static void for_each(const array_type& dictionary, F&& f, G&& g)
+            {
+                const auto bufs = get_binary_buffers(dictionary);
+                for (std::size_t i = 0; i < bufs.size; ++i)
+                {
+                    if (dictionary.has_value(i))
+                    {
+                        f(i,
+                          std::string_view(reinterpret_cast<const char*>(bufs.value_data(i)), bufs.value_size(i)));
+                    }
+                    else
+                    {
+                        g(i);
+                    }
+                }
+            }
+
+            arrow_proxy share() const
+            {
+                return make_unifier_proxy<array_type>(buffers, count, null_count);
+            }
+        };
+    }
+
+    template <std::integral IT, class A>
+    dictionary_unifier<IT, A>::dictionary_unifier()
+        : m_table(0)
+    {
+    }
+
+    template <std::integral IT, class A>
+    auto dictionary_unifier<IT, A>::size() const noexcept -> size_type
+    {
+        return m_storage.size();
+    }
+
+    template <std::integral IT, class A>
+    auto dictionary_unifier<IT, A>::unify(const dictionary_type& dictionary) -> remap_type
+    {
+        remap_type remap(dictionary.size(), IT(0));
+        storage_type::for_each(
+            dictionary,
+            [this, &remap](std::size_t i, const auto& value)
+            {
+                const std::uint64_t hash = storage_type::hash(value);
+                const auto equal = [this, &value](std::size_t master_entry, std::size_t)
+                {
+                    return m_storage.equal(master_entry, value);
+                };
+                // The table stands for each master entry with its index in
+                // the storage, which differs from the index in the table
+                // once the null entry has been added.
+                std::size_t index = m_table.find(hash, 0, equal);
+                if (index == detail::dictionary_hash_table::npos)
+                {
+                    check_capacity();
+                    index = m_table.find_or_insert(hash, m_storage.size(), equal);
+                    m_storage.push_back(value, true);
+                }
+                remap[i] = static_cast<IT>(m_table.representatives()[index]);
+            },
+            [this, &remap](std::size_t i)
+            {
+                remap[i] = append_null();
+            }
+        );
+        return remap;
+    }
+
+    template <std::integral IT, class A>
+    auto dictionary_unifier<IT, A>::unify(const dictionary_encoded_array<IT>& batch) -> remap_type
+    {
+        arrow_proxy dictionary_proxy = batch.dictionary_proxy();
+        if (dictionary_proxy.data_type() != detail::get_data_type_from_array<A>::get())
+        {
+            throw std::runtime_error("The dictionary does not hold the requested array type");
+        }
+        return unify(dictionary_type(std::move(dictionary_proxy)));
+    }
+
+    template <std::integral IT, class A>
+    primitive_array<IT>
+    dictionary_unifier<IT, A>::transpose(const dictionary_encoded_array<IT>& batch, const remap_type& remap)
+    {
+        const typed_view<IT> keys(batch.keys());
+        const size_type n = keys.size();
+        const IT* key_data = keys.data();
+        u8_buffer<IT> result(n, IT(0));
+        IT* out = result.data();
+        if (!remap.empty())
+        {
+            if (keys.validity().all_valid())
+            {
+                // Flat gather that the compiler can vectorize.
+                for (size_type i = 0; i < n; ++i)
+                {
+                    SPARROW_ASSERT_TRUE(static_cast<size_type>(key_data[i]) < remap.size());
+                    out[i] = remap[static_cast<size_type>(key_data[i])];
+                }
+            }
+            else
+            {
+                // Null keys may hold any value, they are read as 0.
+                for (size_type i = 0; i < n; ++i)
+                {
+                    const auto key = static_cast<size_type>(key_data[i]);
+                    out[i] = remap[keys.has_value(i) ? key : 0];
+                }
+            }
+        }
+
+        return primitive_array<IT>(std::move(result), detail::copy_validity(keys.validity()));
+    }
+
+    template <std::integral IT, class A>
+    arrow_proxy dictionary_unifier<IT, A>::unify_batch(const dictionary_encoded_array<IT>& batch)
+    {
+        const remap_type remap = unify(batch);
+        arrow_proxy proxy = detail::array_access::extract_arrow_proxy(transpose(batch, remap));
+        arrow_proxy dictionary_proxy = m_storage.share();
+        proxy.set_dictionary(
+            new ArrowArray(dictionary_proxy.extract_array()),
+            new ArrowSchema(dictionary_proxy.extract_schema())
+        );
+        return proxy;
+    }
+
+    template <std::integral IT, class A>
+    auto dictionary_unifier<IT, A>::dictionary() const -> dictionary_type
+    {
+        // Copying the shared proxy copies its buffers.
+        const arrow_proxy shared = m_storage.share();
+        return dictionary_type(arrow_proxy(shared));
+    }
+
+    template <std::integral IT, class A>
+    IT dictionary_unifier<IT, A>::append_null()
+    {
+        if (m_null_index == detail::dictionary_hash_table::npos)
+        {
+            check_capacity();
+            m_null_index = m_storage.size();
+            m_storage.push_back(nullval);
+        }
+        return static_cast<IT>(m_null_index);
+    }
+
+    template <std::integral IT, class A>
+    void dictionary_unifier<IT, A>::check_capacity() const
+    {
+        // The next entry gets the index size().
+        if (m_storage.size() > static_cast<size_type>(std::numeric_limits<IT>::max()))
+        {
+            throw std::length_error("dictionary size exceeds the capacity of the index type");
+        }
+    }
+}
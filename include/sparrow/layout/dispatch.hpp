@@ -14,106 +14,188 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
 #include <type_traits>
 
 #include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/decimal_array.hpp"
 #include "sparrow/layout/null_array.hpp"
 #include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/fixed_size_binary_array.hpp"
 #include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/temporal_array.hpp"
 #include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
 #include "sparrow/layout/nested_value_types.hpp"
 #include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
 #include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/map_layout/map_array.hpp"
 #include "sparrow/layout/struct_layout/struct_array.hpp"
 #include "sparrow/layout/union_array.hpp"
 #include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/mp_utils.hpp"
 
 namespace sparrow
 {
     template <class F>
     using visit_result_t = std::invoke_result_t<F, null_array>;
 
+    /**
+     * Calls \c func with the concrete layout held by \c ar. The layout
+     * is found by indexing a dispatch table with the kind of the array,
+     * instead of branching on its data type at each call.
+     */
     template <class F>
-    visit_result_t<F> visit(F&& func, const array_wrapper& ar)
+    visit_result_t<F> visit(F&& func, const array_wrapper& ar);
+
+    /// Default number of elements passed to the functor by visit_batches.
+    inline constexpr std::size_t default_batch_size = 1024;
+
+    /**
+     * Resolves the concrete layout of \c ar once, and calls \c func on
+     * consecutive ranges of at most \c batch_size elements of that layout.
+     * Each range is a std::ranges::subrange of the layout's const iterators,
+     * so \c func is instantiated for the typed elements of the layout.
+     */
+    template <class F>
+    void visit_batches(F&& func, const array_wrapper& ar, std::size_t batch_size = default_batch_size);
+
+    namespace detail
     {
-        if (ar.is_dictionary())
+        // The index of a type in this list is the value of its array_kind.
+        using dispatched_array_types = mpl::typelist<
+            null_array,
+            primitive_array<bool>,
+            primitive_array<std::uint8_t>,
+            primitive_array<std::int8_t>,
+            primitive_array<std::uint16_t>,
+            primitive_array<std::int16_t>,
+            primitive_array<std::uint32_t>,
+            primitive_array<std::int32_t>,
+            primitive_array<std::uint64_t>,
+            primitive_array<std::int64_t>,
+            primitive_array<float16_t>,
+            primitive_array<float32_t>,
+            primitive_array<float64_t>,
+            decimal128_array,
+            decimal256_array,
+            date_days_array,
+            date_milliseconds_array,
+            time_seconds_array,
+            time_milliseconds_array,
+            time_microseconds_array,
+            time_nanoseconds_array,
+            timestamp_seconds_array,
+            timestamp_milliseconds_array,
+            timestamp_microseconds_array,
+            timestamp_nanoseconds_array,
+            duration_seconds_array,
+            duration_milliseconds_array,
+            duration_microseconds_array,
+            duration_nanoseconds_array,
+            string_array,
+            big_string_array,
+            string_view_array,
+            binary_array,
+            big_binary_array,
+            binary_view_array,
+            fixed_size_binary_array,
+            run_end_encoded_array,
+            list_array,
+            big_list_array,
+            list_view_array,
+            big_list_view_array,
+            fixed_sized_list_array,
+            map_array,
+            struct_array,
+            dense_union_array,
+            sparse_union_array,
+            dictionary_encoded_array<std::uint8_t>,
+            dictionary_encoded_array<std::int8_t>,
+            dictionary_encoded_array<std::uint16_t>,
+            dictionary_encoded_array<std::int16_t>,
+            dictionary_encoded_array<std::uint32_t>,
+            dictionary_encoded_array<std::int32_t>,
+            dictionary_encoded_array<std::uint64_t>,
+            dictionary_encoded_array<std::int64_t>>;
+
+        template <class T>
+        constexpr array_kind array_kind_of()
         {
-            switch(ar.data_type())
-            {
-            case data_type::UINT8:
-                return func(unwrap_array<dictionary_encoded_array<std::uint8_t>>(ar));
-            case data_type::INT8:
-                return func(unwrap_array<dictionary_encoded_array<std::int8_t>>(ar));
-            case data_type::UINT16:
-                return func(unwrap_array<dictionary_encoded_array<std::uint16_t>>(ar));
-            case data_type::INT16:
-                return func(unwrap_array<dictionary_encoded_array<std::int16_t>>(ar));
-            case data_type::UINT32:
-                return func(unwrap_array<dictionary_encoded_array<std::uint32_t>>(ar));
-            case data_type::INT32:
-                return func(unwrap_array<dictionary_encoded_array<std::int32_t>>(ar));
-            case data_type::UINT64:
-                return func(unwrap_array<dictionary_encoded_array<std::uint64_t>>(ar));
-            case data_type::INT64:
-                return func(unwrap_array<dictionary_encoded_array<std::int64_t>>(ar));
-            default:
-                throw std::runtime_error("data datype of dictionary encoded array must be an integer");
-            }
+            return get_array_kind(get_data_type_from_array<T>::get(), is_dictionary_encoded_array<T>::get());
+        }
+
+        template <class... T>
+        consteval bool check_dispatched_array_types(mpl::typelist<T...>)
+        {
+            std::size_t index = 0;
+            return sizeof...(T) == array_kind_count()
+                   && ((static_cast<std::size_t>(array_kind_of<T>()) == index++) && ...);
         }
-        else
+
+        static_assert(
+            check_dispatched_array_types(dispatched_array_types{}),
+            "dispatched_array_types must list one layout per array_kind, in the order of array_kind"
+        );
+
+        template <class F>
+        using visit_function_t = visit_result_t<F> (*)(F&, const array_wrapper&);
+
+        template <class F, class T>
+        visit_result_t<F> visit_thunk(F& func, const array_wrapper& ar)
         {
-            switch(ar.data_type())
-            {
-            case data_type::NA:
-                return func(unwrap_array<null_array>(ar));;
-            case data_type::BOOL:
-                return func(unwrap_array<primitive_array<bool>>(ar));
-            case data_type::UINT8:
-                return func(unwrap_array<primitive_array<std::uint8_t>>(ar));
-            case data_type::INT8:
-                return func(unwrap_array<primitive_array<std::int8_t>>(ar));
-            case data_type::UINT16:
-                return func(unwrap_array<primitive_array<std::uint16_t>>(ar));
-            case data_type::INT16:
-                return func(unwrap_array<primitive_array<std::int16_t>>(ar));
-            case data_type::UINT32:
-                return func(unwrap_array<primitive_array<std::uint32_t>>(ar));
-            case data_type::INT32:
-                return func(unwrap_array<primitive_array<std::int32_t>>(ar));
-            case data_type::UINT64:
-                return func(unwrap_array<primitive_array<std::uint64_t>>(ar));
-            case data_type::INT64:
-                return func(unwrap_array<primitive_array<std::int64_t>>(ar));
-            case data_type::HALF_FLOAT:
-                return func(unwrap_array<primitive_array<float16_t>>(ar));
-            case data_type::FLOAT:
-                return func(unwrap_array<primitive_array<float32_t>>(ar));
-            case data_type::DOUBLE:
-                return func(unwrap_array<primitive_array<float64_t>>(ar));
-            case data_type::STRING:
-                return func(unwrap_array<variable_size_binary_array<std::string, std::string_view>>(ar));
-            case data_type::RUN_ENCODED:
-                return func(unwrap_array<run_end_encoded_array>(ar));
-            case data_type::LIST:
-                return func(unwrap_array<list_array>(ar));
-            case data_type::LARGE_LIST:
-                return func(unwrap_array<big_list_array>(ar));
-            case data_type::LIST_VIEW:
-                return func(unwrap_array<list_view_array>(ar));
-            case data_type::LARGE_LIST_VIEW:
-                return func(unwrap_array<big_list_view_array>(ar));
-            case data_type::FIXED_SIZED_LIST:
-                return func(unwrap_array<fixed_sized_list_array>(ar));
-            case data_type::STRUCT:
-                return func(unwrap_array<struct_array>(ar));
-            case data_type::DENSE_UNION:
-                return func(unwrap_array<dense_union_array>(ar));
-            case data_type::SPARSE_UNION:
-                return func(unwrap_array<sparse_union_array>(ar));
-            default:
-                throw std::invalid_argument("array type not supported");
-            }
+            return func(unwrap_array<T>(ar));
+        }
+
+        template <class F, class... T>
+        constexpr auto make_visit_table(mpl::typelist<T...>)
+        {
+            return std::array<visit_function_t<F>, sizeof...(T)>{&visit_thunk<F, T>...};
         }
+
+        template <class F>
+        inline constexpr auto visit_table = make_visit_table<F>(dispatched_array_types{});
+    }
+
+    /************************
+     * visit implementation *
+     ************************/
+
+    template <class F>
+    visit_result_t<F> visit(F&& func, const array_wrapper& ar)
+    {
+        const auto index = static_cast<std::size_t>(ar.kind());
+        if (index >= array_kind_count())
+        {
+            throw std::invalid_argument("array type not supported");
+        }
+        return detail::visit_table<std::remove_reference_t<F>>[index](func, ar);
     }
-}
 
+    template <class F>
+    void visit_batches(F&& func, const array_wrapper& ar, std::size_t batch_size)
+    {
+        SPARROW_ASSERT_TRUE(batch_size > 0);
+        visit(
+            [&func, batch_size](const auto& typed_array)
+            {
+                auto first = typed_array.cbegin();
+                std::size_t remaining = typed_array.size();
+                while (remaining != 0)
+                {
+                    const std::size_t count = std::min(remaining, batch_size);
+                    auto last = std::next(first, static_cast<std::ptrdiff_t>(count));
+                    func(std::ranges::subrange(first, last));
+                    first = last;
+                    remaining -= count;
+                }
+            },
+            ar
+        );
+    }
+}
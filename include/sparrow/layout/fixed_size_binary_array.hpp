@@ -0,0 +1,319 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_bitmap_base.hpp"
+#include "sparrow/layout/layout_utils.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
+#include "sparrow/utils/mp_utils.hpp"
+#include "sparrow/utils/nullable.hpp"
+
+namespace sparrow
+{
+    class fixed_size_binary_array;
+
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+
+        template <>
+        struct get_data_type_from_array<sparrow::fixed_size_binary_array>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return data_type::FIXED_WIDTH_BINARY;
+            }
+        };
+
+        /// Number of bytes of the values of type V if it is known at compile time,
+        /// std::dynamic_extent otherwise.
+        template <class V>
+        constexpr std::size_t static_byte_width()
+        {
+            if constexpr (requires { std::tuple_size<V>::value; })
+            {
+                return std::tuple_size_v<V>;
+            }
+            else if constexpr (requires { V::extent; })
+            {
+                return V::extent;
+            }
+            else
+            {
+                return std::dynamic_extent;
+            }
+        }
+    }
+
+    template <>
+    struct array_inner_types<fixed_size_binary_array> : array_inner_types_base
+    {
+        using array_type = fixed_size_binary_array;
+
+        using inner_value_type = std::vector<byte_t>;
+        using inner_reference = binary_span;
+        using inner_const_reference = binary_span;
+
+        using const_value_iterator = functor_index_iterator<
+            detail::layout_value_functor<const array_type, inner_const_reference>>;
+        using iterator_tag = std::random_access_iterator_tag;
+    };
+
+    /**
+     * Array of binary values of the same size (the Arrow Fixed-size binary
+     * layout, "w:N"), e.g. UUIDs, IPv6 addresses or SHA-256 digests.
+     *
+     * The data buffer holds the values back to back, without offsets; the
+     * width is read once from the format. Elements are binary_span views
+     * over the data buffer; value_as<N> gives spans of static extent when
+     * the width is known at compile time. Equality, comparison and hash
+     * kernels are declared in fixed_size_binary_kernels.hpp.
+     */
+    class fixed_size_binary_array final : public array_bitmap_base<fixed_size_binary_array>
+    {
+    public:
+
+        using self_type = fixed_size_binary_array;
+        using base_type = array_bitmap_base<self_type>;
+        using inner_types = array_inner_types<self_type>;
+        using inner_value_type = inner_types::inner_value_type;
+        using inner_reference = inner_types::inner_reference;
+        using inner_const_reference = inner_types::inner_const_reference;
+        using bitmap_type = base_type::bitmap_type;
+        using bitmap_const_reference = base_type::bitmap_const_reference;
+        using value_type = nullable<inner_value_type>;
+        using const_reference = nullable<inner_const_reference, bitmap_const_reference>;
+        using size_type = base_type::size_type;
+        using difference_type = base_type::difference_type;
+        using iterator_tag = base_type::iterator_tag;
+
+        using const_bitmap_range = base_type::const_bitmap_range;
+        using const_value_iterator = inner_types::const_value_iterator;
+
+        explicit fixed_size_binary_array(arrow_proxy);
+
+        template <class... Args>
+            requires(mpl::excludes_copy_and_move_ctor_v<fixed_size_binary_array, Args...>)
+        fixed_size_binary_array(Args&&... args)
+            : fixed_size_binary_array(create_proxy(std::forward<Args>(args)...))
+        {
+        }
+
+        using base_type::get_arrow_proxy;
+        using base_type::size;
+
+        /// Number of bytes of each element.
+        [[nodiscard]] size_type width() const;
+
+        /// Bytes of the elements, including the null ones, back to back.
+        [[nodiscard]] const byte_t* data() const;
+
+        /**
+         * Bytes of the element at index i, null or not, as a span of static
+         * extent. N must be the width of the array.
+         */
+        template <std::size_t N>
+        [[nodiscard]] std::span<const byte_t, N> value_as(size_type i) const;
+
+    private:
+
+        /**
+         * Builds an array from the bytes of its elements, back to back. The
+         * size of data_buffer must be a multiple of width, and width must
+         * not be 0 since the number of elements could not be deduced; arrays
+         * of zero-width values are built from a range of empty values.
+         */
+        template <validity_bitmap_input VB = validity_bitmap>
+        static arrow_proxy
+        create_proxy(u8_buffer<byte_t>&& data_buffer, std::size_t width, VB&& validity_input = validity_bitmap{});
+
+        /**
+         * Builds an array from a range of binary values, e.g. a vector of
+         * std::array<std::byte, 16>.
+         *
+         * @throws std::invalid_argument if the values have different sizes,
+         *         or if the range is empty and the width is not known at
+         *         compile time.
+         */
+        template <std::ranges::input_range R, validity_bitmap_input VB = validity_bitmap>
+            requires std::ranges::sized_range<std::ranges::range_value_t<R>>
+                     && std::same_as<std::ranges::range_value_t<std::ranges::range_value_t<R>>, byte_t>
+        static arrow_proxy create_proxy(R&& values, VB&& validity_input = validity_bitmap{});
+
+        template <validity_bitmap_input VB>
+        static arrow_proxy
+        create_proxy_impl(u8_buffer<byte_t>&& data_buffer, std::size_t width, std::size_t size, VB&& validity_input);
+
+        inner_const_reference value(size_type i) const;
+
+        const_value_iterator value_cbegin() const;
+        const_value_iterator value_cend() const;
+
+        static constexpr size_type DATA_BUFFER_INDEX = 1;
+
+        size_type m_width = 0;
+
+        friend class array_crtp_base<self_type>;
+        friend class detail::layout_value_functor<const self_type, inner_const_reference>;
+    };
+
+    /******************************************
+     * fixed_size_binary_array implementation *
+     ******************************************/
+
+    inline fixed_size_binary_array::fixed_size_binary_array(arrow_proxy proxy)
+        : base_type(std::move(proxy))
+    {
+        SPARROW_ASSERT_TRUE(get_arrow_proxy().data_type() == data_type::FIXED_WIDTH_BINARY);
+        const auto width = parse_fixed_width_binary_format(get_arrow_proxy().format());
+        SPARROW_ASSERT_TRUE(width.has_value());
+        m_width = *width;
+    }
+
+    inline auto fixed_size_binary_array::width() const -> size_type
+    {
+        return m_width;
+    }
+
+    inline const byte_t* fixed_size_binary_array::data() const
+    {
+        return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].data<const byte_t>()
+               + static_cast<size_type>(get_arrow_proxy().offset()) * m_width;
+    }
+
+    template <std::size_t N>
+    std::span<const byte_t, N> fixed_size_binary_array::value_as(size_type i) const
+    {
+        SPARROW_ASSERT_TRUE(N == m_width);
+        SPARROW_ASSERT_TRUE(i < size());
+        return std::span<const byte_t, N>(data() + i * N, N);
+    }
+
+    template <validity_bitmap_input VB>
+    arrow_proxy fixed_size_binary_array::create_proxy(
+        u8_buffer<byte_t>&& data_buffer,
+        std::size_t width,
+        VB&& validity_input
+    )
+    {
+        SPARROW_ASSERT_TRUE(width > 0 && data_buffer.size() % width == 0);
+        const auto size = data_buffer.size() / width;
+        return create_proxy_impl(std::move(data_buffer), width, size, std::forward<VB>(validity_input));
+    }
+
+    template <validity_bitmap_input VB>
+    arrow_proxy fixed_size_binary_array::create_proxy_impl(
+        u8_buffer<byte_t>&& data_buffer,
+        std::size_t width,
+        std::size_t size,
+        VB&& validity_input
+    )
+    {
+        validity_bitmap bitmap = ensure_validity_bitmap(size, std::forward<VB>(validity_input));
+        const auto null_count = bitmap.null_count();
+
+        ArrowSchema schema = make_arrow_schema(
+            "w:" + std::to_string(width),
+            std::nullopt,  // name
+            std::nullopt,  // metadata
+            std::nullopt,  // flags
+            0,             // n_children
+            nullptr,       // children
+            nullptr        // dictionary
+        );
+
+        std::vector<buffer<std::uint8_t>> buffers(2);
+        buffers[0] = std::move(bitmap).extract_storage();
+        buffers[1] = std::move(data_buffer).extract_storage();
+
+        ArrowArray arr = make_arrow_array(
+            static_cast<std::int64_t>(size),  // length
+            static_cast<std::int64_t>(null_count),
+            0,  // offset
+            std::move(buffers),
+            0,        // n_children
+            nullptr,  // children
+            nullptr   // dictionary
+        );
+        return arrow_proxy(std::move(arr), std::move(schema));
+    }
+
+    template <std::ranges::input_range R, validity_bitmap_input VB>
+        requires std::ranges::sized_range<std::ranges::range_value_t<R>>
+                 && std::same_as<std::ranges::range_value_t<std::ranges::range_value_t<R>>, byte_t>
+    arrow_proxy fixed_size_binary_array::create_proxy(R&& values, VB&& validity_input)
+    {
+        std::size_t width = detail::static_byte_width<std::ranges::range_value_t<R>>();
+        std::vector<byte_t> bytes;
+        std::size_t size = 0;
+        for (const auto& v : values)
+        {
+            const auto value_size = static_cast<std::size_t>(std::ranges::size(v));
+            if (width == std::dynamic_extent)
+            {
+                width = value_size;
+            }
+            if (value_size != width)
+            {
+                throw std::invalid_argument("the values of a fixed-size binary array must have the same size");
+            }
+            bytes.insert(bytes.end(), std::ranges::begin(v), std::ranges::end(v));
+            ++size;
+        }
+        if (width == std::dynamic_extent)
+        {
+            throw std::invalid_argument("cannot deduce the width of an empty range of binary values");
+        }
+        return create_proxy_impl(u8_buffer<byte_t>(std::move(bytes)), width, size, std::forward<VB>(validity_input));
+    }
+
+    inline auto fixed_size_binary_array::value(size_type i) const -> inner_const_reference
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return inner_const_reference(data() + i * m_width, m_width);
+    }
+
+    inline auto fixed_size_binary_array::value_cbegin() const -> const_value_iterator
+    {
+        return const_value_iterator(detail::layout_value_functor<const self_type, inner_const_reference>(this), 0);
+    }
+
+    inline auto fixed_size_binary_array::value_cend() const -> const_value_iterator
+    {
+        return const_value_iterator(
+            detail::layout_value_functor<const self_type, inner_const_reference>(this),
+            this->size()
+        );
+    }
+}
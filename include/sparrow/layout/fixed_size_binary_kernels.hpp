@@ -0,0 +1,361 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/fixed_size_binary_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+
+namespace sparrow
+{
+    /**
+     * Kernels over fixed-size binary arrays, working on the data buffer
+     * directly. Values are read as 8-byte words; the 16 and 32-byte widths
+     * (UUIDs, IPv6 addresses, SHA-256 digests) have dedicated loops where
+     * the width is a compile-time constant, so that the compiler unrolls
+     * and vectorizes them.
+     */
+
+    /**
+     * Comparison predicates: the bit i of the result is set if neither
+     * operand is null at i and the comparison holds. Values are ordered
+     * lexicographically by unsigned bytes, as std::memcmp does.
+     *
+     * @throws std::invalid_argument if the operands have different sizes
+     *         or widths.
+     */
+
+    [[nodiscard]] validity_bitmap
+    fixed_size_binary_equal(const fixed_size_binary_array& lhs, const fixed_size_binary_array& rhs);
+
+    template <std::ranges::contiguous_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, byte_t>
+    [[nodiscard]] validity_bitmap fixed_size_binary_equal(const fixed_size_binary_array& ar, const R& value);
+
+    [[nodiscard]] validity_bitmap
+    fixed_size_binary_less(const fixed_size_binary_array& lhs, const fixed_size_binary_array& rhs);
+
+    template <std::ranges::contiguous_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, byte_t>
+    [[nodiscard]] validity_bitmap fixed_size_binary_less(const fixed_size_binary_array& ar, const R& value);
+
+    /**
+     * 64-bit hash of each element, null for the null elements. Equal values
+     * have equal hashes for a given seed; hashes depend on the byte order
+     * of the platform and are not meant to be persisted.
+     */
+    [[nodiscard]] primitive_array<std::uint64_t>
+    fixed_size_binary_hash(const fixed_size_binary_array& ar, std::uint64_t seed = 0);
+
+    /********************************************
+     * fixed_size_binary kernels implementation *
+     ********************************************/
+
+    namespace detail
+    {
+        inline void check_same_shape(const fixed_size_binary_array& lhs, const fixed_size_binary_array& rhs)
+        {
+            if (lhs.size() != rhs.size() || lhs.width() != rhs.width())
+            {
+                throw std::invalid_argument(
+                    "the operands of a fixed-size binary kernel must have the same size and width"
+                );
+            }
+        }
+
+        inline void check_same_width(const fixed_size_binary_array& ar, std::span<const byte_t> value)
+        {
+            if (ar.width() != value.size())
+            {
+                throw std::invalid_argument("the value must have the width of the fixed-size binary array");
+            }
+        }
+
+        // Loads the 8 bytes at p, whatever their alignment.
+        inline std::uint64_t load_word(const byte_t* p)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            return word;
+        }
+
+        // W is the width when it is a compile-time constant, 0 otherwise.
+        template <std::size_t W>
+        bool binary_equal(const byte_t* a, const byte_t* b, std::size_t width)
+        {
+            if constexpr (W == 0)
+            {
+                // The data of a zero-width array may be null.
+                return width == 0 || std::memcmp(a, b, width) == 0;
+            }
+            else
+            {
+                static_assert(W % sizeof(std::uint64_t) == 0);
+                std::uint64_t diff = 0;
+                for (std::size_t k = 0; k < W; k += sizeof(std::uint64_t))
+                {
+                    diff |= load_word(a + k) ^ load_word(b + k);
+                }
+                return diff == 0;
+            }
+        }
+
+        template <std::size_t W>
+        bool binary_less(const byte_t* a, const byte_t* b, std::size_t width)
+        {
+            if constexpr (W == 0)
+            {
+                return width != 0 && std::memcmp(a, b, width) < 0;
+            }
+            else
+            {
+                return std::memcmp(a, b, W) < 0;
+            }
+        }
+
+        // Calls f with the width as an integral constant if it is one of the
+        // fast widths, with 0 otherwise.
+        template <class F>
+        decltype(auto) dispatch_binary_width(std::size_t width, F&& f)
+        {
+            switch (width)
+            {
+                case 16:
+                    return f(std::integral_constant<std::size_t, 16>{});
+                case 32:
+                    return f(std::integral_constant<std::size_t, 32>{});
+                default:
+                    return f(std::integral_constant<std::size_t, 0>{});
+            }
+        }
+
+        // Sets bit i of the result if both operands are valid at i and
+        // pred(lhs[i], rhs[i]) holds. W is the width of the operands if it
+        // is a compile-time constant, 0 otherwise.
+        template <std::size_t W, class P>
+        validity_bitmap
+        binary_compare(const fixed_size_binary_array& lhs, const fixed_size_binary_array& rhs, P pred)
+        {
+            check_same_shape(lhs, rhs);
+            const std::size_t n = lhs.size();
+            const std::size_t width = W == 0 ? lhs.width() : W;
+            const validity_bitmap validity = and_validity(
+                make_validity_view(lhs.get_arrow_proxy()),
+                make_validity_view(rhs.get_arrow_proxy())
+            );
+            const byte_t* a = lhs.data();
+            const byte_t* b = rhs.data();
+            // Flat byte loop without branches, the bits are set afterwards.
+            std::vector<std::uint8_t> matches(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                matches[i] = static_cast<std::uint8_t>(pred(a + i * width, b + i * width));
+            }
+            validity_bitmap result(n, false);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (matches[i] != 0 && validity.test(i))
+                {
+                    result.set(i, true);
+                }
+            }
+            return result;
+        }
+
+        // Sets bit i of the result if ar is valid at i and pred(ar[i], value)
+        // holds.
+        template <std::size_t W, class P>
+        validity_bitmap binary_compare(const fixed_size_binary_array& ar, std::span<const byte_t> value, P pred)
+        {
+            check_same_width(ar, value);
+            const std::size_t n = ar.size();
+            const std::size_t width = W == 0 ? ar.width() : W;
+            const validity_view validity = make_validity_view(ar.get_arrow_proxy());
+            const byte_t* data = ar.data();
+            std::vector<std::uint8_t> matches(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                matches[i] = static_cast<std::uint8_t>(pred(data + i * width, value.data()));
+            }
+            validity_bitmap result(n, false);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (matches[i] != 0 && validity[i])
+                {
+                    result.set(i, true);
+                }
+            }
+            return result;
+        }
+
+        inline std::uint64_t hash_mix(std::uint64_t h, std::uint64_t word)
+        {
+            h ^= word;
+            h *= 0x9e3779b97f4a7c15ull;
+            return h ^ (h >> 32);
+        }
+
+        // Final avalanche of MurmurHash3.
+        inline std::uint64_t hash_finalize(std::uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        template <std::size_t W>
+        std::uint64_t hash_binary(const byte_t* p, std::size_t width, std::uint64_t seed)
+        {
+            const std::size_t n = W == 0 ? width : W;
+            std::uint64_t h = hash_mix(seed, n);
+            std::size_t k = 0;
+            for (; k + sizeof(std::uint64_t) <= n; k += sizeof(std::uint64_t))
+            {
+                h = hash_mix(h, load_word(p + k));
+            }
+            if (k < n)
+            {
+                std::uint64_t tail = 0;
+                std::memcpy(&tail, p + k, n - k);
+                h = hash_mix(h, tail);
+            }
+            return hash_finalize(h);
+        }
+    }
+
+    inline validity_bitmap
+    fixed_size_binary_equal(const fixed_size_binary_array& lhs, const fixed_size_binary_array& rhs)
+    {
+        const std::size_t width = lhs.width();
+        return detail::dispatch_binary_width(
+            width,
+            [&](auto w)
+            {
+                return detail::binary_compare<decltype(w)::value>(
+                    lhs,
+                    rhs,
+                    [width](const byte_t* a, const byte_t* b)
+                    {
+                        return detail::binary_equal<decltype(w)::value>(a, b, width);
+                    }
+                );
+            }
+        );
+    }
+
+    template <std::ranges::contiguous_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, byte_t>
+    validity_bitmap fixed_size_binary_equal(const fixed_size_binary_array& ar, const R& value)
+    {
+        const std::span<const byte_t> bytes(std::ranges::data(value), std::ranges::size(value));
+        const std::size_t width = ar.width();
+        return detail::dispatch_binary_width(
+            width,
+            [&](auto w)
+            {
+                return detail::binary_compare<decltype(w)::value>(
+                    ar,
+                    bytes,
+                    [width](const byte_t* a, const byte_t* b)
+                    {
+                        return detail::binary_equal<decltype(w)::value>(a, b, width);
+                    }
+                );
+            }
+        );
+    }
+
+    inline validity_bitmap
+    fixed_size_binary_less(const fixed_size_binary_array& lhs, const fixed_size_binary_array& rhs)
+    {
+        const std::size_t width = lhs.width();
+        return detail::dispatch_binary_width(
+            width,
+            [&](auto w)
+            {
+                return detail::binary_compare<decltype(w)::value>(
+                    lhs,
+                    rhs,
+                    [width](const byte_t* a, const byte_t* b)
+                    {
+                        return detail::binary_less<decltype(w)::value>(a, b, width);
+                    }
+                );
+            }
+        );
+    }
+
+    template <std::ranges::contiguous_range R>
+        requires std::same_as<std::ranges::range_value_t<R>, byte_t>
+    validity_bitmap fixed_size_binary_less(const fixed_size_binary_array& ar, const R& value)
+    {
+        const std::span<const byte_t> bytes(std::ranges::data(value), std::ranges::size(value));
+        const std::size_t width = ar.width();
+        return detail::dispatch_binary_width(
+            width,
+            [&](auto w)
+            {
+                return detail::binary_compare<decltype(w)::value>(
+                    ar,
+                    bytes,
+                    [width](const byte_t* a, const byte_t* b)
+                    {
+                        return detail::binary_less<decltype(w)::value>(a, b, width);
+                    }
+                );
+            }
+        );
+    }
+
+    inline primitive_array<std::uint64_t>
+    fixed_size_binary_hash(const fixed_size_binary_array& ar, std::uint64_t seed)
+    {
+        const std::size_t n = ar.size();
+        const std::size_t width = ar.width();
+        const byte_t* data = ar.data();
+        u8_buffer<std::uint64_t> result(n);
+        std::uint64_t* out = result.data();
+        detail::dispatch_binary_width(
+            width,
+            [&](auto w)
+            {
+                constexpr std::size_t W = decltype(w)::value;
+                const std::size_t stride = W == 0 ? width : W;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    out[i] = detail::hash_binary<W>(data + i * stride, width, seed);
+                }
+            }
+        );
+        return primitive_array<std::uint64_t>(
+            std::move(result),
+            detail::copy_validity(detail::make_validity_view(ar.get_arrow_proxy()))
+        );
+    }
+}
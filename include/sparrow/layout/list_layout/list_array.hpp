@@ -15,6 +15,7 @@
 #pragma once
 
 #include <string>  // for std::stoull
+#include <utility>
 
 
 #include "sparrow/arrow_interface/arrow_array.hpp"
@@ -54,6 +55,39 @@ namespace sparrow
 
     class fixed_sized_list_array;
 
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+
+        template <bool BIG>
+        struct get_data_type_from_array<sparrow::list_array_impl<BIG>>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return BIG ? sparrow::data_type::LARGE_LIST : sparrow::data_type::LIST;
+            }
+        };
+
+        template <bool BIG>
+        struct get_data_type_from_array<sparrow::list_view_array_impl<BIG>>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return BIG ? sparrow::data_type::LARGE_LIST_VIEW : sparrow::data_type::LIST_VIEW;
+            }
+        };
+
+        template <>
+        struct get_data_type_from_array<sparrow::fixed_sized_list_array>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return sparrow::data_type::FIXED_SIZED_LIST;
+            }
+        };
+    }
+
     template <bool BIG>
     struct array_inner_types<list_array_impl<BIG>> : array_inner_types_base
     {
@@ -133,9 +167,18 @@ namespace sparrow
         using const_reference = nullable<inner_const_reference, bitmap_const_reference>;
         using iterator_tag = typename base_type::iterator_tag;
 
+        using base_type::get_arrow_proxy;
+
         const array_wrapper* raw_flat_array() const;
         array_wrapper* raw_flat_array();
 
+        /**
+         * Range [first, last) of the flat array holding the elements
+         * of the list at index i. The range of a null list may be
+         * non-empty.
+         */
+        std::pair<size_type, size_type> value_range(size_type i) const;
+
     protected:
 
         explicit list_array_crtp_base(arrow_proxy proxy);
@@ -311,6 +354,8 @@ namespace sparrow
         fixed_sized_list_array(self_type&&) = default;
         fixed_sized_list_array& operator=(self_type&&) = default;
 
+        uint64_t list_size() const;
+
         template<class ...ARGS>
         requires(mpl::excludes_copy_and_move_ctor_v<fixed_sized_list_array, ARGS...>)
         fixed_sized_list_array(ARGS&& ...args): self_type(create_proxy(std::forward<ARGS>(args)...))
@@ -368,6 +413,14 @@ namespace sparrow
         return p_flat_array.get();
     }
 
+    template <class DERIVED>
+    auto list_array_crtp_base<DERIVED>::value_range(size_type i) const -> std::pair<size_type, size_type>
+    {
+        SPARROW_ASSERT_TRUE(i < this->size());
+        const auto r = this->derived_cast().offset_range(i);
+        return std::make_pair(static_cast<size_type>(r.first), static_cast<size_type>(r.second));
+    }
+
     template <class DERIVED>
     auto list_array_crtp_base<DERIVED>::value_begin() -> value_iterator
     {
@@ -466,9 +519,8 @@ namespace sparrow
     template <bool BIG>
     auto list_array_impl<BIG>::make_list_offsets() -> offset_type*
     {
-        return reinterpret_cast<offset_type*>(
-              this->get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].data() + this->get_arrow_proxy().offset()
-        );
+        return reinterpret_cast<offset_type*>(this->get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].data())
+               + this->get_arrow_proxy().offset();
     }
 
     /***************************************
@@ -514,17 +566,15 @@ namespace sparrow
     template <bool BIG>
     auto list_view_array_impl<BIG>::make_list_offsets() -> offset_type*
     {
-        return reinterpret_cast<offset_type*>(
-              this->get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].data() + this->get_arrow_proxy().offset()
-        );
+        return reinterpret_cast<offset_type*>(this->get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].data())
+               + this->get_arrow_proxy().offset();
     }
 
     template <bool BIG>
     auto list_view_array_impl<BIG>::make_list_sizes() -> offset_type*
     {
-        return reinterpret_cast<offset_type*>(
-              this->get_arrow_proxy().buffers()[SIZES_BUFFER_INDEX].data() + this->get_arrow_proxy().offset()
-        );
+        return reinterpret_cast<offset_type*>(this->get_arrow_proxy().buffers()[SIZES_BUFFER_INDEX].data())
+               + this->get_arrow_proxy().offset();
     }
 
 #ifdef __GNUC__
@@ -549,9 +599,14 @@ namespace sparrow
     {
     }
 
+    inline uint64_t fixed_sized_list_array::list_size() const
+    {
+        return m_list_size;
+    }
+
     inline auto fixed_sized_list_array::offset_range(size_type i) const -> std::pair<offset_type, offset_type>
     {
-        const auto offset = i * m_list_size;
+        const auto offset = (static_cast<offset_type>(this->get_arrow_proxy().offset()) + i) * m_list_size;
         return std::make_pair(offset, offset + m_list_size);
     }
 
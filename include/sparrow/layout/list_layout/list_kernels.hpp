@@ -0,0 +1,453 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/borrowed_proxy.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /**
+     * Kernels over list, list view and fixed size list arrays that read the
+     * offsets and the flat array directly instead of going through
+     * list_value and array_element.
+     *
+     * Kernels copying elements of the flat array copy them range by range:
+     * primitive and variable size binary flat arrays are copied with memcpy,
+     * flat arrays of other types are supported only when the elements to
+     * copy form a single range, which is then sliced.
+     */
+
+    /// Lengths of the lists of \c ar, null for null lists.
+    template <class D>
+    [[nodiscard]] primitive_array<typename array_inner_types<D>::list_size_type>
+    list_value_lengths(const list_array_crtp_base<D>& ar);
+
+    /**
+     * Concatenation of the elements of the non-null lists of \c ar, in
+     * order. Null lists are skipped even if their range is not empty.
+     *
+     * @throws std::invalid_argument if the elements must be gathered from
+     *         a flat array whose type is not supported.
+     */
+    template <class D>
+    [[nodiscard]] array flatten(const list_array_crtp_base<D>& ar);
+
+    /// For each element of flatten(ar), the index of the list of \c ar holding it.
+    template <class D>
+    [[nodiscard]] std::vector<std::size_t> parent_indices(const list_array_crtp_base<D>& ar);
+
+    /**
+     * Converts a list view array into a list array. The lists are copied in
+     * order, so that lists sharing elements or stored out of order in the
+     * flat array are compacted; null lists are empty in the result.
+     *
+     * @throws std::invalid_argument as flatten.
+     */
+    template <bool BIG>
+    [[nodiscard]] list_array_impl<BIG> list_view_to_list(const list_view_array_impl<BIG>& ar);
+
+    /**
+     * Converts a list array into a list view array. Only the sizes buffer is
+     * allocated: the result shares the flat array, the validity and the
+     * offsets of \c ar, and keeps them alive. Pass an rvalue to avoid
+     * copying \c ar.
+     */
+    template <bool BIG>
+    [[nodiscard]] list_view_array_impl<BIG> list_to_list_view(list_array_impl<BIG> ar);
+
+    /**
+     * Converts a fixed size list array into a list array. Only the offsets
+     * buffer is allocated; the buffers of \c ar are shared as in
+     * list_to_list_view.
+     *
+     * @throws std::length_error if the offsets do not fit in the offset type
+     *         of the result.
+     */
+    template <bool BIG = false>
+    [[nodiscard]] list_array_impl<BIG> fixed_sized_list_to_list(fixed_sized_list_array ar);
+
+    /*******************************
+     * list kernels implementation *
+     *******************************/
+
+    namespace detail
+    {
+        using flat_range = std::pair<std::size_t, std::size_t>;
+
+        // Appends [first, last) to ranges, merging it with the last range if
+        // they are adjacent, so that consecutive lists are copied at once.
+        inline void append_flat_range(std::vector<flat_range>& ranges, std::size_t first, std::size_t last)
+        {
+            if (first == last)
+            {
+                return;
+            }
+            if (!ranges.empty() && ranges.back().second == first)
+            {
+                ranges.back().second = last;
+            }
+            else
+            {
+                ranges.emplace_back(first, last);
+            }
+        }
+
+        template <class D>
+        std::vector<flat_range> valid_list_ranges(const list_array_crtp_base<D>& ar)
+        {
+            const validity_view validity = make_validity_view(ar.get_arrow_proxy());
+            std::vector<flat_range> ranges;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                if (validity[i])
+                {
+                    const auto [first, last] = ar.value_range(i);
+                    append_flat_range(ranges, first, last);
+                }
+            }
+            return ranges;
+        }
+
+        inline std::size_t flat_ranges_size(std::span<const flat_range> ranges)
+        {
+            std::size_t size = 0;
+            for (const auto& [first, last] : ranges)
+            {
+                size += last - first;
+            }
+            return size;
+        }
+
+        template <class A>
+        struct range_gather
+        {
+            static constexpr bool supported = false;
+        };
+
+        template <class T>
+        struct range_gather<primitive_array<T>>
+        {
+            static constexpr bool supported = true;
+
+            static primitive_array<T>
+            gather(const primitive_array<T>& flat, std::span<const flat_range> ranges, std::size_t size)
+            {
+                const typed_view<T> view(flat);
+                u8_buffer<T> result(size);
+                validity_bitmap validity(size, true);
+                std::size_t pos = 0;
+                for (const auto& [first, last] : ranges)
+                {
+                    SPARROW_ASSERT_TRUE(last <= view.size());
+                    std::memcpy(result.data() + pos, view.data() + first, (last - first) * sizeof(T));
+                    if (!view.validity().all_valid())
+                    {
+                        for (std::size_t i = first; i < last; ++i)
+                        {
+                            if (!view.has_value(i))
+                            {
+                                validity.set(pos + i - first, false);
+                            }
+                        }
+                    }
+                    pos += last - first;
+                }
+                return primitive_array<T>(std::move(result), std::move(validity));
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct range_gather<variable_size_binary_array<T, CR, OT>>
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+            static constexpr bool supported = true;
+
+            static array_type gather(const array_type& flat, std::span<const flat_range> ranges, std::size_t size)
+            {
+                const validity_view validity = make_validity_view(flat.get_arrow_proxy());
+                std::vector<std::size_t> indices;
+                indices.reserve(size);
+                for (const auto& [first, last] : ranges)
+                {
+                    SPARROW_ASSERT_TRUE(last <= flat.size());
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        indices.push_back(i);
+                    }
+                }
+                return gather_binary(
+                    flat,
+                    indices,
+                    [&](std::size_t i)
+                    {
+                        return validity[indices[i]];
+                    }
+                );
+            }
+        };
+
+        // Copies the elements of the flat array held by ranges, in order.
+        inline array gather_flat_ranges(const array_wrapper& flat, std::span<const flat_range> ranges)
+        {
+            const std::size_t size = flat_ranges_size(ranges);
+            return visit(
+                [&](const auto& typed_flat) -> array
+                {
+                    using flat_type = std::decay_t<decltype(typed_flat)>;
+                    if constexpr (range_gather<flat_type>::supported)
+                    {
+                        return array(range_gather<flat_type>::gather(typed_flat, ranges, size));
+                    }
+                    else
+                    {
+                        if (ranges.size() > 1)
+                        {
+                            throw std::invalid_argument(
+                                "lists that are not contiguous must hold primitive or variable size binary arrays"
+                            );
+                        }
+                        arrow_proxy proxy(flat.get_arrow_proxy());
+                        proxy.set_offset(proxy.offset() + (ranges.empty() ? 0 : ranges.front().first));
+                        proxy.set_length(size);
+                        return array(proxy.extract_array(), proxy.extract_schema());
+                    }
+                },
+                flat
+            );
+        }
+
+        // Builds a list array with the format \c format, the flat array, the
+        // length and the offset of \c source, which it shares the ownership
+        // of. Its buffers are \c buffers followed by \c owned_buffer.
+        inline arrow_proxy make_borrowed_list_proxy(
+            std::shared_ptr<const arrow_proxy> source,
+            const char* format,
+            std::vector<const void*> buffers,
+            buffer<std::uint8_t> owned_buffer
+        )
+        {
+            borrowed_proxy_parts parts = borrow_parts(*source);
+            parts.format = format;
+            parts.borrowed_buffers = std::move(buffers);
+            parts.owned_buffers.push_back(std::move(owned_buffer));
+            parts.array_children.push_back(source->array().children[0]);
+            parts.schema_children.push_back(source->schema().children[0]);
+            parts.owner = std::move(source);
+            return make_borrowed_proxy(std::move(parts));
+        }
+    }
+
+    template <class D>
+    primitive_array<typename array_inner_types<D>::list_size_type>
+    list_value_lengths(const list_array_crtp_base<D>& ar)
+    {
+        using size_type = typename array_inner_types<D>::list_size_type;
+        const std::size_t n = ar.size();
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+        u8_buffer<size_type> lengths(n);
+        size_type* out = lengths.data();
+        validity_bitmap result_validity(n, true);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (validity[i])
+            {
+                const auto [first, last] = ar.value_range(i);
+                out[i] = static_cast<size_type>(last - first);
+            }
+            else
+            {
+                out[i] = 0;
+                result_validity.set(i, false);
+            }
+        }
+        return primitive_array<size_type>(std::move(lengths), std::move(result_validity));
+    }
+
+    template <class D>
+    array flatten(const list_array_crtp_base<D>& ar)
+    {
+        return detail::gather_flat_ranges(*ar.raw_flat_array(), detail::valid_list_ranges(ar));
+    }
+
+    template <class D>
+    std::vector<std::size_t> parent_indices(const list_array_crtp_base<D>& ar)
+    {
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+        std::size_t total_size = 0;
+        for (std::size_t i = 0; i < ar.size(); ++i)
+        {
+            if (validity[i])
+            {
+                const auto [first, last] = ar.value_range(i);
+                total_size += last - first;
+            }
+        }
+
+        std::vector<std::size_t> result;
+        result.reserve(total_size);
+        for (std::size_t i = 0; i < ar.size(); ++i)
+        {
+            if (validity[i])
+            {
+                const auto [first, last] = ar.value_range(i);
+                result.insert(result.end(), last - first, i);
+            }
+        }
+        return result;
+    }
+
+    template <bool BIG>
+    list_array_impl<BIG> list_view_to_list(const list_view_array_impl<BIG>& ar)
+    {
+        using offset_type = typename array_inner_types<list_array_impl<BIG>>::list_size_type;
+        const std::size_t n = ar.size();
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+
+        buffer<std::uint8_t> offset_buffer((n + 1) * sizeof(offset_type), std::uint8_t(0));
+        offset_type* offsets = offset_buffer.template data<offset_type>();
+        validity_bitmap result_validity(n, true);
+        std::vector<detail::flat_range> ranges;
+        std::size_t total_size = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (validity[i])
+            {
+                const auto [first, last] = ar.value_range(i);
+                detail::append_flat_range(ranges, first, last);
+                total_size += last - first;
+                if (total_size > static_cast<std::size_t>(std::numeric_limits<offset_type>::max()))
+                {
+                    throw std::length_error("list elements exceed the capacity of the offset type");
+                }
+            }
+            else
+            {
+                result_validity.set(i, false);
+            }
+            offsets[i + 1] = static_cast<offset_type>(total_size);
+        }
+
+        ArrowArray flat_arr{};
+        ArrowSchema flat_schema{};
+        detail::gather_flat_ranges(*ar.raw_flat_array(), ranges)
+            .extract_arrow_array(flat_arr)
+            .extract_arrow_schema(flat_schema);
+
+        const auto null_count = static_cast<std::int64_t>(result_validity.null_count());
+        std::vector<buffer<std::uint8_t>> buffers(2);
+        buffers[0] = std::move(result_validity).extract_storage();
+        buffers[1] = std::move(offset_buffer);
+
+        ArrowSchema schema = make_arrow_schema(
+            BIG ? std::string("+L") : std::string("+l"),                   // format
+            std::nullopt,                                                  // name
+            std::nullopt,                                                  // metadata
+            std::nullopt,                                                  // flags
+            1,                                                             // n_children
+            new ArrowSchema*[1]{new ArrowSchema(std::move(flat_schema))},  // children
+            nullptr                                                        // dictionary
+        );
+        ArrowArray arr = make_arrow_array(
+            static_cast<std::int64_t>(n),                            // length
+            null_count,                                              // null_count
+            0,                                                       // offset
+            std::move(buffers),
+            1,                                                       // n_children
+            new ArrowArray*[1]{new ArrowArray(std::move(flat_arr))},  // children
+            nullptr                                                  // dictionary
+        );
+        return list_array_impl<BIG>(arrow_proxy(std::move(arr), std::move(schema)));
+    }
+
+    template <bool BIG>
+    list_view_array_impl<BIG> list_to_list_view(list_array_impl<BIG> ar)
+    {
+        using offset_type = typename array_inner_types<list_array_impl<BIG>>::list_size_type;
+        auto proxy = std::make_shared<const arrow_proxy>(detail::array_access::extract_arrow_proxy(std::move(ar)));
+        const ArrowArray& source = proxy->array();
+
+        // The offset of the array is kept, so that the validity and the
+        // offsets buffers can be shared: the sizes buffer covers it.
+        const std::size_t count = static_cast<std::size_t>(source.offset + source.length);
+        const auto* offsets = static_cast<const offset_type*>(source.buffers[1]);
+        buffer<std::uint8_t> sizes_buffer(count * sizeof(offset_type), std::uint8_t(0));
+        offset_type* sizes = sizes_buffer.template data<offset_type>();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sizes[i] = static_cast<offset_type>(offsets[i + 1] - offsets[i]);
+        }
+
+        return list_view_array_impl<BIG>(
+            detail::make_borrowed_list_proxy(
+                std::move(proxy),
+                BIG ? "+vL" : "+vl",
+                {source.buffers[0], source.buffers[1]},
+                std::move(sizes_buffer)
+            )
+        );
+    }
+
+    template <bool BIG>
+    list_array_impl<BIG> fixed_sized_list_to_list(fixed_sized_list_array ar)
+    {
+        using offset_type = typename array_inner_types<list_array_impl<BIG>>::list_size_type;
+        const auto list_size = static_cast<std::size_t>(ar.list_size());
+        auto proxy = std::make_shared<const arrow_proxy>(detail::array_access::extract_arrow_proxy(std::move(ar)));
+        const ArrowArray& source = proxy->array();
+
+        const std::size_t count = static_cast<std::size_t>(source.offset + source.length);
+        if (list_size != 0 && count > static_cast<std::size_t>(std::numeric_limits<offset_type>::max()) / list_size)
+        {
+            throw std::length_error("list elements exceed the capacity of the offset type");
+        }
+        buffer<std::uint8_t> offset_buffer((count + 1) * sizeof(offset_type), std::uint8_t(0));
+        offset_type* offsets = offset_buffer.template data<offset_type>();
+        for (std::size_t i = 0; i <= count; ++i)
+        {
+            offsets[i] = static_cast<offset_type>(i * list_size);
+        }
+
+        return list_array_impl<BIG>(
+            detail::make_borrowed_list_proxy(std::move(proxy), BIG ? "+L" : "+l", {source.buffers[0]}, std::move(offset_buffer))
+        );
+    }
+}
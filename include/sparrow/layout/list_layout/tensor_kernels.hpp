@@ -0,0 +1,298 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/list_layout/tensor_view.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+
+namespace sparrow
+{
+    /**
+     * Kernels comparing each row of a tensor_view to a query vector. The
+     * query must have one element per column of the view; kernels returning
+     * an array return one element per row, null for null rows.
+     *
+     * @throws std::invalid_argument if the size of the query does not match
+     *         the number of columns.
+     */
+
+    /// The query type does not take part in template argument deduction,
+    /// so that kernels can be called with any contiguous range of T.
+    template <class T>
+    using tensor_query = std::span<const std::type_identity_t<T>>;
+
+    enum class tensor_metric
+    {
+        dot,     // dot product, larger is closer
+        l2,      // euclidean distance, smaller is closer
+        cosine,  // 1 - cosine similarity, smaller is closer
+    };
+
+    template <std::floating_point T>
+    [[nodiscard]] primitive_array<T> tensor_dot(const tensor_view<T>& view, tensor_query<T> query);
+
+    template <std::floating_point T>
+    [[nodiscard]] primitive_array<T> tensor_l2_distance(const tensor_view<T>& view, tensor_query<T> query);
+
+    /// The distance to a row or a query of norm 0 is 1.
+    template <std::floating_point T>
+    [[nodiscard]] primitive_array<T> tensor_cosine_distance(const tensor_view<T>& view, tensor_query<T> query);
+
+    /**
+     * Indices of the \c k non-null rows closest to \c query for \c metric,
+     * closest first; ties are ordered by index. Fewer than \c k indices are
+     * returned if the view has fewer non-null rows.
+     */
+    template <std::floating_point T>
+    [[nodiscard]] std::vector<std::size_t>
+    tensor_top_k(const tensor_view<T>& view, tensor_query<T> query, std::size_t k, tensor_metric metric);
+
+    /*********************************
+     * tensor kernels implementation *
+     *********************************/
+
+    namespace detail
+    {
+        // The reductions below use independent accumulators so that the
+        // compiler vectorizes them without having to reassociate floating
+        // point additions.
+        inline constexpr std::size_t tensor_lanes = 8;
+
+        template <class T>
+        T dot_product(const T* lhs, const T* rhs, std::size_t n)
+        {
+            T acc[tensor_lanes] = {};
+            std::size_t i = 0;
+            for (; i + tensor_lanes <= n; i += tensor_lanes)
+            {
+                for (std::size_t l = 0; l < tensor_lanes; ++l)
+                {
+                    acc[l] += lhs[i + l] * rhs[i + l];
+                }
+            }
+            T result = 0;
+            for (std::size_t l = 0; l < tensor_lanes; ++l)
+            {
+                result += acc[l];
+            }
+            for (; i < n; ++i)
+            {
+                result += lhs[i] * rhs[i];
+            }
+            return result;
+        }
+
+        template <class T>
+        T squared_l2_distance(const T* lhs, const T* rhs, std::size_t n)
+        {
+            T acc[tensor_lanes] = {};
+            std::size_t i = 0;
+            for (; i + tensor_lanes <= n; i += tensor_lanes)
+            {
+                for (std::size_t l = 0; l < tensor_lanes; ++l)
+                {
+                    const T diff = lhs[i + l] - rhs[i + l];
+                    acc[l] += diff * diff;
+                }
+            }
+            T result = 0;
+            for (std::size_t l = 0; l < tensor_lanes; ++l)
+            {
+                result += acc[l];
+            }
+            for (; i < n; ++i)
+            {
+                const T diff = lhs[i] - rhs[i];
+                result += diff * diff;
+            }
+            return result;
+        }
+
+        // Computes the dot product of row and query, and the squared norm of
+        // row, in a single pass over row.
+        template <class T>
+        std::pair<T, T> dot_and_squared_norm(const T* row, const T* query, std::size_t n)
+        {
+            T dot_acc[tensor_lanes] = {};
+            T norm_acc[tensor_lanes] = {};
+            std::size_t i = 0;
+            for (; i + tensor_lanes <= n; i += tensor_lanes)
+            {
+                for (std::size_t l = 0; l < tensor_lanes; ++l)
+                {
+                    dot_acc[l] += row[i + l] * query[i + l];
+                    norm_acc[l] += row[i + l] * row[i + l];
+                }
+            }
+            T dot = 0;
+            T norm = 0;
+            for (std::size_t l = 0; l < tensor_lanes; ++l)
+            {
+                dot += dot_acc[l];
+                norm += norm_acc[l];
+            }
+            for (; i < n; ++i)
+            {
+                dot += row[i] * query[i];
+                norm += row[i] * row[i];
+            }
+            return {dot, norm};
+        }
+
+        template <class T>
+        T cosine_distance(const T* row, const T* query, std::size_t n, T query_norm)
+        {
+            const auto [dot, squared_norm] = dot_and_squared_norm(row, query, n);
+            const T norm = std::sqrt(squared_norm) * query_norm;
+            return norm == T(0) ? T(1) : T(1) - dot / norm;
+        }
+
+        template <class T>
+        void check_tensor_query(const tensor_view<T>& view, tensor_query<T> query)
+        {
+            if (query.size() != view.cols())
+            {
+                throw std::invalid_argument("the size of the query must be the number of columns of the tensor view");
+            }
+        }
+
+        // Evaluates score(row) for every non-null row of view.
+        template <class T, class F>
+        primitive_array<T> tensor_scores(const tensor_view<T>& view, F&& score)
+        {
+            const std::size_t rows = view.rows();
+            u8_buffer<T> scores(rows);
+            T* out = scores.data();
+            validity_bitmap validity(rows, true);
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                if (view.has_value(i))
+                {
+                    out[i] = score(view.row(i).data());
+                }
+                else
+                {
+                    out[i] = T(0);
+                    validity.set(i, false);
+                }
+            }
+            return primitive_array<T>(std::move(scores), std::move(validity));
+        }
+    }
+
+    template <std::floating_point T>
+    primitive_array<T> tensor_dot(const tensor_view<T>& view, tensor_query<T> query)
+    {
+        detail::check_tensor_query(view, query);
+        return detail::tensor_scores(
+            view,
+            [&](const T* row)
+            {
+                return detail::dot_product(row, query.data(), query.size());
+            }
+        );
+    }
+
+    template <std::floating_point T>
+    primitive_array<T> tensor_l2_distance(const tensor_view<T>& view, tensor_query<T> query)
+    {
+        detail::check_tensor_query(view, query);
+        return detail::tensor_scores(
+            view,
+            [&](const T* row)
+            {
+                return std::sqrt(detail::squared_l2_distance(row, query.data(), query.size()));
+            }
+        );
+    }
+
+    template <std::floating_point T>
+    primitive_array<T> tensor_cosine_distance(const tensor_view<T>& view, tensor_query<T> query)
+    {
+        detail::check_tensor_query(view, query);
+        const T query_norm = std::sqrt(detail::dot_product(query.data(), query.data(), query.size()));
+        return detail::tensor_scores(
+            view,
+            [&](const T* row)
+            {
+                return detail::cosine_distance(row, query.data(), query.size(), query_norm);
+            }
+        );
+    }
+
+    template <std::floating_point T>
+    std::vector<std::size_t>
+    tensor_top_k(const tensor_view<T>& view, tensor_query<T> query, std::size_t k, tensor_metric metric)
+    {
+        detail::check_tensor_query(view, query);
+        const std::size_t n = query.size();
+        const T query_norm = std::sqrt(detail::dot_product(query.data(), query.data(), n));
+
+        // Keys are ordered so that smaller is closer; the squared euclidean
+        // distance gives the same order as the distance. NaN keys are last.
+        std::vector<std::pair<T, std::size_t>> candidates;
+        candidates.reserve(view.rows());
+        for (std::size_t i = 0; i < view.rows(); ++i)
+        {
+            if (!view.has_value(i))
+            {
+                continue;
+            }
+            const T* row = view.row(i).data();
+            T key;
+            switch (metric)
+            {
+                case tensor_metric::dot:
+                    key = -detail::dot_product(row, query.data(), n);
+                    break;
+                case tensor_metric::l2:
+                    key = detail::squared_l2_distance(row, query.data(), n);
+                    break;
+                case tensor_metric::cosine:
+                    key = detail::cosine_distance(row, query.data(), n, query_norm);
+                    break;
+                default:
+                    throw std::invalid_argument("unknown tensor metric");
+            }
+            candidates.emplace_back(std::isnan(key) ? std::numeric_limits<T>::infinity() : key, i);
+        }
+
+        const std::size_t count = std::min(k, candidates.size());
+        std::partial_sort(
+            candidates.begin(),
+            candidates.begin() + static_cast<std::ptrdiff_t>(count),
+            candidates.end()
+        );
+        std::vector<std::size_t> result(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            result[i] = candidates[i].second;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+#include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /**
+     * Non-owning view over a fixed size list array whose flat array is a
+     * primitive_array<T>, as a dense row-major matrix with one row per list
+     * and one column per element of the lists.
+     *
+     * The offsets of the list array and of its flat array are applied, so
+     * that row i is the list at index i. The validity of the view is the one
+     * of the lists; the validity of the flat array is not applied. The view
+     * is invalidated by any operation invalidating the buffers of the
+     * viewed array.
+     *
+     * @tparam T the value type of the flat array.
+     */
+    template <class T>
+    class tensor_view
+    {
+    public:
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_pointer = const T*;
+        using row_type = std::span<const T>;
+        using values_type = std::span<const T>;
+
+        /**
+         * Builds a view over \c ar. Throws std::runtime_error if the flat
+         * array of \c ar is not a primitive_array<T>.
+         */
+        explicit tensor_view(const fixed_sized_list_array& ar);
+
+        [[nodiscard]] size_type rows() const noexcept;
+        [[nodiscard]] size_type cols() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        /// All the elements, row after row.
+        [[nodiscard]] values_type values() const noexcept;
+        [[nodiscard]] const_pointer data() const noexcept;
+
+        [[nodiscard]] row_type row(size_type i) const;
+        [[nodiscard]] const T& operator()(size_type i, size_type j) const;
+
+        [[nodiscard]] const validity_view& validity() const noexcept;
+        [[nodiscard]] bool has_value(size_type i) const;
+
+    private:
+
+        static const primitive_array<T>& checked_flat_array(const fixed_sized_list_array& ar);
+
+        const_pointer p_data = nullptr;
+        size_type m_rows = 0;
+        size_type m_cols = 0;
+        validity_view m_validity;
+    };
+
+    /******************************
+     * tensor_view implementation *
+     ******************************/
+
+    template <class T>
+    const primitive_array<T>& tensor_view<T>::checked_flat_array(const fixed_sized_list_array& ar)
+    {
+        const array_wrapper& flat = *ar.raw_flat_array();
+        if (flat.get_arrow_proxy().data_type() != arrow_traits<T>::type_id)
+        {
+            throw std::runtime_error("The flat array of the fixed size list array does not hold the requested type");
+        }
+        return unwrap_array<primitive_array<T>>(flat);
+    }
+
+    template <class T>
+    tensor_view<T>::tensor_view(const fixed_sized_list_array& ar)
+        : m_rows(ar.size())
+        , m_cols(static_cast<size_type>(ar.list_size()))
+        , m_validity(detail::make_validity_view(ar.get_arrow_proxy()))
+    {
+        const typed_view<T> flat(checked_flat_array(ar));
+        const auto first = static_cast<size_type>(ar.get_arrow_proxy().offset()) * m_cols;
+        SPARROW_ASSERT_TRUE(first + m_rows * m_cols <= flat.size());
+        p_data = flat.data() + first;
+    }
+
+    template <class T>
+    auto tensor_view<T>::rows() const noexcept -> size_type
+    {
+        return m_rows;
+    }
+
+    template <class T>
+    auto tensor_view<T>::cols() const noexcept -> size_type
+    {
+        return m_cols;
+    }
+
+    template <class T>
+    bool tensor_view<T>::empty() const noexcept
+    {
+        return m_rows == 0;
+    }
+
+    template <class T>
+    auto tensor_view<T>::values() const noexcept -> values_type
+    {
+        return values_type(p_data, m_rows * m_cols);
+    }
+
+    template <class T>
+    auto tensor_view<T>::data() const noexcept -> const_pointer
+    {
+        return p_data;
+    }
+
+    template <class T>
+    auto tensor_view<T>::row(size_type i) const -> row_type
+    {
+        SPARROW_ASSERT_TRUE(i < m_rows);
+        return row_type(p_data + i * m_cols, m_cols);
+    }
+
+    template <class T>
+    const T& tensor_view<T>::operator()(size_type i, size_type j) const
+    {
+        SPARROW_ASSERT_TRUE(i < m_rows);
+        SPARROW_ASSERT_TRUE(j < m_cols);
+        return p_data[i * m_cols + j];
+    }
+
+    template <class T>
+    auto tensor_view<T>::validity() const noexcept -> const validity_view&
+    {
+        return m_validity;
+    }
+
+    template <class T>
+    bool tensor_view<T>::has_value(size_type i) const
+    {
+        return m_validity[i];
+    }
+}
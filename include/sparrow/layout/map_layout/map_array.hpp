@@ -0,0 +1,284 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array_api.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/list_layout/list_array.hpp"
+#include "sparrow/layout/struct_layout/struct_array.hpp"
+#include "sparrow/utils/mp_utils.hpp"
+
+namespace sparrow
+{
+    class map_array;
+
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+
+        template <>
+        struct get_data_type_from_array<sparrow::map_array>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return sparrow::data_type::MAP;
+            }
+        };
+    }
+
+    template <>
+    struct array_inner_types<map_array> : array_inner_types_base
+    {
+        using list_size_type = std::uint32_t;
+        using array_type = map_array;
+        using inner_value_type = list_value;
+        using inner_reference = list_value;
+        using inner_const_reference = list_value;
+        using value_iterator = functor_index_iterator<detail::layout_value_functor<array_type, inner_value_type>>;
+        using const_value_iterator = functor_index_iterator<
+            detail::layout_value_functor<const array_type, inner_value_type>>;
+        using iterator_tag = std::random_access_iterator_tag;
+    };
+
+    /**
+     * Array of maps, stored as a list of entries held by a struct array
+     * with two children: the keys and the values.
+     *
+     * The elements of the array are list_value objects over the entries,
+     * i.e. lists of struct_value objects. Kernels accessing the keys and the
+     * values directly are declared in map_kernels.hpp.
+     */
+    class map_array final : public list_array_crtp_base<map_array>
+    {
+    public:
+
+        using self_type = map_array;
+        using inner_types = array_inner_types<self_type>;
+        using base_type = list_array_crtp_base<self_type>;
+        using list_size_type = inner_types::list_size_type;
+        using size_type = typename base_type::size_type;
+        using offset_type = const std::uint32_t;
+
+        explicit map_array(arrow_proxy proxy);
+
+        map_array(const self_type&);
+        map_array& operator=(const self_type&);
+
+        map_array(self_type&&) = default;
+        map_array& operator=(self_type&&) = default;
+
+        template <class... ARGS>
+            requires(mpl::excludes_copy_and_move_ctor_v<map_array, ARGS...>)
+        map_array(ARGS&&... args)
+            : self_type(create_proxy(std::forward<ARGS>(args)...))
+        {
+        }
+
+        /// The struct array holding the entries of all the maps.
+        const struct_array& entries() const;
+
+        /// The keys of the entries of all the maps.
+        const array_wrapper* raw_keys() const;
+
+        /// The values of the entries of all the maps.
+        const array_wrapper* raw_items() const;
+
+    private:
+
+        /**
+         * Builds a map array from the keys and the values of the entries,
+         * and the offsets of the maps in the entries: map i holds the
+         * entries [offsets[i], offsets[i + 1]).
+         */
+        template <validity_bitmap_input VB = validity_bitmap>
+        static arrow_proxy create_proxy(
+            array&& keys,
+            array&& items,
+            u8_buffer<std::uint32_t>&& offsets,
+            VB&& validity_input = validity_bitmap{}
+        );
+
+        static arrow_proxy named_proxy(array&& ar, std::string_view name);
+
+        static constexpr std::size_t OFFSET_BUFFER_INDEX = 1;
+        std::pair<offset_type, offset_type> offset_range(size_type i) const;
+
+        offset_type* make_list_offsets();
+
+        offset_type* p_list_offsets;
+
+        // friend classes
+        friend class array_crtp_base<self_type>;
+        friend class list_array_crtp_base<self_type>;
+    };
+
+    /****************************
+     * map_array implementation *
+     ****************************/
+
+    inline map_array::map_array(arrow_proxy proxy)
+        : base_type(std::move(proxy))
+        , p_list_offsets(make_list_offsets())
+    {
+    }
+
+    inline map_array::map_array(const self_type& rhs)
+        : base_type(rhs)
+        , p_list_offsets(make_list_offsets())
+    {
+    }
+
+    inline auto map_array::operator=(const self_type& rhs) -> self_type&
+    {
+        if (this != &rhs)
+        {
+            base_type::operator=(rhs);
+            p_list_offsets = make_list_offsets();
+        }
+        return *this;
+    }
+
+    inline const struct_array& map_array::entries() const
+    {
+        return unwrap_array<struct_array>(*this->raw_flat_array());
+    }
+
+    inline const array_wrapper* map_array::raw_keys() const
+    {
+        return entries().raw_child(0);
+    }
+
+    inline const array_wrapper* map_array::raw_items() const
+    {
+        return entries().raw_child(1);
+    }
+
+    inline arrow_proxy map_array::named_proxy(array&& ar, std::string_view name)
+    {
+        ArrowArray arr{};
+        ArrowSchema schema{};
+        std::move(ar).extract_arrow_array(arr).extract_arrow_schema(schema);
+        arrow_proxy proxy(std::move(arr), std::move(schema));
+        if (proxy.is_created_with_sparrow())
+        {
+            proxy.set_name(name);
+        }
+        return proxy;
+    }
+
+    template <validity_bitmap_input VB>
+    arrow_proxy map_array::create_proxy(
+        array&& keys,
+        array&& items,
+        u8_buffer<std::uint32_t>&& offsets,
+        VB&& validity_input
+    )
+    {
+        SPARROW_ASSERT_TRUE(offsets.size() > 0);
+        SPARROW_ASSERT_TRUE(keys.size() == items.size());
+        const auto size = offsets.size() - 1;
+        const auto entries_count = static_cast<std::int64_t>(keys.size());
+        validity_bitmap vbitmap = ensure_validity_bitmap(size, std::forward<VB>(validity_input));
+
+        arrow_proxy key_proxy = named_proxy(std::move(keys), "key");
+        arrow_proxy item_proxy = named_proxy(std::move(items), "value");
+
+        ArrowSchema entries_schema = make_arrow_schema(
+            std::string("+s"),        // format
+            std::string("entries"),  // name
+            std::nullopt,             // metadata
+            std::nullopt,             // flags,
+            2,                        // n_children
+            new ArrowSchema*[2]{
+                new ArrowSchema(key_proxy.extract_schema()),
+                new ArrowSchema(item_proxy.extract_schema())
+            },        // children
+            nullptr  // dictionary
+        );
+        std::vector<buffer<std::uint8_t>> entries_buffers = {
+            validity_bitmap(static_cast<std::size_t>(entries_count), true).extract_storage()
+        };
+        ArrowArray entries_array = make_arrow_array(
+            entries_count,  // length
+            0,              // null_count
+            0,              // offset
+            std::move(entries_buffers),
+            2,  // n_children
+            new ArrowArray*[2]{
+                new ArrowArray(key_proxy.extract_array()),
+                new ArrowArray(item_proxy.extract_array())
+            },        // children
+            nullptr  // dictionary
+        );
+
+        const auto null_count = vbitmap.null_count();
+        ArrowSchema schema = make_arrow_schema(
+            std::string("+m"),  // format
+            std::nullopt,       // name
+            std::nullopt,       // metadata
+            std::nullopt,       // flags,
+            1,                  // n_children
+            new ArrowSchema*[1]{new ArrowSchema(std::move(entries_schema))},  // children
+            nullptr                                                          // dictionary
+        );
+        std::vector<buffer<std::uint8_t>> arr_buffs = {
+            std::move(vbitmap).extract_storage(),
+            std::move(offsets).extract_storage()
+        };
+        ArrowArray arr = make_arrow_array(
+            static_cast<std::int64_t>(size),  // length
+            static_cast<int64_t>(null_count),
+            0,  // offset
+            std::move(arr_buffs),
+            1,                                                             // n_children
+            new ArrowArray*[1]{new ArrowArray(std::move(entries_array))},  // children
+            nullptr                                                        // dictionary
+        );
+        return arrow_proxy{std::move(arr), std::move(schema)};
+    }
+
+    inline auto map_array::offset_range(size_type i) const -> std::pair<offset_type, offset_type>
+    {
+        return std::make_pair(p_list_offsets[i], p_list_offsets[i + 1]);
+    }
+
+#ifdef __GNUC__
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wcast-align"
+#endif
+
+    inline auto map_array::make_list_offsets() -> offset_type*
+    {
+        return reinterpret_cast<offset_type*>(this->get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].data())
+               + this->get_arrow_proxy().offset();
+    }
+
+#ifdef __GNUC__
+#    pragma GCC diagnostic pop
+#endif
+}
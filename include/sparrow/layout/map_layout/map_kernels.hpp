@@ -0,0 +1,314 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/dictionary_kernels.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/map_layout/map_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+
+namespace sparrow
+{
+    /**
+     * Value of \c key in every map of \c ar: element i of the result is the
+     * value of the first entry of map i whose key equals \c key, or null if
+     * map i is null, has no such entry, or if the value of that entry is
+     * null. The result has the type of the values of \c ar.
+     *
+     * The keys of all the entries are compared to \c key in a single pass
+     * before the maps are scanned. Keys can be primitive arrays compared to
+     * an arithmetic key, string or binary arrays compared to a key
+     * convertible to std::string_view, or dictionary encoded arrays of
+     * these, in which case \c key is compared once per dictionary entry.
+     *
+     * @throws std::invalid_argument if the keys cannot be compared to \c key,
+     *         or if the values are not primitive or variable size binary
+     *         arrays.
+     */
+    template <class K>
+    [[nodiscard]] array map_lookup(const map_array& ar, const K& key);
+
+    /******************************
+     * map kernels implementation *
+     ******************************/
+
+    namespace detail
+    {
+        inline constexpr std::size_t map_npos = std::numeric_limits<std::size_t>::max();
+
+        // True if value is in the range of the integer type I, so that it can
+        // be converted to I; false for NaN.
+        template <std::integral I, std::floating_point F>
+        bool in_integer_range(F value)
+        {
+            // 2^digits, exactly representable as a power of two.
+            const F upper = static_cast<F>(std::numeric_limits<I>::max() / 2 + 1) * F(2);
+            const F lower = std::is_signed_v<I> ? -upper : F(0);
+            return value >= lower && value < upper;
+        }
+
+        // Computes a bitmap with one bit per key, set if the key is not null
+        // and equals the lookup key.
+        template <class A, class K>
+        struct map_key_matcher
+        {
+            static constexpr bool supported = false;
+        };
+
+        template <class T, class K>
+            requires(std::integral<T> || std::floating_point<T>) && std::is_arithmetic_v<K>
+                    && (!std::same_as<T, bool>) && (!std::same_as<T, float16_t>) && (!std::same_as<K, bool>)
+        struct map_key_matcher<primitive_array<T>, K>
+        {
+            static constexpr bool supported = true;
+
+            static validity_bitmap match(const primitive_array<T>& keys, const K& key)
+            {
+                const typed_view<T> view(keys);
+                const std::size_t n = view.size();
+                validity_bitmap result(n, false);
+
+                // A key that T cannot represent exactly does not match anything.
+                if (!representable(key))
+                {
+                    return result;
+                }
+
+                const T value = static_cast<T>(key);
+                const T* data = view.data();
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (data[i] == value && view.has_value(i))
+                    {
+                        result.set(i, true);
+                    }
+                }
+                return result;
+            }
+
+        private:
+
+            // The range is checked before any conversion, since converting a
+            // floating point value out of the range of the target type is
+            // undefined behavior.
+            static bool representable(const K& key)
+            {
+                if constexpr (std::integral<T> && std::integral<K>)
+                {
+                    return std::in_range<T>(key);
+                }
+                else if constexpr (std::integral<T>)
+                {
+                    return in_integer_range<T>(key) && static_cast<K>(static_cast<T>(key)) == key;
+                }
+                else if constexpr (std::integral<K>)
+                {
+                    // Every integer is in the range of the floating point
+                    // types, but its rounded value may not be in the range of K.
+                    const T value = static_cast<T>(key);
+                    return in_integer_range<K>(value) && static_cast<K>(value) == key;
+                }
+                else
+                {
+                    using common_type = std::common_type_t<T, K>;
+                    if (std::isnan(key))
+                    {
+                        return false;
+                    }
+                    if (std::isfinite(key)
+                        && std::abs(static_cast<common_type>(key))
+                               > static_cast<common_type>(std::numeric_limits<T>::max()))
+                    {
+                        return false;
+                    }
+                    return static_cast<K>(static_cast<T>(key)) == key;
+                }
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT, class K>
+            requires std::convertible_to<const K&, std::string_view>
+        struct map_key_matcher<variable_size_binary_array<T, CR, OT>, K>
+        {
+            static constexpr bool supported = true;
+
+            static validity_bitmap match(const variable_size_binary_array<T, CR, OT>& keys, const K& key)
+            {
+                const std::string_view value(key);
+                const auto bufs = get_binary_buffers(keys);
+                return match_bitmap(
+                    bufs,
+                    [&](const std::uint8_t* data, std::size_t size)
+                    {
+                        return size == value.size() && (size == 0 || std::memcmp(data, value.data(), size) == 0);
+                    }
+                );
+            }
+        };
+
+        template <std::integral IT, class K>
+        struct map_key_matcher<dictionary_encoded_array<IT>, K>
+        {
+            static constexpr bool supported = true;
+
+            static validity_bitmap match(const dictionary_encoded_array<IT>& keys, const K& key)
+            {
+                const auto dictionary = array_factory(keys.dictionary_proxy());
+                const validity_bitmap entry_matches = visit(
+                    [&key](const auto& typed_dictionary) -> validity_bitmap
+                    {
+                        using dictionary_type = std::decay_t<decltype(typed_dictionary)>;
+                        if constexpr (!is_dictionary_encoded_array<dictionary_type>::get()
+                                      && map_key_matcher<dictionary_type, K>::supported)
+                        {
+                            return map_key_matcher<dictionary_type, K>::match(typed_dictionary, key);
+                        }
+                        else
+                        {
+                            throw std::invalid_argument("the dictionary of the map keys cannot be compared to the key");
+                        }
+                    },
+                    *dictionary
+                );
+                return gather_matches(keys, entry_matches);
+            }
+        };
+
+        // Gathers the values at the given positions; map_npos gives a null.
+        template <class A>
+        struct map_value_gather
+        {
+            static constexpr bool supported = false;
+        };
+
+        template <class T>
+        struct map_value_gather<primitive_array<T>>
+        {
+            static constexpr bool supported = true;
+
+            static primitive_array<T> gather(const primitive_array<T>& items, std::span<const std::size_t> positions)
+            {
+                const typed_view<T> view(items);
+                const T* values = view.data();
+                const std::size_t n = positions.size();
+                u8_buffer<T> result(n);
+                T* out = result.data();
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const std::size_t p = positions[i];
+                    out[i] = p != map_npos ? values[p] : T{};
+                }
+                // map_npos is past the end of the items, so it gives a null.
+                return primitive_array<T>(std::move(result), gather_validity(view.validity(), positions));
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct map_value_gather<variable_size_binary_array<T, CR, OT>>
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+            static constexpr bool supported = true;
+
+            static array_type gather(const array_type& items, std::span<const std::size_t> positions)
+            {
+                const validity_view validity = make_validity_view(items.get_arrow_proxy());
+                return gather_binary(
+                    items,
+                    positions,
+                    [&](std::size_t i)
+                    {
+                        return positions[i] != map_npos && validity[positions[i]];
+                    }
+                );
+            }
+        };
+    }
+
+    template <class K>
+    array map_lookup(const map_array& ar, const K& key)
+    {
+        const validity_bitmap matches = visit(
+            [&key](const auto& keys) -> validity_bitmap
+            {
+                using keys_type = std::decay_t<decltype(keys)>;
+                if constexpr (detail::map_key_matcher<keys_type, K>::supported)
+                {
+                    return detail::map_key_matcher<keys_type, K>::match(keys, key);
+                }
+                else
+                {
+                    throw std::invalid_argument("the map keys cannot be compared to the key");
+                }
+            },
+            *ar.raw_keys()
+        );
+
+        const std::size_t n = ar.size();
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+        std::vector<std::size_t> positions(n, detail::map_npos);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (!validity[i])
+            {
+                continue;
+            }
+            const auto [first, last] = ar.value_range(i);
+            for (std::size_t j = first; j < last; ++j)
+            {
+                if (matches.test(j))
+                {
+                    positions[i] = j;
+                    break;
+                }
+            }
+        }
+
+        return visit(
+            [&positions](const auto& items) -> array
+            {
+                using items_type = std::decay_t<decltype(items)>;
+                if constexpr (detail::map_value_gather<items_type>::supported)
+                {
+                    return array(detail::map_value_gather<items_type>::gather(items, positions));
+                }
+                else
+                {
+                    throw std::invalid_argument("map_lookup only supports primitive and variable size binary values");
+                }
+            },
+            *ar.raw_items()
+        );
+    }
+}
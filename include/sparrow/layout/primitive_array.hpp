@@ -171,7 +171,7 @@ namespace sparrow
     {
         inline bool check_primitive_data_type(data_type dt)
         {
-            constexpr std::array<data_type, 14> dtypes = {
+            constexpr std::array<data_type, 12> dtypes = {
                 data_type::BOOL,
                 data_type::UINT8,
                 data_type::INT8,
@@ -183,9 +183,7 @@ namespace sparrow
                 data_type::INT64,
                 data_type::HALF_FLOAT,
                 data_type::FLOAT,
-                data_type::DOUBLE,
-                data_type::FIXED_SIZE_BINARY,
-                data_type::TIMESTAMP
+                data_type::DOUBLE
             };
             return std::find(dtypes.cbegin(), dtypes.cend(), dt) != dtypes.cend();
         }
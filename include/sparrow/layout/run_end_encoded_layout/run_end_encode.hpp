@@ -0,0 +1,468 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_array_builder.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/nullable.hpp"
+
+namespace sparrow
+{
+    namespace detail
+    {
+        template <class A>
+        struct ree_values;
+    }
+
+    /**
+     * Run-end encodes \c ar: consecutive equal elements are stored once in
+     * the values child, and the run ends child holds the logical index one
+     * past the end of each run. Null elements form runs like any other value.
+     *
+     * @param ar the array to encode.
+     * @param run_end_type the integer type of the run ends, INT16, INT32 or
+     *        INT64 as mandated by the Arrow specification. When not
+     *        specified, the smallest type that can hold the length of \c ar
+     *        is used.
+     * @throws std::invalid_argument if \c run_end_type is not supported.
+     * @throws std::length_error if \c run_end_type cannot hold the length.
+     */
+    template <class T>
+    run_end_encoded_array
+    run_end_encode(const primitive_array<T>& ar, std::optional<data_type> run_end_type = std::nullopt);
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    run_end_encoded_array run_end_encode(
+        const variable_size_binary_array<T, CR, OT>& ar,
+        std::optional<data_type> run_end_type = std::nullopt
+    );
+
+    /**
+     * Builds a run_end_encoded_array one value at a time. Appending a value
+     * equal to the last one extends the last run in O(1), so the memory used
+     * by the builder only depends on the number of runs.
+     *
+     * @tparam A the type of the values child, primitive_array<T> or
+     *         variable_size_binary_array<T, CR, OT>.
+     */
+    template <class A>
+    class ree_builder
+    {
+    public:
+
+        using array_type = A;
+        using value_type = std::remove_cvref_t<typename A::inner_const_reference>;
+        using size_type = std::size_t;
+
+        ree_builder() = default;
+
+        /// Appends \c count copies of \c value.
+        void push_back(const value_type& value, size_type count = 1);
+
+        /// Appends \c count null elements.
+        void push_back(nullval_t, size_type count = 1);
+
+        /// Number of logical elements appended so far.
+        [[nodiscard]] size_type size() const noexcept;
+        [[nodiscard]] size_type run_count() const noexcept;
+
+        /**
+         * Builds the array from the appended values and resets the builder.
+         * See run_end_encode for the meaning of \c run_end_type.
+         */
+        [[nodiscard]] run_end_encoded_array finish(std::optional<data_type> run_end_type = std::nullopt);
+
+    private:
+
+        void extend_or_add_run(bool extends, size_type count);
+
+        detail::ree_values<A> m_values;
+        std::vector<std::uint64_t> m_run_ends;
+    };
+
+    /*********************************
+     * run_end_encode implementation *
+     *********************************/
+
+    namespace detail
+    {
+        template <class F>
+        decltype(auto) visit_run_end_type(data_type dt, F&& f)
+        {
+            switch (dt)
+            {
+                case data_type::INT16:
+                    return f(std::type_identity<std::int16_t>{});
+                case data_type::INT32:
+                    return f(std::type_identity<std::int32_t>{});
+                case data_type::INT64:
+                    return f(std::type_identity<std::int64_t>{});
+                default:
+                    throw std::invalid_argument("run end type must be a signed 16, 32 or 64 bits integer");
+            }
+        }
+
+        inline data_type smallest_run_end_type(std::size_t length)
+        {
+            if (length <= static_cast<std::size_t>(std::numeric_limits<std::int16_t>::max()))
+            {
+                return data_type::INT16;
+            }
+            if (length <= static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+            {
+                return data_type::INT32;
+            }
+            return data_type::INT64;
+        }
+
+        // Assembles a run-end encoded array from its run ends and the values
+        // of its runs. The run ends child is built first, so that values are
+        // only consumed once the run end type has been checked.
+        template <class A>
+        run_end_encoded_array make_run_end_encoded_array(
+            const std::vector<std::uint64_t>& run_ends,
+            ree_values<A>& run_values,
+            std::optional<data_type> run_end_type
+        )
+        {
+            const std::uint64_t length = run_ends.empty() ? 0 : run_ends.back();
+            const data_type dt = run_end_type.value_or(smallest_run_end_type(static_cast<std::size_t>(length)));
+            arrow_proxy run_ends_proxy = visit_run_end_type(
+                dt,
+                [&]<class R>(std::type_identity<R>) -> arrow_proxy
+                {
+                    if (length > static_cast<std::uint64_t>(std::numeric_limits<R>::max()))
+                    {
+                        throw std::length_error("array length exceeds the capacity of the run end type");
+                    }
+                    u8_buffer<R> buffer(run_ends.size());
+                    R* out = buffer.data();
+                    for (std::size_t i = 0; i < run_ends.size(); ++i)
+                    {
+                        out[i] = static_cast<R>(run_ends[i]);
+                    }
+                    return array_access::extract_arrow_proxy(primitive_array<R>(std::move(buffer)));
+                }
+            );
+            arrow_proxy values = run_values.finish();
+            run_ends_proxy.set_name("run_ends");
+            values.set_name("values");
+
+            ArrowSchema schema = make_arrow_schema(
+                std::string("+r"),  // format
+                std::nullopt,       // name
+                std::nullopt,       // metadata
+                std::nullopt,       // flags
+                2,                  // n_children
+                new ArrowSchema*[2]{
+                    new ArrowSchema(run_ends_proxy.extract_schema()),
+                    new ArrowSchema(values.extract_schema())
+                },
+                nullptr  // dictionary
+            );
+            ArrowArray arr = make_arrow_array(
+                static_cast<std::int64_t>(length),  // length
+                0,                                  // null_count
+                0,                                  // offset
+                std::vector<buffer<std::uint8_t>>{},
+                2,  // n_children
+                new ArrowArray*[2]{
+                    new ArrowArray(run_ends_proxy.extract_array()),
+                    new ArrowArray(values.extract_array())
+                },
+                nullptr  // dictionary
+            );
+            return run_end_encoded_array(arrow_proxy(std::move(arr), std::move(schema)));
+        }
+
+        template <class T>
+        bool same_bits(const T& lhs, const T& rhs)
+        {
+            return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+        }
+
+        template <class CR>
+        std::string_view bytes_view(const CR& value)
+        {
+            return std::string_view(
+                reinterpret_cast<const char*>(std::ranges::data(value)),
+                std::ranges::size(value) * sizeof(std::ranges::range_value_t<CR>)
+            );
+        }
+
+        // Values of the runs appended to a ree_builder.
+        template <class T>
+        struct ree_values<primitive_array<T>>
+        {
+            std::vector<T> values;
+            std::vector<bool> validity;
+
+            bool extends(const T& value) const
+            {
+                return !values.empty() && validity.back() && same_bits(values.back(), value);
+            }
+
+            bool extends(nullval_t) const
+            {
+                return !values.empty() && !validity.back();
+            }
+
+            void push_back(const T& value)
+            {
+                values.push_back(value);
+                validity.push_back(true);
+            }
+
+            void push_back(nullval_t)
+            {
+                values.push_back(T{});
+                validity.push_back(false);
+            }
+
+            arrow_proxy finish()
+            {
+                u8_buffer<T> buffer(values);
+                validity_bitmap bitmap(validity.size(), true);
+                for (std::size_t i = 0; i < validity.size(); ++i)
+                {
+                    if (!validity[i])
+                    {
+                        bitmap.set(i, false);
+                    }
+                }
+                arrow_proxy proxy = array_access::extract_arrow_proxy(
+                    primitive_array<T>(std::move(buffer), std::move(bitmap))
+                );
+                values.clear();
+                validity.clear();
+                return proxy;
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct ree_values<variable_size_binary_array<T, CR, OT>>
+        {
+            variable_size_binary_array_builder<T, CR, OT> builder;
+            // Copy of the value of the last run, the builder does not give
+            // access to the appended values.
+            std::string last;
+            bool has_last = false;
+            bool last_valid = false;
+
+            bool extends(const CR& value) const
+            {
+                return has_last && last_valid && bytes_view(value) == last;
+            }
+
+            bool extends(nullval_t) const
+            {
+                return has_last && !last_valid;
+            }
+
+            void push_back(const CR& value)
+            {
+                builder.push_back(value);
+                last.assign(bytes_view(value));
+                has_last = true;
+                last_valid = true;
+            }
+
+            void push_back(nullval_t)
+            {
+                builder.push_back(nullval);
+                last.clear();
+                has_last = true;
+                last_valid = false;
+            }
+
+            arrow_proxy finish()
+            {
+                last.clear();
+                has_last = false;
+                return array_access::extract_arrow_proxy(builder.finish());
+            }
+        };
+    }
+
+    template <class T>
+    run_end_encoded_array run_end_encode(const primitive_array<T>& ar, std::optional<data_type> run_end_type)
+    {
+        const std::size_t size = ar.size();
+        const T* values = ar.data();
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+
+        // Boundaries are found with a flat loop comparing each element with
+        // its predecessor, which the compiler can vectorize. Two nulls are
+        // equal whatever the bytes under them.
+        std::vector<std::uint8_t> starts_run(size, 0);
+        if (validity.all_valid())
+        {
+            for (std::size_t i = 1; i < size; ++i)
+            {
+                starts_run[i] = static_cast<std::uint8_t>(!detail::same_bits(values[i], values[i - 1]));
+            }
+        }
+        else
+        {
+            std::vector<std::uint8_t> valid(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                valid[i] = static_cast<std::uint8_t>(validity[i]);
+            }
+            for (std::size_t i = 1; i < size; ++i)
+            {
+                const bool differ = !detail::same_bits(values[i], values[i - 1]);
+                starts_run[i] = static_cast<std::uint8_t>((valid[i] != valid[i - 1]) | (valid[i] & differ));
+            }
+        }
+
+        std::vector<std::uint64_t> run_ends;
+        detail::ree_values<primitive_array<T>> run_values;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (i == 0 || starts_run[i] != 0)
+            {
+                if (i != 0)
+                {
+                    run_ends.push_back(i);
+                }
+                if (validity[i])
+                {
+                    run_values.push_back(values[i]);
+                }
+                else
+                {
+                    run_values.push_back(nullval);
+                }
+            }
+        }
+        if (size != 0)
+        {
+            run_ends.push_back(size);
+        }
+        return detail::make_run_end_encoded_array(run_ends, run_values, run_end_type);
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    run_end_encoded_array
+    run_end_encode(const variable_size_binary_array<T, CR, OT>& ar, std::optional<data_type> run_end_type)
+    {
+        ree_builder<variable_size_binary_array<T, CR, OT>> builder;
+        for (const auto& value : ar)
+        {
+            if (value.has_value())
+            {
+                builder.push_back(value.get());
+            }
+            else
+            {
+                builder.push_back(nullval);
+            }
+        }
+        return builder.finish(run_end_type);
+    }
+
+    /******************************
+     * ree_builder implementation *
+     ******************************/
+
+    template <class A>
+    void ree_builder<A>::push_back(const value_type& value, size_type count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        const bool extends = m_values.extends(value);
+        if (!extends)
+        {
+            m_values.push_back(value);
+        }
+        extend_or_add_run(extends, count);
+    }
+
+    template <class A>
+    void ree_builder<A>::push_back(nullval_t, size_type count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        const bool extends = m_values.extends(nullval);
+        if (!extends)
+        {
+            m_values.push_back(nullval);
+        }
+        extend_or_add_run(extends, count);
+    }
+
+    template <class A>
+    auto ree_builder<A>::size() const noexcept -> size_type
+    {
+        return m_run_ends.empty() ? 0 : static_cast<size_type>(m_run_ends.back());
+    }
+
+    template <class A>
+    auto ree_builder<A>::run_count() const noexcept -> size_type
+    {
+        return m_run_ends.size();
+    }
+
+    template <class A>
+    run_end_encoded_array ree_builder<A>::finish(std::optional<data_type> run_end_type)
+    {
+        // The builder is only reset once the array is built, so that it is
+        // left unchanged if the run end type cannot hold its length.
+        run_end_encoded_array result = detail::make_run_end_encoded_array(m_run_ends, m_values, run_end_type);
+        m_run_ends.clear();
+        return result;
+    }
+
+    template <class A>
+    void ree_builder<A>::extend_or_add_run(bool extends, size_type count)
+    {
+        const auto end = static_cast<std::uint64_t>(size() + count);
+        if (extends)
+        {
+            m_run_ends.back() = end;
+        }
+        else
+        {
+            m_run_ends.push_back(end);
+        }
+    }
+}
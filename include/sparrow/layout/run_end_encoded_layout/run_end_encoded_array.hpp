@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
 #include "sparrow/array_factory.hpp"
@@ -24,6 +28,7 @@
 namespace sparrow
 {
     class run_end_encoded_array;
+    class run_end_encoded_cursor;
 
     namespace detail
     {
@@ -72,12 +77,55 @@ namespace sparrow
 
         SPARROW_API size_type size() const;
 
+        // Run ends are signed 16, 32 or 64 bits integers as the Arrow
+        // specification mandates; unsigned ones are still read so that
+        // arrays built by earlier versions remain usable.
+        using run_ends_type = std::variant<
+            const std::uint16_t*,
+            const std::uint32_t*,
+            const std::uint64_t*,
+            const std::int16_t*,
+            const std::int32_t*,
+            const std::int64_t*>;
+
+        // Number of runs, i.e. length of the run ends and encoded values children.
+        SPARROW_API size_type run_count() const;
+        // Pointer to the accumulated lengths of the runs.
+        SPARROW_API const run_ends_type& run_ends() const;
+        // Values of the runs, value of run i is element i of this array.
+        SPARROW_API const array_wrapper& encoded_values() const;
+
+        // Index of the run holding the logical element i, run_count() if i is
+        // past the last run. Arrays with many runs build a sampled skip index
+        // of the run ends on the first call, so that the search starts in a
+        // block of skip_index_stride runs.
+        SPARROW_API size_type find_run(std::uint64_t i) const;
+        // Same as find_run(i), galloping forward or backward from the run
+        // hint: the cost is logarithmic in the distance between hint and the
+        // result, O(1) for near-sequential accesses.
+        SPARROW_API size_type find_run(std::uint64_t i, size_type hint) const;
+
+        static constexpr size_type skip_index_stride = 64;
+        static constexpr size_type skip_index_min_runs = size_type(1) << 16;
+
     private:
 
-        using acc_length_ptr_variant_type = std::variant< const std::uint16_t*, const std::uint32_t*,const std::uint64_t*> ;
+        // Every skip_index_stride-th run end, built once on demand.
+        struct skip_index
+        {
+            std::once_flag built;
+            std::vector<std::uint64_t> samples;
+        };
+
+        using acc_length_ptr_variant_type = run_ends_type;
 
         SPARROW_API static acc_length_ptr_variant_type get_acc_lengths_ptr(const array_wrapper& ar);
         SPARROW_API std::uint64_t get_run_length(std::uint64_t run_index) const;
+        SPARROW_API std::uint64_t get_run_end(std::uint64_t run_index) const;
+        SPARROW_API const std::vector<std::uint64_t>& get_skip_index() const;
+        // Moves hint to the run holding i; to an empty run past the last one
+        // if i is past the end of the array.
+        SPARROW_API void update_run_hint(std::uint64_t i, detail::ree_run_hint& hint) const;
 
         arrow_proxy  extract_arrow_proxy() &&;
         [[nodiscard]] arrow_proxy& get_arrow_proxy();
@@ -89,10 +137,12 @@ namespace sparrow
         cloning_ptr<array_wrapper> p_acc_lengths_array;
         cloning_ptr<array_wrapper> p_encoded_values_array;
         acc_length_ptr_variant_type m_acc_lengths;
+        std::unique_ptr<skip_index> p_skip_index;
 
         // friend classes
         friend class run_encoded_array_iterator<false>;
         friend class run_encoded_array_iterator<true>;
+        friend class run_end_encoded_cursor;
         template <class T>
         friend class array_wrapper_impl;
         friend class detail::array_access;
@@ -101,6 +151,41 @@ namespace sparrow
     SPARROW_API
     bool operator==(const run_end_encoded_array& lhs, const run_end_encoded_array& rhs);
 
+    /**
+     * Hinted access to the elements of a run_end_encoded_array.
+     *
+     * The cursor remembers the run of the last accessed element: accessing
+     * an element of the same run is O(1), and other runs are found by
+     * galloping from it. Near-sequential access patterns, such as joins on
+     * sorted keys, thus cost amortized O(1) per access instead of a binary
+     * search over all the run ends.
+     *
+     * The cursor is invalidated by any operation invalidating the array.
+     */
+    class run_end_encoded_cursor
+    {
+    public:
+
+        using size_type = std::size_t;
+
+        explicit run_end_encoded_cursor(const run_end_encoded_array& ar);
+
+        // Moves the cursor to the logical element i and returns the index of
+        // its run.
+        size_type seek(std::uint64_t i);
+        array_traits::const_reference operator[](std::uint64_t i);
+
+        // Run of the last accessed element and its logical bounds [begin, end).
+        [[nodiscard]] size_type run() const noexcept;
+        [[nodiscard]] std::uint64_t run_begin() const noexcept;
+        [[nodiscard]] std::uint64_t run_end() const noexcept;
+
+    private:
+
+        const run_end_encoded_array* p_array;
+        detail::ree_run_hint m_hint;
+    };
+
     /****************************************
      * run_end_encoded_array implementation *
      ****************************************/
@@ -111,6 +196,7 @@ namespace sparrow
         , p_acc_lengths_array(array_factory(m_proxy.children()[0].view()))
         , p_encoded_values_array(array_factory(m_proxy.children()[1].view()))
         , m_acc_lengths(run_end_encoded_array::get_acc_lengths_ptr(*p_acc_lengths_array))
+        , p_skip_index(std::make_unique<skip_index>())
     {
     }
 
@@ -128,6 +214,7 @@ namespace sparrow
             p_acc_lengths_array = array_factory(m_proxy.children()[0].view());
             p_encoded_values_array = array_factory(m_proxy.children()[1].view());
             m_acc_lengths = run_end_encoded_array::get_acc_lengths_ptr(*p_acc_lengths_array);
+            p_skip_index = std::make_unique<skip_index>();
         }
         return *this;
     }
@@ -137,6 +224,21 @@ namespace sparrow
         return m_proxy.length();
     }
 
+    inline auto run_end_encoded_array::run_count() const -> size_type
+    {
+        return static_cast<size_type>(m_encoded_length);
+    }
+
+    inline auto run_end_encoded_array::run_ends() const -> const run_ends_type&
+    {
+        return m_acc_lengths;
+    }
+
+    inline auto run_end_encoded_array::encoded_values() const -> const array_wrapper&
+    {
+        return *p_encoded_values_array;
+    }
+
     inline auto run_end_encoded_array::get_run_length(std::uint64_t run_index) const -> std::uint64_t
     {
 
@@ -157,6 +259,17 @@ namespace sparrow
         return ret;
     }
     
+    inline auto run_end_encoded_array::get_run_end(std::uint64_t run_index) const -> std::uint64_t
+    {
+        return std::visit(
+            [run_index](auto&& acc_lengths_ptr) -> std::uint64_t
+            {
+                return static_cast<std::uint64_t>(acc_lengths_ptr[run_index]);
+            },
+            m_acc_lengths
+        );
+    }
+
     inline arrow_proxy& run_end_encoded_array::get_arrow_proxy()
     {
         return m_proxy;
@@ -210,4 +323,43 @@ namespace sparrow
     {
         return std::ranges::equal(lhs, rhs);
     }
+
+    /*****************************************
+     * run_end_encoded_cursor implementation *
+     *****************************************/
+
+    inline run_end_encoded_cursor::run_end_encoded_cursor(const run_end_encoded_array& ar)
+        : p_array(&ar)
+    {
+    }
+
+    inline auto run_end_encoded_cursor::seek(std::uint64_t i) -> size_type
+    {
+        if (!m_hint.contains(i))
+        {
+            p_array->update_run_hint(i, m_hint);
+        }
+        return static_cast<size_type>(m_hint.run);
+    }
+
+    inline auto run_end_encoded_cursor::operator[](std::uint64_t i) -> array_traits::const_reference
+    {
+        SPARROW_ASSERT_TRUE(i < p_array->size());
+        return array_element(p_array->encoded_values(), seek(i));
+    }
+
+    inline auto run_end_encoded_cursor::run() const noexcept -> size_type
+    {
+        return static_cast<size_type>(m_hint.run);
+    }
+
+    inline std::uint64_t run_end_encoded_cursor::run_begin() const noexcept
+    {
+        return m_hint.begin;
+    }
+
+    inline std::uint64_t run_end_encoded_cursor::run_end() const noexcept
+    {
+        return m_hint.end;
+    }
 } // namespace sparrow
@@ -29,32 +29,68 @@ namespace sparrow
 
     class run_end_encoded_array;
 
+    namespace detail
+    {
+        // Run of the last accessed element of a run_end_encoded_array and
+        // the logical bounds [begin, end) of that run.
+        struct ree_run_hint
+        {
+            std::uint64_t run = 0;
+            std::uint64_t begin = 0;
+            std::uint64_t end = 0;
+
+            bool contains(std::uint64_t i) const noexcept
+            {
+                return begin <= i && i < end;
+            }
+        };
+    }
+
     // this iteratas over the **actual** values of the run encoded array
     // Ie nullabes values, not values !!! 
+    // Moving the iterator within the current run is O(1); moving it to
+    // another run gallops from the current one, see run_end_encoded_array::find_run.
     template<bool CONST>
     class run_encoded_array_iterator : public iterator_base<
         run_encoded_array_iterator<CONST>,
         array_traits::const_reference,
-        std::forward_iterator_tag,
+        std::random_access_iterator_tag,
         array_traits::const_reference
     >
     {   
 
     private:
+        using self_type = run_encoded_array_iterator<CONST>;
+        using base_type = iterator_base<
+            self_type,
+            array_traits::const_reference,
+            std::random_access_iterator_tag,
+            array_traits::const_reference
+        >;
         using array_ptr_type = std::conditional_t<CONST, const run_end_encoded_array *, run_end_encoded_array*>;
     public:
+        using difference_type = typename base_type::difference_type;
+
         run_encoded_array_iterator() = default;
+        // run_end_index is a hint for the run holding index.
         run_encoded_array_iterator(array_ptr_type array_ptr, std::uint64_t index, std::uint64_t run_end_index);
     private:
 
         bool equal(const run_encoded_array_iterator& rhs) const;
+        bool less_than(const run_encoded_array_iterator& rhs) const;
+        difference_type distance_to(const run_encoded_array_iterator& rhs) const;
         void increment();
+        void decrement();
+        void advance(difference_type n);
         array_traits::const_reference dereference() const;
+
+        // Updates m_hint after m_index left the current run.
+        void seek();
+
         array_ptr_type p_array = nullptr;
         array_wrapper * p_encoded_values_array = nullptr;
         std::uint64_t m_index = 0 ;          // the current index / the index the user sees
-        std::uint64_t m_run_end_index = 0;  // the current index in the run ends array
-        std::uint64_t m_runs_left = 0;      // the number of runs left in the current run
+        detail::ree_run_hint m_hint;         // the current run and its bounds
 
         friend class iterator_access;
     };
@@ -64,10 +100,10 @@ namespace sparrow
         : 
         p_array(array_ptr),
         p_encoded_values_array(array_ptr->p_encoded_values_array.get()),
-        m_index(index), 
-        m_run_end_index(run_end_index),
-        m_runs_left(array_ptr->get_run_length(index))
+        m_index(index)
     {
+        m_hint.run = run_end_index;
+        seek();
     }
 
     template<bool CONST>
@@ -76,22 +112,58 @@ namespace sparrow
         return m_index == rhs.m_index;
     }
 
+    template<bool CONST>
+    bool run_encoded_array_iterator<CONST>::less_than(const run_encoded_array_iterator& rhs) const
+    {
+        return m_index < rhs.m_index;
+    }
+
+    template<bool CONST>
+    auto run_encoded_array_iterator<CONST>::distance_to(const run_encoded_array_iterator& rhs) const -> difference_type
+    {
+        return static_cast<difference_type>(rhs.m_index) - static_cast<difference_type>(m_index);
+    }
+
     template<bool CONST>
     void run_encoded_array_iterator<CONST>::increment()
     {
         ++m_index;
-        --m_runs_left;
-        if(m_runs_left == 0 && m_index < p_array->size())
+        if(m_index >= m_hint.end)
         {
-            ++m_run_end_index;
-            m_runs_left = p_array->get_run_length(m_run_end_index);
+            seek();
         }
     }
 
+    template<bool CONST>
+    void run_encoded_array_iterator<CONST>::decrement()
+    {
+        --m_index;
+        if(m_index < m_hint.begin)
+        {
+            seek();
+        }
+    }
+
+    template<bool CONST>
+    void run_encoded_array_iterator<CONST>::advance(difference_type n)
+    {
+        m_index = static_cast<std::uint64_t>(static_cast<difference_type>(m_index) + n);
+        if(!m_hint.contains(m_index))
+        {
+            seek();
+        }
+    }
+
+    template<bool CONST>
+    void run_encoded_array_iterator<CONST>::seek()
+    {
+        p_array->update_run_hint(m_index, m_hint);
+    }
+
     template<bool CONST>
     typename array_traits::const_reference run_encoded_array_iterator<CONST>::dereference() const
     {
-        return array_element(*p_encoded_values_array, static_cast<std::size_t>(m_run_end_index));
+        return array_element(*p_encoded_values_array, static_cast<std::size_t>(m_hint.run));
     }
 
 } // namespace sparrow
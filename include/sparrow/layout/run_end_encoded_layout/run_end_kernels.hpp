@@ -0,0 +1,740 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encode.hpp"
+#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/nullable.hpp"
+
+namespace sparrow
+{
+    /**
+     * Non-owning typed view over the runs of a run_end_encoded_array.
+     *
+     * The type of the values child and the run ends are resolved once, when
+     * the view is built, so that visiting the runs does not go through
+     * array_element or a visit of the run ends variant. The runs cover the
+     * logical elements [0, size()) of the array, as operator[] does; the last
+     * run is clipped to size().
+     *
+     * The view is invalidated by any operation invalidating the buffers of
+     * the viewed array.
+     *
+     * @tparam A the type of the values child, primitive_array<T> or
+     *         variable_size_binary_array<T, CR, OT>.
+     */
+    template <class A>
+    class typed_run_view
+    {
+    public:
+
+        using array_type = A;
+        using value_type = std::remove_cvref_t<typename A::inner_const_reference>;
+        using size_type = std::size_t;
+
+        /**
+         * Throws std::runtime_error if the values child of \c ar is not an
+         * array of type \c A.
+         */
+        explicit typed_run_view(const run_end_encoded_array& ar);
+
+        /// Number of logical elements.
+        [[nodiscard]] size_type size() const noexcept;
+        [[nodiscard]] size_type run_count() const noexcept;
+        [[nodiscard]] const array_type& values() const noexcept;
+
+        /// Logical index one past the last element of run \c r.
+        [[nodiscard]] size_type run_end(size_type r) const;
+        [[nodiscard]] size_type run_length(size_type r) const;
+
+        [[nodiscard]] bool has_value(size_type r) const;
+        /// Value of run \c r, a default constructed value if the run is null.
+        [[nodiscard]] value_type value(size_type r) const;
+
+        /**
+         * Calls \c f(nullable<value_type>, run_length) for each run, in
+         * order.
+         */
+        template <class F>
+        void for_each_run(F&& f) const;
+
+    private:
+
+        std::vector<size_type> m_run_ends;
+        const array_type* p_values;
+    };
+
+    /**
+     * Kernels over run_end_encoded_array that do O(runs) work: values are
+     * visited once per run and weighted by the run length. \c A is the type
+     * of the values child, as in typed_run_view; \c T is the value type of a
+     * primitive values child.
+     */
+
+    /// Number of null logical elements.
+    [[nodiscard]] std::size_t ree_null_count(const run_end_encoded_array& ar);
+
+    template <class T>
+    using ree_sum_type = std::conditional_t<
+        std::floating_point<T>,
+        double,
+        std::conditional_t<std::signed_integral<T>, std::int64_t, std::uint64_t>>;
+
+    /**
+     * Sum of the non-null logical elements, computed as the sum of the run
+     * values weighted by the run lengths. Integer sums wrap on overflow.
+     */
+    template <class T>
+        requires(std::integral<T> || std::floating_point<T>) && (!std::same_as<T, bool>)
+    [[nodiscard]] ree_sum_type<T> ree_sum(const run_end_encoded_array& ar);
+
+    /// Mean of the non-null logical elements, std::nullopt if there is none.
+    template <class T>
+        requires(std::integral<T> || std::floating_point<T>) && (!std::same_as<T, bool>)
+    [[nodiscard]] std::optional<double> ree_mean(const run_end_encoded_array& ar);
+
+    template <class A>
+    [[nodiscard]] std::optional<typename typed_run_view<A>::value_type> ree_min(const run_end_encoded_array& ar);
+
+    template <class A>
+    [[nodiscard]] std::optional<typename typed_run_view<A>::value_type> ree_max(const run_end_encoded_array& ar);
+
+    /// Number of logical elements whose value satisfies \c pred.
+    template <class A, class P>
+    [[nodiscard]] std::size_t ree_count_if(const run_end_encoded_array& ar, P&& pred);
+
+    /**
+     * Bitmap with one bit per logical element, set if the element value
+     * satisfies \c pred. Null elements never match. The predicate is
+     * evaluated once per run.
+     */
+    template <class A, class P>
+    [[nodiscard]] validity_bitmap ree_match(const run_end_encoded_array& ar, P&& pred);
+
+    /// Elements equal to \c value.
+    template <class A, class U>
+    [[nodiscard]] validity_bitmap ree_equal(const run_end_encoded_array& ar, const U& value);
+
+    /**
+     * Run-end encoded array of the elements whose value satisfies \c pred,
+     * in order. Adjacent kept runs holding the same value are merged. See
+     * run_end_encode for the meaning of \c run_end_type.
+     */
+    template <class A, class P>
+    [[nodiscard]] run_end_encoded_array
+    ree_filter(const run_end_encoded_array& ar, P&& pred, std::optional<data_type> run_end_type = std::nullopt);
+
+    /**
+     * Expands \c ar into a dense array of type \c A, the type of its values
+     * child. The values of each run are broadcast into a preallocated buffer,
+     * the validity bitmap is written a byte at a time, and the bytes of
+     * variable size binary values are copied with memcpy.
+     *
+     * @throws std::runtime_error if the values child is not an array of type \c A.
+     * @throws std::length_error if the decoded binary data exceeds the capacity
+     *         of the offset type.
+     */
+    template <class A>
+    [[nodiscard]] A decode_run_end_encoded(const run_end_encoded_array& ar);
+
+    /**
+     * Expands \c ar into a dense array of the type of its values child. The
+     * type is resolved once, then the array is decoded as above.
+     *
+     * @throws std::invalid_argument if the values child is neither a primitive
+     *         nor a variable size binary array.
+     */
+    [[nodiscard]] array decode_run_end_encoded(const run_end_encoded_array& ar);
+
+    /*********************************
+     * typed_run_view implementation *
+     *********************************/
+
+    namespace detail
+    {
+        // Run ends of ar as size_t, clipped to the length of ar; runs
+        // starting past the length are dropped.
+        inline std::vector<std::size_t> clipped_run_ends(const run_end_encoded_array& ar)
+        {
+            const std::size_t size = ar.size();
+            std::vector<std::size_t> result;
+            if (size == 0)
+            {
+                return result;
+            }
+            std::visit(
+                [&](const auto* run_ends)
+                {
+                    const std::size_t count = ar.run_count();
+                    result.reserve(count);
+                    for (std::size_t r = 0; r < count && (result.empty() || result.back() < size); ++r)
+                    {
+                        result.push_back(std::min(static_cast<std::size_t>(run_ends[r]), size));
+                    }
+                },
+                ar.run_ends()
+            );
+            return result;
+        }
+
+        template <class A>
+        const A& checked_run_values(const array_wrapper& values)
+        {
+            if (values.get_arrow_proxy().data_type() != get_data_type_from_array<A>::get())
+            {
+                throw std::runtime_error("The values of the run end encoded array do not hold the requested array type");
+            }
+            return unwrap_array<A>(values);
+        }
+    }
+
+    template <class A>
+    typed_run_view<A>::typed_run_view(const run_end_encoded_array& ar)
+        : m_run_ends(detail::clipped_run_ends(ar))
+        , p_values(&detail::checked_run_values<A>(ar.encoded_values()))
+    {
+        SPARROW_ASSERT_TRUE(m_run_ends.size() <= p_values->size());
+    }
+
+    template <class A>
+    auto typed_run_view<A>::size() const noexcept -> size_type
+    {
+        return m_run_ends.empty() ? 0 : m_run_ends.back();
+    }
+
+    template <class A>
+    auto typed_run_view<A>::run_count() const noexcept -> size_type
+    {
+        return m_run_ends.size();
+    }
+
+    template <class A>
+    auto typed_run_view<A>::values() const noexcept -> const array_type&
+    {
+        return *p_values;
+    }
+
+    template <class A>
+    auto typed_run_view<A>::run_end(size_type r) const -> size_type
+    {
+        SPARROW_ASSERT_TRUE(r < run_count());
+        return m_run_ends[r];
+    }
+
+    template <class A>
+    auto typed_run_view<A>::run_length(size_type r) const -> size_type
+    {
+        SPARROW_ASSERT_TRUE(r < run_count());
+        return r == 0 ? m_run_ends[0] : m_run_ends[r] - m_run_ends[r - 1];
+    }
+
+    template <class A>
+    bool typed_run_view<A>::has_value(size_type r) const
+    {
+        SPARROW_ASSERT_TRUE(r < run_count());
+        return p_values->has_value(r);
+    }
+
+    template <class A>
+    auto typed_run_view<A>::value(size_type r) const -> value_type
+    {
+        SPARROW_ASSERT_TRUE(r < run_count());
+        const auto element = (*p_values)[r];
+        return element.has_value() ? value_type(element.get()) : value_type{};
+    }
+
+    template <class A>
+    template <class F>
+    void typed_run_view<A>::for_each_run(F&& f) const
+    {
+        size_type begin = 0;
+        for (size_type r = 0; r < m_run_ends.size(); ++r)
+        {
+            const auto element = (*p_values)[r];
+            const size_type length = m_run_ends[r] - begin;
+            if (element.has_value())
+            {
+                f(nullable<value_type>(value_type(element.get())), length);
+            }
+            else
+            {
+                f(nullable<value_type>(value_type{}, false), length);
+            }
+            begin = m_run_ends[r];
+        }
+    }
+
+    /**********************************
+     * run end kernels implementation *
+     **********************************/
+
+    inline std::size_t ree_null_count(const run_end_encoded_array& ar)
+    {
+        const std::vector<std::size_t> run_ends = detail::clipped_run_ends(ar);
+        const validity_view validity = detail::make_validity_view(ar.encoded_values().get_arrow_proxy());
+        if (validity.all_valid())
+        {
+            return 0;
+        }
+        std::size_t result = 0;
+        std::size_t begin = 0;
+        for (std::size_t r = 0; r < run_ends.size(); ++r)
+        {
+            if (!validity[r])
+            {
+                result += run_ends[r] - begin;
+            }
+            begin = run_ends[r];
+        }
+        return result;
+    }
+
+    namespace detail
+    {
+        // Calls f(value, run_length) for each non-null run of a primitive
+        // values child, reading the values buffer directly.
+        template <class T, class F>
+        void for_each_valid_run(const run_end_encoded_array& ar, F&& f)
+        {
+            const std::vector<std::size_t> run_ends = clipped_run_ends(ar);
+            const typed_view<T> values(checked_run_values<primitive_array<T>>(ar.encoded_values()));
+            const T* data = values.data();
+            const validity_view& validity = values.validity();
+            const bool all_valid = validity.all_valid();
+            std::size_t begin = 0;
+            for (std::size_t r = 0; r < run_ends.size(); ++r)
+            {
+                if (all_valid || validity[r])
+                {
+                    f(data[r], run_ends[r] - begin);
+                }
+                begin = run_ends[r];
+            }
+        }
+    }
+
+    template <class T>
+        requires(std::integral<T> || std::floating_point<T>) && (!std::same_as<T, bool>)
+    ree_sum_type<T> ree_sum(const run_end_encoded_array& ar)
+    {
+        if constexpr (std::floating_point<T>)
+        {
+            double result = 0.;
+            detail::for_each_valid_run<T>(
+                ar,
+                [&result](T value, std::size_t length)
+                {
+                    result += static_cast<double>(value) * static_cast<double>(length);
+                }
+            );
+            return result;
+        }
+        else
+        {
+            // Unsigned arithmetic so that overflow wraps instead of being
+            // undefined behavior.
+            std::uint64_t result = 0;
+            detail::for_each_valid_run<T>(
+                ar,
+                [&result](T value, std::size_t length)
+                {
+                    result += static_cast<std::uint64_t>(static_cast<ree_sum_type<T>>(value))
+                              * static_cast<std::uint64_t>(length);
+                }
+            );
+            return static_cast<ree_sum_type<T>>(result);
+        }
+    }
+
+    template <class T>
+        requires(std::integral<T> || std::floating_point<T>) && (!std::same_as<T, bool>)
+    std::optional<double> ree_mean(const run_end_encoded_array& ar)
+    {
+        double sum = 0.;
+        std::size_t count = 0;
+        detail::for_each_valid_run<T>(
+            ar,
+            [&](T value, std::size_t length)
+            {
+                sum += static_cast<double>(value) * static_cast<double>(length);
+                count += length;
+            }
+        );
+        if (count == 0)
+        {
+            return std::nullopt;
+        }
+        return sum / static_cast<double>(count);
+    }
+
+    namespace detail
+    {
+        template <class A, class C>
+        std::optional<typename typed_run_view<A>::value_type>
+        ree_extremum(const run_end_encoded_array& ar, C&& is_better)
+        {
+            using value_type = typename typed_run_view<A>::value_type;
+            std::optional<value_type> result;
+            const typed_run_view<A> view(ar);
+            view.for_each_run(
+                [&](const nullable<value_type>& value, std::size_t length)
+                {
+                    if (value.has_value() && length != 0 && (!result.has_value() || is_better(value.get(), *result)))
+                    {
+                        result = value.get();
+                    }
+                }
+            );
+            return result;
+        }
+    }
+
+    template <class A>
+    std::optional<typename typed_run_view<A>::value_type> ree_min(const run_end_encoded_array& ar)
+    {
+        return detail::ree_extremum<A>(
+            ar,
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs < rhs;
+            }
+        );
+    }
+
+    template <class A>
+    std::optional<typename typed_run_view<A>::value_type> ree_max(const run_end_encoded_array& ar)
+    {
+        return detail::ree_extremum<A>(
+            ar,
+            [](const auto& lhs, const auto& rhs)
+            {
+                return rhs < lhs;
+            }
+        );
+    }
+
+    template <class A, class P>
+    std::size_t ree_count_if(const run_end_encoded_array& ar, P&& pred)
+    {
+        using value_type = typename typed_run_view<A>::value_type;
+        std::size_t result = 0;
+        typed_run_view<A>(ar).for_each_run(
+            [&](const nullable<value_type>& value, std::size_t length)
+            {
+                if (value.has_value() && pred(value.get()))
+                {
+                    result += length;
+                }
+            }
+        );
+        return result;
+    }
+
+    template <class A, class P>
+    validity_bitmap ree_match(const run_end_encoded_array& ar, P&& pred)
+    {
+        using value_type = typename typed_run_view<A>::value_type;
+        const typed_run_view<A> view(ar);
+        validity_bitmap result(view.size(), false);
+        std::size_t begin = 0;
+        view.for_each_run(
+            [&](const nullable<value_type>& value, std::size_t length)
+            {
+                if (value.has_value() && pred(value.get()))
+                {
+                    for (std::size_t i = begin; i < begin + length; ++i)
+                    {
+                        result.set(i, true);
+                    }
+                }
+                begin += length;
+            }
+        );
+        return result;
+    }
+
+    template <class A, class U>
+    validity_bitmap ree_equal(const run_end_encoded_array& ar, const U& value)
+    {
+        return ree_match<A>(
+            ar,
+            [&value](const auto& element)
+            {
+                return element == value;
+            }
+        );
+    }
+
+    template <class A, class P>
+    run_end_encoded_array ree_filter(const run_end_encoded_array& ar, P&& pred, std::optional<data_type> run_end_type)
+    {
+        using value_type = typename typed_run_view<A>::value_type;
+        ree_builder<A> builder;
+        typed_run_view<A>(ar).for_each_run(
+            [&](const nullable<value_type>& value, std::size_t length)
+            {
+                if (value.has_value() && pred(value.get()))
+                {
+                    builder.push_back(value.get(), length);
+                }
+            }
+        );
+        return builder.finish(run_end_type);
+    }
+
+    /*****************************************
+     * decode_run_end_encoded implementation *
+     *****************************************/
+
+    namespace detail
+    {
+        // Clears the bits [begin, end) of data, a whole byte at a time
+        // except at both ends of the range.
+        inline void clear_bit_range(std::uint8_t* data, std::size_t begin, std::size_t end)
+        {
+            if (begin >= end)
+            {
+                return;
+            }
+            const std::size_t first_byte = begin / 8;
+            const std::size_t last_byte = (end - 1) / 8;
+            const auto first_mask = static_cast<std::uint8_t>(0xFF << (begin % 8));
+            const auto last_mask = static_cast<std::uint8_t>(0xFF >> (7 - (end - 1) % 8));
+            if (first_byte == last_byte)
+            {
+                data[first_byte] &= static_cast<std::uint8_t>(~(first_mask & last_mask));
+                return;
+            }
+            data[first_byte] &= static_cast<std::uint8_t>(~first_mask);
+            std::memset(data + first_byte + 1, 0, last_byte - first_byte - 1);
+            data[last_byte] &= static_cast<std::uint8_t>(~last_mask);
+        }
+
+        // Validity bitmap of the decoded array: all bits are set, then the
+        // bits of the null runs are cleared. Returns the bitmap and the
+        // number of null elements.
+        inline std::pair<buffer<std::uint8_t>, std::size_t>
+        expand_validity(const std::vector<std::size_t>& run_ends, const validity_view& validity)
+        {
+            const std::size_t size = run_ends.empty() ? 0 : run_ends.back();
+            buffer<std::uint8_t> result((size + 7) / 8, std::uint8_t(0xFF));
+            std::size_t null_count = 0;
+            if (!validity.all_valid())
+            {
+                std::size_t begin = 0;
+                for (std::size_t r = 0; r < run_ends.size(); ++r)
+                {
+                    if (!validity[r])
+                    {
+                        clear_bit_range(result.data(), begin, run_ends[r]);
+                        null_count += run_ends[r] - begin;
+                    }
+                    begin = run_ends[r];
+                }
+            }
+            return {std::move(result), null_count};
+        }
+
+        inline arrow_proxy make_decoded_proxy(
+            data_type dt,
+            std::size_t size,
+            std::size_t null_count,
+            std::vector<buffer<std::uint8_t>>&& buffers
+        )
+        {
+            ArrowSchema schema = make_arrow_schema(
+                data_type_to_format(dt),
+                std::nullopt,  // name
+                std::nullopt,  // metadata
+                std::nullopt,  // flags
+                0,             // n_children
+                nullptr,       // children
+                nullptr        // dictionary
+            );
+            ArrowArray arr = make_arrow_array(
+                static_cast<std::int64_t>(size),        // length
+                static_cast<std::int64_t>(null_count),  // null_count
+                0,                                      // offset
+                std::move(buffers),
+                0,        // n_children
+                nullptr,  // children
+                nullptr   // dictionary
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+
+        template <class A>
+        struct ree_decoder
+        {
+            static constexpr bool supported = false;
+        };
+
+        template <class T>
+        struct ree_decoder<primitive_array<T>>
+        {
+            static constexpr bool supported = true;
+
+            static primitive_array<T> decode(const run_end_encoded_array& ar)
+            {
+                const std::vector<std::size_t> run_ends = clipped_run_ends(ar);
+                const typed_view<T> values(checked_run_values<primitive_array<T>>(ar.encoded_values()));
+                const std::size_t size = run_ends.empty() ? 0 : run_ends.back();
+
+                buffer<std::uint8_t> data_buffer(size * sizeof(T), std::uint8_t(0));
+                T* out = data_buffer.template data<T>();
+                const T* run_values = values.data();
+                std::size_t begin = 0;
+                for (std::size_t r = 0; r < run_ends.size(); ++r)
+                {
+                    std::fill(out + begin, out + run_ends[r], run_values[r]);
+                    begin = run_ends[r];
+                }
+
+                auto [validity, null_count] = expand_validity(run_ends, values.validity());
+                std::vector<buffer<std::uint8_t>> buffers(2);
+                buffers[0] = std::move(validity);
+                buffers[1] = std::move(data_buffer);
+                return primitive_array<T>(
+                    make_decoded_proxy(arrow_traits<T>::type_id, size, null_count, std::move(buffers))
+                );
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct ree_decoder<variable_size_binary_array<T, CR, OT>>
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+            static constexpr bool supported = true;
+
+            static array_type decode(const run_end_encoded_array& ar)
+            {
+                const std::vector<std::size_t> run_ends = clipped_run_ends(ar);
+                const array_type& values = checked_run_values<array_type>(ar.encoded_values());
+                const binary_buffers<OT> bufs = get_binary_buffers(values);
+                const validity_view validity = make_validity_view(values.get_arrow_proxy());
+                const std::size_t size = run_ends.empty() ? 0 : run_ends.back();
+
+                // Offsets are expanded first, so that the data buffer is
+                // allocated once.
+                buffer<std::uint8_t> offset_buffer((size + 1) * sizeof(OT), std::uint8_t(0));
+                OT* offsets = offset_buffer.template data<OT>();
+                std::size_t total_size = 0;
+                std::size_t begin = 0;
+                for (std::size_t r = 0; r < run_ends.size(); ++r)
+                {
+                    const std::size_t value_size = validity[r] ? bufs.value_size(r) : 0;
+                    if (value_size != 0
+                        && (run_ends[r] - begin) > (static_cast<std::size_t>(std::numeric_limits<OT>::max()) - total_size) / value_size)
+                    {
+                        throw std::length_error("variable size binary data exceeds the capacity of the offset type");
+                    }
+                    for (std::size_t i = begin; i < run_ends[r]; ++i)
+                    {
+                        total_size += value_size;
+                        offsets[i + 1] = static_cast<OT>(total_size);
+                    }
+                    begin = run_ends[r];
+                }
+
+                // The value of a run is copied once, then the copied bytes
+                // are doubled until the run is filled.
+                buffer<std::uint8_t> data_buffer(total_size, std::uint8_t(0));
+                std::uint8_t* data = data_buffer.data();
+                begin = 0;
+                for (std::size_t r = 0; r < run_ends.size(); ++r)
+                {
+                    const auto run_begin = static_cast<std::size_t>(offsets[begin]);
+                    const auto run_size = static_cast<std::size_t>(offsets[run_ends[r]]) - run_begin;
+                    if (run_size != 0)
+                    {
+                        std::uint8_t* dst = data + run_begin;
+                        std::size_t filled = bufs.value_size(r);
+                        std::memcpy(dst, bufs.value_data(r), filled);
+                        while (filled < run_size)
+                        {
+                            const std::size_t count = std::min(filled, run_size - filled);
+                            std::memcpy(dst + filled, dst, count);
+                            filled += count;
+                        }
+                    }
+                    begin = run_ends[r];
+                }
+
+                auto [validity_buffer, null_count] = expand_validity(run_ends, validity);
+                std::vector<buffer<std::uint8_t>> buffers(3);
+                buffers[0] = std::move(validity_buffer);
+                buffers[1] = std::move(offset_buffer);
+                buffers[2] = std::move(data_buffer);
+                return array_type(make_decoded_proxy(
+                    get_data_type_from_array<array_type>::get(),
+                    size,
+                    null_count,
+                    std::move(buffers)
+                ));
+            }
+        };
+    }
+
+    template <class A>
+    A decode_run_end_encoded(const run_end_encoded_array& ar)
+    {
+        static_assert(detail::ree_decoder<A>::supported, "A must be a primitive or variable size binary array");
+        return detail::ree_decoder<A>::decode(ar);
+    }
+
+    inline array decode_run_end_encoded(const run_end_encoded_array& ar)
+    {
+        return visit(
+            [&ar](const auto& values) -> array
+            {
+                using values_type = std::decay_t<decltype(values)>;
+                if constexpr (detail::ree_decoder<values_type>::supported)
+                {
+                    return array(decode_run_end_encoded<values_type>(ar));
+                }
+                else
+                {
+                    throw std::invalid_argument("run end encoded values must be a primitive or variable size binary array");
+                }
+            },
+            ar.encoded_values()
+        );
+    }
+}
@@ -14,20 +14,36 @@
 
 #pragma once
 
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
 #include "sparrow/array_factory.hpp"
 #include "sparrow/arrow_array_schema_proxy.hpp"
 #include "sparrow/layout/array_bitmap_base.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/borrowed_proxy.hpp"
 #include "sparrow/layout/layout_utils.hpp"
 #include "sparrow/layout/nested_value_types.hpp"
 #include "sparrow/utils/functor_index_iterator.hpp"
 #include "sparrow/utils/iterator.hpp"
 #include "sparrow/utils/memory.hpp"
+#include "sparrow/utils/contracts.hpp"
 #include "sparrow/utils/nullable.hpp"
 
 namespace sparrow
 {
     class struct_array;
+    class struct_projection;
+
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+    }
 
     template <>
     struct array_inner_types<struct_array> : array_inner_types_base
@@ -77,6 +93,28 @@ namespace sparrow
         const array_wrapper* raw_child(std::size_t i) const;
         array_wrapper* raw_child(std::size_t i);
 
+        size_type children_count() const;
+
+        /**
+         * Returns the child at index \c i as an array of type \c A, so that
+         * its elements can be accessed without dispatching on its type.
+         * Throws std::runtime_error if the child is not an array of type \c A.
+         */
+        template <class A>
+        const A& child(std::size_t i) const;
+
+        template <class A>
+        A& child(std::size_t i);
+
+        /**
+         * Returns a read-only view whose children are the children of this
+         * array at \c indices, in that order; an index may appear several
+         * times. The children and the validity bitmap are shared, not copied:
+         * the view is invalidated by any operation invalidating this array.
+         */
+        struct_projection project(std::span<const std::size_t> indices) const;
+        struct_projection project(std::initializer_list<std::size_t> indices) const;
+
     private:
 
         using children_type = std::vector<cloning_ptr<array_wrapper>>;
@@ -133,6 +171,144 @@ namespace sparrow
         return m_children[i].get();
     }
 
+    inline auto struct_array::children_count() const -> size_type
+    {
+        return m_children.size();
+    }
+
+    template <class A>
+    const A& struct_array::child(std::size_t i) const
+    {
+        SPARROW_ASSERT_TRUE(i < m_children.size());
+        if (m_children[i]->get_arrow_proxy().data_type() != detail::get_data_type_from_array<A>::get())
+        {
+            throw std::runtime_error("The child of the struct array does not hold the requested array type");
+        }
+        return unwrap_array<A>(*m_children[i]);
+    }
+
+    template <class A>
+    A& struct_array::child(std::size_t i)
+    {
+        return const_cast<A&>(static_cast<const struct_array&>(*this).child<A>(i));
+    }
+
+    /**
+     * Read-only view over a subset of the children of a struct array,
+     * returned by struct_array::project. It borrows the children and the
+     * buffers of the projected array and only gives const access to them.
+     * Copying the view copies the projected data.
+     */
+    class struct_projection
+    {
+    public:
+
+        using size_type = struct_array::size_type;
+        using const_reference = struct_array::const_reference;
+        using const_iterator = struct_array::const_iterator;
+
+        [[nodiscard]] size_type size() const;
+        [[nodiscard]] size_type children_count() const;
+
+        [[nodiscard]] const array_wrapper* raw_child(std::size_t i) const;
+
+        template <class A>
+        [[nodiscard]] const A& child(std::size_t i) const;
+
+        [[nodiscard]] const_reference operator[](size_type i) const;
+
+        [[nodiscard]] const_iterator begin() const;
+        [[nodiscard]] const_iterator end() const;
+        [[nodiscard]] const_iterator cbegin() const;
+        [[nodiscard]] const_iterator cend() const;
+
+    private:
+
+        explicit struct_projection(arrow_proxy proxy);
+
+        struct_array m_array;
+
+        friend class struct_array;
+    };
+
+    inline struct_projection struct_array::project(std::span<const std::size_t> indices) const
+    {
+        const ArrowArray& source_array = this->get_arrow_proxy().array();
+        const ArrowSchema& source_schema = this->get_arrow_proxy().schema();
+
+        detail::borrowed_proxy_parts parts = detail::borrow_parts(this->get_arrow_proxy());
+        for (const std::size_t i : indices)
+        {
+            if (i >= m_children.size())
+            {
+                throw std::out_of_range("struct_array::project: child index out of range");
+            }
+            parts.array_children.push_back(source_array.children[i]);
+            parts.schema_children.push_back(source_schema.children[i]);
+        }
+        return struct_projection(detail::make_borrowed_proxy(std::move(parts)));
+    }
+
+    inline struct_projection struct_array::project(std::initializer_list<std::size_t> indices) const
+    {
+        return project(std::span<const std::size_t>(indices.begin(), indices.size()));
+    }
+
+    /************************************
+     * struct_projection implementation *
+     ************************************/
+
+    inline struct_projection::struct_projection(arrow_proxy proxy)
+        : m_array(std::move(proxy))
+    {
+    }
+
+    inline auto struct_projection::size() const -> size_type
+    {
+        return m_array.size();
+    }
+
+    inline auto struct_projection::children_count() const -> size_type
+    {
+        return m_array.children_count();
+    }
+
+    inline auto struct_projection::raw_child(std::size_t i) const -> const array_wrapper*
+    {
+        return m_array.raw_child(i);
+    }
+
+    template <class A>
+    const A& struct_projection::child(std::size_t i) const
+    {
+        return m_array.child<A>(i);
+    }
+
+    inline auto struct_projection::operator[](size_type i) const -> const_reference
+    {
+        return m_array[i];
+    }
+
+    inline auto struct_projection::begin() const -> const_iterator
+    {
+        return m_array.begin();
+    }
+
+    inline auto struct_projection::end() const -> const_iterator
+    {
+        return m_array.end();
+    }
+
+    inline auto struct_projection::cbegin() const -> const_iterator
+    {
+        return m_array.cbegin();
+    }
+
+    inline auto struct_projection::cend() const -> const_iterator
+    {
+        return m_array.cend();
+    }
+
     inline auto struct_array::value_begin() -> value_iterator
     {
         return value_iterator{detail::layout_value_functor<self_type, inner_value_type>{this}, 0};
@@ -0,0 +1,194 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/struct_layout/struct_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /**
+     * Converts the rows [first, first + count) of \c ar into values of the
+     * aggregate type \c T and appends them to \c out.
+     *
+     * The k-th member pointer of \c Members receives the values of the k-th
+     * child of \c ar. Members may be arithmetic types, read from a
+     * primitive_array of the same type, std::string, read from a
+     * string_array, or std::optional of these. Null values are read as
+     * std::nullopt for optional members and as default constructed values
+     * otherwise; the validity of the struct array itself is not applied.
+     *
+     * The rows are filled one member at a time: the type of each child is
+     * resolved once per call, then its values are read through a typed view,
+     * without going through struct_value and array_element.
+     *
+     * @throws std::invalid_argument if \c ar has fewer children than members.
+     * @throws std::runtime_error if a child does not hold the array type
+     *         matching its member.
+     */
+    template <class T, auto... Members>
+    void materialize_rows(const struct_array& ar, std::size_t first, std::size_t count, std::vector<T>& out);
+
+    /// Converts all the rows of \c ar, see above.
+    template <class T, auto... Members>
+    [[nodiscard]] std::vector<T> materialize_rows(const struct_array& ar);
+
+    /******************************
+     * struct rows implementation *
+     ******************************/
+
+    namespace detail
+    {
+        template <class M>
+        struct member_pointer_traits;
+
+        template <class C, class U>
+        struct member_pointer_traits<U C::*>
+        {
+            using class_type = C;
+            using value_type = U;
+        };
+
+        template <class U>
+        struct struct_field;
+
+        template <class U>
+            requires std::is_arithmetic_v<U>
+        struct struct_field<U>
+        {
+            using array_type = primitive_array<U>;
+
+            struct reader
+            {
+                typed_view<U> view;
+
+                bool has_value(std::size_t i) const
+                {
+                    return view.has_value(i);
+                }
+
+                U get(std::size_t i) const
+                {
+                    return view.data()[i];
+                }
+            };
+
+            static reader make_reader(const array_type& child)
+            {
+                return reader{typed_view<U>(child)};
+            }
+        };
+
+        template <>
+        struct struct_field<std::string>
+        {
+            using array_type = string_array;
+
+            struct reader
+            {
+                binary_buffers<string_array::offset_type> buffers;
+                validity_view validity;
+
+                bool has_value(std::size_t i) const
+                {
+                    return validity[i];
+                }
+
+                std::string_view get(std::size_t i) const
+                {
+                    return {reinterpret_cast<const char*>(buffers.value_data(i)), buffers.value_size(i)};
+                }
+            };
+
+            static reader make_reader(const array_type& child)
+            {
+                return reader{get_binary_buffers(child), make_validity_view(child.get_arrow_proxy())};
+            }
+        };
+
+        template <class U>
+        struct struct_field<std::optional<U>> : struct_field<U>
+        {
+        };
+
+        template <class T, auto Member>
+        void materialize_member(
+            const struct_array& ar,
+            std::size_t child_index,
+            std::size_t first,
+            std::size_t count,
+            T* out
+        )
+        {
+            using traits = member_pointer_traits<decltype(Member)>;
+            static_assert(std::is_same_v<typename traits::class_type, T>, "Members must be pointers to members of T");
+            using member_type = typename traits::value_type;
+            using field = struct_field<member_type>;
+
+            const auto reader = field::make_reader(ar.template child<typename field::array_type>(child_index));
+            for (std::size_t r = 0; r < count; ++r)
+            {
+                const std::size_t i = first + r;
+                member_type& dst = out[r].*Member;
+                if (reader.has_value(i))
+                {
+                    dst = member_type(reader.get(i));
+                }
+                else
+                {
+                    dst = member_type{};
+                }
+            }
+        }
+    }
+
+    template <class T, auto... Members>
+    void materialize_rows(const struct_array& ar, std::size_t first, std::size_t count, std::vector<T>& out)
+    {
+        if (ar.children_count() < sizeof...(Members))
+        {
+            throw std::invalid_argument("materialize_rows: the struct array has fewer children than members");
+        }
+        SPARROW_ASSERT_TRUE(first + count <= ar.size());
+        const std::size_t out_first = out.size();
+        out.resize(out_first + count);
+        T* dst = out.data() + out_first;
+        [&]<std::size_t... K>(std::index_sequence<K...>)
+        {
+            (detail::materialize_member<T, Members>(ar, K, first, count, dst), ...);
+        }(std::index_sequence_for<decltype(Members)...>{});
+    }
+
+    template <class T, auto... Members>
+    std::vector<T> materialize_rows(const struct_array& ar)
+    {
+        std::vector<T> result;
+        materialize_rows<T, Members...>(ar, 0, ar.size(), result);
+        return result;
+    }
+}
@@ -16,7 +16,9 @@
 
 #include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
+#include "sparrow/layout/layout_utils.hpp"
 #include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
 #include "sparrow/utils/memory.hpp"
 
 namespace sparrow
@@ -29,6 +31,8 @@ namespace sparrow
         using const_reference = array_traits::const_reference;
         using size_type = std::size_t;
         using child_ptr = cloning_ptr<array_wrapper>;
+        using functor_type = detail::layout_bracket_functor<const struct_value, const_reference>;
+        using const_iterator = functor_index_iterator<functor_type>;
 
         struct_value() = default;
         struct_value(const std::vector<child_ptr>& children, size_type index);
@@ -36,6 +40,11 @@ namespace sparrow
         size_type size() const;
         const_reference operator[](size_type i) const;
 
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
     private:
     
         const std::vector<child_ptr>* p_children = nullptr;
@@ -0,0 +1,436 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/array_bitmap_base.hpp"
+#include "sparrow/layout/layout_utils.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
+#include "sparrow/utils/mp_utils.hpp"
+#include "sparrow/utils/nullable.hpp"
+
+namespace sparrow
+{
+    template <class T>
+    class temporal_array;
+
+    using date_days_array = temporal_array<date_days>;
+    using date_milliseconds_array = temporal_array<date_milliseconds>;
+    using time_seconds_array = temporal_array<time_seconds>;
+    using time_milliseconds_array = temporal_array<time_milliseconds>;
+    using time_microseconds_array = temporal_array<time_microseconds>;
+    using time_nanoseconds_array = temporal_array<time_nanoseconds>;
+    using timestamp_seconds_array = temporal_array<timestamp_seconds>;
+    using timestamp_milliseconds_array = temporal_array<timestamp_milliseconds>;
+    using timestamp_microseconds_array = temporal_array<timestamp_microseconds>;
+    using timestamp_nanoseconds_array = temporal_array<timestamp_nanoseconds>;
+    using duration_seconds_array = temporal_array<std::chrono::seconds>;
+    using duration_milliseconds_array = temporal_array<std::chrono::milliseconds>;
+    using duration_microseconds_array = temporal_array<std::chrono::microseconds>;
+    using duration_nanoseconds_array = temporal_array<std::chrono::nanoseconds>;
+
+    namespace detail
+    {
+        /**
+         * Maps a temporal value type to the integer stored in the data
+         * buffer, i.e. a count of \c duration units:
+         * - storage_type: int32_t or int64_t, as specified by Arrow;
+         * - duration: unit of the stored integer;
+         * - rebind<D>: the value type of the same kind with unit D;
+         * - is_timestamp, is_duration: kind of the values;
+         * - to_value / to_storage: conversions between both.
+         */
+        template <class T>
+        struct temporal_value_traits;
+
+        template <time_unit D>
+        struct temporal_value_traits<std::chrono::sys_time<D>>
+        {
+            using storage_type = std::int64_t;
+            using duration = D;
+            template <class D2>
+            using rebind = std::chrono::sys_time<D2>;
+            static constexpr bool is_timestamp = true;
+            static constexpr bool is_duration = false;
+
+            static constexpr std::chrono::sys_time<D> to_value(storage_type v)
+            {
+                return std::chrono::sys_time<D>(D(v));
+            }
+
+            static constexpr storage_type to_storage(const std::chrono::sys_time<D>& v)
+            {
+                return static_cast<storage_type>(v.time_since_epoch().count());
+            }
+        };
+
+        template <class D>
+            requires std::same_as<D, std::chrono::days> || std::same_as<D, std::chrono::milliseconds>
+        struct temporal_value_traits<std::chrono::local_time<D>>
+        {
+            using storage_type = std::conditional_t<std::same_as<D, std::chrono::days>, std::int32_t, std::int64_t>;
+            using duration = D;
+            template <class D2>
+            using rebind = std::chrono::local_time<D2>;
+            static constexpr bool is_timestamp = false;
+            static constexpr bool is_duration = false;
+
+            static constexpr std::chrono::local_time<D> to_value(storage_type v)
+            {
+                return std::chrono::local_time<D>(D(v));
+            }
+
+            static constexpr storage_type to_storage(const std::chrono::local_time<D>& v)
+            {
+                return static_cast<storage_type>(v.time_since_epoch().count());
+            }
+        };
+
+        template <time_unit D>
+        struct temporal_value_traits<time_of_day<D>>
+        {
+            using storage_type = std::conditional_t<
+                std::same_as<D, std::chrono::seconds> || std::same_as<D, std::chrono::milliseconds>,
+                std::int32_t,
+                std::int64_t>;
+            using duration = D;
+            template <class D2>
+            using rebind = time_of_day<D2>;
+            static constexpr bool is_timestamp = false;
+            static constexpr bool is_duration = false;
+
+            static constexpr time_of_day<D> to_value(storage_type v)
+            {
+                return time_of_day<D>(D(v));
+            }
+
+            static constexpr storage_type to_storage(const time_of_day<D>& v)
+            {
+                return static_cast<storage_type>(v.count());
+            }
+        };
+
+        template <time_unit D>
+        struct temporal_value_traits<D>
+        {
+            using storage_type = std::int64_t;
+            using duration = D;
+            template <class D2>
+            using rebind = D2;
+            static constexpr bool is_timestamp = false;
+            static constexpr bool is_duration = true;
+
+            static constexpr D to_value(storage_type v)
+            {
+                return D(v);
+            }
+
+            static constexpr storage_type to_storage(const D& v)
+            {
+                return static_cast<storage_type>(v.count());
+            }
+        };
+
+        template <class T>
+        struct get_data_type_from_array;
+
+        template <class T>
+        struct get_data_type_from_array<sparrow::temporal_array<T>>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return arrow_traits<T>::type_id;
+            }
+        };
+    }
+
+    template <class T>
+    struct array_inner_types<temporal_array<T>> : array_inner_types_base
+    {
+        using array_type = temporal_array<T>;
+
+        using inner_value_type = T;
+        using inner_reference = T;
+        using inner_const_reference = T;
+
+        using const_value_iterator = functor_index_iterator<
+            detail::layout_value_functor<const array_type, inner_value_type>>;
+        using iterator_tag = std::random_access_iterator_tag;
+    };
+
+    /**
+     * Array of dates, times of day, timestamps or durations (the Arrow
+     * Date32/64, Time32/64, Timestamp and Duration layouts).
+     *
+     * The data buffer holds the raw int32 or int64 counts of the unit of
+     * the array; the unit is part of the type, and the time zone of
+     * timestamps is parsed once from the format ("tsu:Europe/Paris").
+     * Elements are built from the raw counts, without any time zone lookup:
+     * dates are std::chrono::local_time values, times are time_of_day
+     * values and timestamps are sys_time values, i.e. UTC time points, that
+     * can be localized with timezone(). Unit conversion and
+     * truncation kernels are declared in temporal_kernels.hpp.
+     *
+     * @tparam T one of date_days, date_milliseconds, time_*, timestamp_*
+     *           or std::chrono::seconds, milliseconds, microseconds and
+     *           nanoseconds for durations.
+     */
+    template <class T>
+    class temporal_array final : public array_bitmap_base<temporal_array<T>>
+    {
+    public:
+
+        using self_type = temporal_array<T>;
+        using base_type = array_bitmap_base<self_type>;
+        using inner_types = array_inner_types<self_type>;
+        using inner_value_type = typename inner_types::inner_value_type;
+        using inner_reference = typename inner_types::inner_reference;
+        using inner_const_reference = typename inner_types::inner_const_reference;
+        using value_traits = detail::temporal_value_traits<T>;
+        using storage_type = typename value_traits::storage_type;
+        using duration = typename value_traits::duration;
+        using bitmap_type = typename base_type::bitmap_type;
+        using bitmap_const_reference = typename base_type::bitmap_const_reference;
+        using value_type = nullable<inner_value_type>;
+        using const_reference = nullable<inner_const_reference, bitmap_const_reference>;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using iterator_tag = typename base_type::iterator_tag;
+
+        using const_bitmap_range = typename base_type::const_bitmap_range;
+        using const_value_iterator = typename inner_types::const_value_iterator;
+
+        explicit temporal_array(arrow_proxy);
+
+        template <class... Args>
+            requires(mpl::excludes_copy_and_move_ctor_v<temporal_array<T>, Args...>)
+        temporal_array(Args&&... args)
+            : temporal_array(create_proxy(std::forward<Args>(args)...))
+        {
+        }
+
+        using base_type::get_arrow_proxy;
+        using base_type::size;
+
+        /// Raw counts of \c duration units, including the null elements.
+        [[nodiscard]] const storage_type* data() const;
+
+        /// Time zone of the timestamps, empty if they have none.
+        [[nodiscard]] std::string_view timezone() const
+            requires detail::temporal_value_traits<T>::is_timestamp;
+
+    private:
+
+        template <validity_bitmap_input VB = validity_bitmap>
+        static arrow_proxy
+        create_proxy(u8_buffer<storage_type>&& data_buffer, VB&& validity_input = validity_bitmap{});
+
+        template <validity_bitmap_input VB>
+            requires detail::temporal_value_traits<T>::is_timestamp
+        static arrow_proxy
+        create_proxy(u8_buffer<storage_type>&& data_buffer, VB&& validity_input, std::string_view timezone);
+
+        template <std::ranges::input_range R, validity_bitmap_input VB = validity_bitmap>
+            requires std::convertible_to<std::ranges::range_value_t<R>, T>
+        static arrow_proxy create_proxy(R&& values, VB&& validity_input = validity_bitmap{});
+
+        template <std::ranges::input_range R, validity_bitmap_input VB>
+            requires std::convertible_to<std::ranges::range_value_t<R>, T>
+                     && detail::temporal_value_traits<T>::is_timestamp
+        static arrow_proxy create_proxy(R&& values, VB&& validity_input, std::string_view timezone);
+
+        static arrow_proxy
+        make_proxy(u8_buffer<storage_type>&& data_buffer, validity_bitmap&& bitmap, std::string_view timezone);
+
+        inner_const_reference value(size_type i) const;
+
+        const_value_iterator value_cbegin() const;
+        const_value_iterator value_cend() const;
+
+        static constexpr size_type DATA_BUFFER_INDEX = 1;
+
+        std::string m_timezone;
+
+        friend class array_crtp_base<self_type>;
+        friend class detail::layout_value_functor<const self_type, inner_value_type>;
+    };
+
+    /*********************************
+     * temporal_array implementation *
+     *********************************/
+
+    template <class T>
+    temporal_array<T>::temporal_array(arrow_proxy proxy)
+        : base_type(std::move(proxy))
+    {
+        SPARROW_ASSERT_TRUE(get_arrow_proxy().data_type() == detail::get_data_type_from_array<self_type>::get());
+        if constexpr (value_traits::is_timestamp)
+        {
+            // "ts?:" followed by the time zone
+            const std::string_view format = get_arrow_proxy().format();
+            m_timezone = std::string(format.substr(4));
+        }
+    }
+
+    template <class T>
+    auto temporal_array<T>::data() const -> const storage_type*
+    {
+        return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<const storage_type>()
+               + static_cast<size_type>(get_arrow_proxy().offset());
+    }
+
+    template <class T>
+    std::string_view temporal_array<T>::timezone() const
+        requires detail::temporal_value_traits<T>::is_timestamp
+    {
+        return m_timezone;
+    }
+
+    template <class T>
+    template <validity_bitmap_input VB>
+    arrow_proxy temporal_array<T>::create_proxy(u8_buffer<storage_type>&& data_buffer, VB&& validity_input)
+    {
+        const auto size = data_buffer.size();
+        return make_proxy(
+            std::move(data_buffer),
+            ensure_validity_bitmap(size, std::forward<VB>(validity_input)),
+            std::string_view()
+        );
+    }
+
+    template <class T>
+    template <validity_bitmap_input VB>
+        requires detail::temporal_value_traits<T>::is_timestamp
+    arrow_proxy temporal_array<T>::create_proxy(
+        u8_buffer<storage_type>&& data_buffer,
+        VB&& validity_input,
+        std::string_view timezone
+    )
+    {
+        const auto size = data_buffer.size();
+        return make_proxy(
+            std::move(data_buffer),
+            ensure_validity_bitmap(size, std::forward<VB>(validity_input)),
+            timezone
+        );
+    }
+
+    template <class T>
+    template <std::ranges::input_range R, validity_bitmap_input VB>
+        requires std::convertible_to<std::ranges::range_value_t<R>, T>
+    arrow_proxy temporal_array<T>::create_proxy(R&& values, VB&& validity_input)
+    {
+        std::vector<storage_type> counts;
+        for (const auto& v : values)
+        {
+            counts.push_back(value_traits::to_storage(static_cast<T>(v)));
+        }
+        return create_proxy(u8_buffer<storage_type>(std::move(counts)), std::forward<VB>(validity_input));
+    }
+
+    template <class T>
+    template <std::ranges::input_range R, validity_bitmap_input VB>
+        requires std::convertible_to<std::ranges::range_value_t<R>, T>
+                 && detail::temporal_value_traits<T>::is_timestamp
+    arrow_proxy temporal_array<T>::create_proxy(R&& values, VB&& validity_input, std::string_view timezone)
+    {
+        std::vector<storage_type> counts;
+        for (const auto& v : values)
+        {
+            counts.push_back(value_traits::to_storage(static_cast<T>(v)));
+        }
+        return create_proxy(
+            u8_buffer<storage_type>(std::move(counts)),
+            std::forward<VB>(validity_input),
+            timezone
+        );
+    }
+
+    template <class T>
+    arrow_proxy temporal_array<T>::make_proxy(
+        u8_buffer<storage_type>&& data_buffer,
+        validity_bitmap&& bitmap,
+        std::string_view timezone
+    )
+    {
+        const auto size = data_buffer.size();
+        const auto null_count = bitmap.null_count();
+
+        std::string format(data_type_to_format(detail::get_data_type_from_array<self_type>::get()));
+        format += timezone;
+
+        ArrowSchema schema = make_arrow_schema(
+            std::move(format),
+            std::nullopt,  // name
+            std::nullopt,  // metadata
+            std::nullopt,  // flags
+            0,             // n_children
+            nullptr,       // children
+            nullptr        // dictionary
+        );
+
+        std::vector<buffer<std::uint8_t>> buffers(2);
+        buffers[0] = std::move(bitmap).extract_storage();
+        buffers[1] = std::move(data_buffer).extract_storage();
+
+        ArrowArray arr = make_arrow_array(
+            static_cast<std::int64_t>(size),  // length
+            static_cast<std::int64_t>(null_count),
+            0,  // offset
+            std::move(buffers),
+            0,        // n_children
+            nullptr,  // children
+            nullptr   // dictionary
+        );
+        return arrow_proxy(std::move(arr), std::move(schema));
+    }
+
+    template <class T>
+    auto temporal_array<T>::value(size_type i) const -> inner_const_reference
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return value_traits::to_value(data()[i]);
+    }
+
+    template <class T>
+    auto temporal_array<T>::value_cbegin() const -> const_value_iterator
+    {
+        return const_value_iterator(detail::layout_value_functor<const self_type, inner_value_type>(this), 0);
+    }
+
+    template <class T>
+    auto temporal_array<T>::value_cend() const -> const_value_iterator
+    {
+        return const_value_iterator(
+            detail::layout_value_functor<const self_type, inner_value_type>(this),
+            this->size()
+        );
+    }
+}
@@ -0,0 +1,180 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/temporal_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+
+namespace sparrow
+{
+    namespace detail
+    {
+        /// Value types of the same kind (timestamps, dates, times or durations).
+        template <class To, class From>
+        concept temporal_castable = std::same_as<
+            typename temporal_value_traits<From>::template rebind<typename temporal_value_traits<To>::duration>,
+            To>;
+    }
+
+    /**
+     * Converts the elements of \c ar to the unit of \c To. Converting to a
+     * finer unit multiplies the raw counts; converting to a coarser one
+     * floors them, as std::chrono::floor does, except for durations which
+     * are truncated toward zero, as std::chrono::duration_cast does.
+     * Timestamps keep their time zone, nulls stay null.
+     *
+     * @throws std::overflow_error if a non-null value does not fit the
+     *         storage type of \c To.
+     */
+    template <class To, class From>
+        requires detail::temporal_castable<To, From>
+    [[nodiscard]] temporal_array<To> temporal_cast(const temporal_array<From>& ar);
+
+    /**
+     * Floors the elements of \c ar to a multiple of \c granularity, e.g.
+     * std::chrono::minutes(1), hours(1) or days(1). Timestamps are floored
+     * in UTC, whatever their time zone; negative values are floored toward
+     * negative infinity.
+     *
+     * @throws std::invalid_argument if \c granularity is not a positive
+     *         multiple of the unit of \c ar.
+     */
+    template <class T, class Rep, class Period>
+    [[nodiscard]] temporal_array<T>
+    floor_to(const temporal_array<T>& ar, std::chrono::duration<Rep, Period> granularity);
+
+    /***********************************
+     * temporal kernels implementation *
+     ***********************************/
+
+    namespace detail
+    {
+        // Result of a kernel over ar, with the time zone of ar for timestamps.
+        template <class To, class From>
+        temporal_array<To> make_temporal_result(
+            const temporal_array<From>& ar,
+            u8_buffer<typename temporal_array<To>::storage_type>&& data,
+            validity_bitmap&& validity
+        )
+        {
+            if constexpr (temporal_value_traits<To>::is_timestamp)
+            {
+                return temporal_array<To>(std::move(data), std::move(validity), ar.timezone());
+            }
+            else
+            {
+                static_cast<void>(ar);
+                return temporal_array<To>(std::move(data), std::move(validity));
+            }
+        }
+    }
+
+    template <class To, class From>
+        requires detail::temporal_castable<To, From>
+    temporal_array<To> temporal_cast(const temporal_array<From>& ar)
+    {
+        using from_traits = detail::temporal_value_traits<From>;
+        using to_traits = detail::temporal_value_traits<To>;
+        using to_storage = typename to_traits::storage_type;
+        using ratio = std::ratio_divide<typename from_traits::duration::period, typename to_traits::duration::period>;
+
+        constexpr std::int64_t storage_min = std::numeric_limits<to_storage>::min();
+        constexpr std::int64_t storage_max = std::numeric_limits<to_storage>::max();
+
+        const std::size_t n = ar.size();
+        const auto* in = ar.data();
+        const validity_view validity = detail::make_validity_view(ar.get_arrow_proxy());
+        u8_buffer<to_storage> result(n, to_storage(0));
+        to_storage* out = result.data();
+
+        // Out of range values are only an error if they are not null:
+        // the validity is read for them only.
+        bool overflow = false;
+        if constexpr (ratio::den == 1)
+        {
+            constexpr std::int64_t factor = ratio::num;
+            constexpr std::int64_t lo = storage_min / factor;
+            constexpr std::int64_t hi = storage_max / factor;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const std::int64_t v = in[i];
+                const bool in_range = v >= lo && v <= hi;
+                out[i] = static_cast<to_storage>(in_range ? v * factor : 0);
+                overflow = overflow || (!in_range && validity[i]);
+            }
+        }
+        else
+        {
+            static_assert(ratio::num == 1, "temporal units are multiples of each other");
+            constexpr std::int64_t divisor = ratio::den;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const std::int64_t v = in[i];
+                std::int64_t q = v / divisor;
+                if constexpr (!from_traits::is_duration)
+                {
+                    q -= (v % divisor < 0) ? 1 : 0;
+                }
+                const bool in_range = q >= storage_min && q <= storage_max;
+                out[i] = static_cast<to_storage>(q);
+                overflow = overflow || (!in_range && validity[i]);
+            }
+        }
+        if (overflow)
+        {
+            throw std::overflow_error("temporal value does not fit the target unit");
+        }
+        return detail::make_temporal_result<To>(ar, std::move(result), detail::copy_validity(validity));
+    }
+
+    template <class T, class Rep, class Period>
+    temporal_array<T> floor_to(const temporal_array<T>& ar, std::chrono::duration<Rep, Period> granularity)
+    {
+        using unit = typename temporal_array<T>::duration;
+        using storage_type = typename temporal_array<T>::storage_type;
+
+        const unit step = std::chrono::duration_cast<unit>(granularity);
+        if (step.count() <= 0 || step != granularity)
+        {
+            throw std::invalid_argument("the granularity must be a positive multiple of the unit of the array");
+        }
+
+        const std::size_t n = ar.size();
+        const auto* in = ar.data();
+        const std::int64_t g = static_cast<std::int64_t>(step.count());
+        u8_buffer<storage_type> result(n, storage_type(0));
+        storage_type* out = result.data();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const std::int64_t v = in[i];
+            const std::int64_t r = v % g;
+            out[i] = static_cast<storage_type>(v - r - (r < 0 ? g : 0));
+        }
+        return detail::make_temporal_result<T>(
+            ar,
+            std::move(result),
+            detail::copy_validity(detail::make_validity_view(ar.get_arrow_proxy()))
+        );
+    }
+}
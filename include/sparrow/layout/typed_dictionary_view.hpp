@@ -0,0 +1,297 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/dictionary_encoded_array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/functor_index_iterator.hpp"
+
+namespace sparrow
+{
+    namespace detail
+    {
+        template <class A>
+        struct dictionary_gather;
+    }
+
+    /**
+     * Non-owning typed view over a dictionary encoded array.
+     *
+     * The type of the dictionary is resolved once, when the view is built,
+     * so that accessing the elements does not go through array_element and
+     * nullable variants. Elements are exposed as plain values: T for
+     * primitive dictionaries, the const reference type (e.g. std::string_view)
+     * for variable size binary dictionaries. Elements with a null key are
+     * exposed as default constructed values; has_value tells null elements
+     * apart.
+     *
+     * The view is invalidated by any operation invalidating the buffers of
+     * the viewed array.
+     *
+     * @tparam IT the type of the keys.
+     * @tparam A the type of the dictionary, primitive_array<T> or
+     *         variable_size_binary_array<T, CR, OT>.
+     */
+    template <std::integral IT, class A>
+    class typed_dictionary_view
+    {
+    public:
+
+        using self_type = typed_dictionary_view<IT, A>;
+        using key_type = IT;
+        using dictionary_type = A;
+        using value_type = std::remove_cvref_t<typename A::inner_const_reference>;
+        using size_type = std::size_t;
+
+        using functor_type = layout_element_functor<self_type, true>;
+        using const_iterator = functor_index_iterator<functor_type>;
+
+        // Required by layout_element_functor.
+        using const_reference = value_type;
+        using reference = value_type;
+
+        /**
+         * Throws std::runtime_error if the dictionary of \c ar is not an
+         * array of type \c A.
+         */
+        explicit typed_dictionary_view(const dictionary_encoded_array<IT>& ar);
+
+        [[nodiscard]] size_type size() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        [[nodiscard]] const typed_view<IT>& keys() const noexcept;
+        [[nodiscard]] const dictionary_type& dictionary() const noexcept;
+
+        [[nodiscard]] bool has_value(size_type i) const;
+        [[nodiscard]] value_type value(size_type i) const;
+        [[nodiscard]] value_type operator[](size_type i) const;
+
+        [[nodiscard]] const_iterator begin() const;
+        [[nodiscard]] const_iterator end() const;
+
+        /**
+         * Gathers the values into a new array of type \c A with contiguous
+         * buffers. An element is null if its key or the dictionary entry it
+         * refers to is null.
+         */
+        [[nodiscard]] dictionary_type decode() const;
+
+    private:
+
+        // Index in the dictionary of element i; null keys are mapped to 0
+        // so that they can be gathered without branching.
+        size_type safe_key(size_type i) const;
+
+        validity_bitmap gather_validity() const;
+
+        typed_view<IT> m_keys;
+        dictionary_type m_dictionary;
+
+        template <class>
+        friend struct detail::dictionary_gather;
+    };
+
+    /****************************************
+     * typed_dictionary_view implementation *
+     ****************************************/
+
+    namespace detail
+    {
+        template <class A>
+        arrow_proxy checked_dictionary_proxy(arrow_proxy proxy)
+        {
+            if (proxy.data_type() != get_data_type_from_array<A>::get())
+            {
+                throw std::runtime_error("The dictionary does not hold the requested array type");
+            }
+            return proxy;
+        }
+
+        template <class T>
+        struct dictionary_gather<primitive_array<T>>
+        {
+            template <class View>
+            static primitive_array<T> gather(const View& view, validity_bitmap&& validity)
+            {
+                const std::size_t size = view.size();
+                const T* values = view.dictionary().data();
+                u8_buffer<T> result(size);
+                T* out = result.data();
+                if (view.dictionary().size() != 0)
+                {
+                    if (view.keys().validity().all_valid())
+                    {
+                        const typename View::key_type* keys = view.keys().data();
+                        for (std::size_t i = 0; i < size; ++i)
+                        {
+                            out[i] = values[static_cast<std::size_t>(keys[i])];
+                        }
+                    }
+                    else
+                    {
+                        for (std::size_t i = 0; i < size; ++i)
+                        {
+                            out[i] = values[view.safe_key(i)];
+                        }
+                    }
+                }
+                return primitive_array<T>(std::move(result), std::move(validity));
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct dictionary_gather<variable_size_binary_array<T, CR, OT>>
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+
+            template <class View>
+            static array_type gather(const View& view, validity_bitmap&& validity)
+            {
+                const auto keys = std::views::iota(std::size_t(0), view.size())
+                                  | std::views::transform(
+                                      [&view](std::size_t i)
+                                      {
+                                          return view.safe_key(i);
+                                      }
+                                  );
+                return gather_binary(
+                    view.dictionary(),
+                    keys,
+                    [&validity](std::size_t i)
+                    {
+                        return validity.test(i);
+                    }
+                );
+            }
+        };
+    }
+
+    template <std::integral IT, class A>
+    typed_dictionary_view<IT, A>::typed_dictionary_view(const dictionary_encoded_array<IT>& ar)
+        : m_keys(ar.keys())
+        , m_dictionary(detail::checked_dictionary_proxy<A>(ar.dictionary_proxy()))
+    {
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::size() const noexcept -> size_type
+    {
+        return m_keys.size();
+    }
+
+    template <std::integral IT, class A>
+    bool typed_dictionary_view<IT, A>::empty() const noexcept
+    {
+        return m_keys.empty();
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::keys() const noexcept -> const typed_view<IT>&
+    {
+        return m_keys;
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::dictionary() const noexcept -> const dictionary_type&
+    {
+        return m_dictionary;
+    }
+
+    template <std::integral IT, class A>
+    bool typed_dictionary_view<IT, A>::has_value(size_type i) const
+    {
+        return m_keys.has_value(i) && m_dictionary.has_value(static_cast<size_type>(m_keys.value(i)));
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::value(size_type i) const -> value_type
+    {
+        if (!m_keys.has_value(i))
+        {
+            return value_type{};
+        }
+        const auto key = static_cast<size_type>(m_keys.value(i));
+        SPARROW_ASSERT_TRUE(key < m_dictionary.size());
+        return m_dictionary[key].get();
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::operator[](size_type i) const -> value_type
+    {
+        return value(i);
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::begin() const -> const_iterator
+    {
+        return const_iterator(functor_type(this), 0u);
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::end() const -> const_iterator
+    {
+        return const_iterator(functor_type(this), size());
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::decode() const -> dictionary_type
+    {
+        return detail::dictionary_gather<A>::gather(*this, gather_validity());
+    }
+
+    template <std::integral IT, class A>
+    auto typed_dictionary_view<IT, A>::safe_key(size_type i) const -> size_type
+    {
+        const auto key = static_cast<size_type>(m_keys.data()[i]);
+        const bool valid = m_keys.has_value(i) && key < m_dictionary.size();
+        SPARROW_ASSERT_TRUE(valid || !m_keys.has_value(i));
+        return valid ? key : 0;
+    }
+
+    template <std::integral IT, class A>
+    validity_bitmap typed_dictionary_view<IT, A>::gather_validity() const
+    {
+        const size_type n = size();
+        validity_bitmap validity(n, true);
+        const validity_view& key_validity = m_keys.validity();
+        const bool dictionary_has_nulls = m_dictionary.get_arrow_proxy().null_count() != 0;
+        if (key_validity.all_valid() && !dictionary_has_nulls)
+        {
+            return validity;
+        }
+        for (size_type i = 0; i < n; ++i)
+        {
+            if (!key_validity[i]
+                || (dictionary_has_nulls && !m_dictionary.has_value(static_cast<size_type>(m_keys.value(i)))))
+            {
+                validity.set(i, false);
+            }
+        }
+        return validity;
+    }
+}
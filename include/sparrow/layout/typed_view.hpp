@@ -0,0 +1,284 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    /**
+     * Non-owning view over the validity bitmap of an array.
+     *
+     * Element i of the view is bit (offset + i) of the underlying
+     * bitmap, so that indices match the ones of the viewed array.
+     * A null data pointer means that all the elements are valid.
+     */
+    class validity_view
+    {
+    public:
+
+        using size_type = std::size_t;
+
+        constexpr validity_view() = default;
+        constexpr validity_view(const std::uint8_t* data, size_type offset, size_type size, size_type null_count);
+
+        [[nodiscard]] constexpr size_type size() const noexcept;
+        [[nodiscard]] constexpr size_type offset() const noexcept;
+        [[nodiscard]] constexpr const std::uint8_t* data() const noexcept;
+        [[nodiscard]] constexpr size_type null_count() const noexcept;
+        [[nodiscard]] constexpr bool all_valid() const noexcept;
+
+        [[nodiscard]] constexpr bool operator[](size_type i) const;
+
+    private:
+
+        const std::uint8_t* p_data = nullptr;
+        size_type m_offset = 0;
+        size_type m_size = 0;
+        size_type m_null_count = 0;
+    };
+
+    /**
+     * Non-owning typed view over a primitive array.
+     *
+     * The values are exposed as a contiguous std::span, and the
+     * validity as a validity_view, so that loops over the view do
+     * not go through nullable proxies or variants. The view is
+     * invalidated by any operation invalidating the buffers of the
+     * viewed array.
+     *
+     * @tparam T the value type of the primitive array.
+     */
+    template <class T>
+    class typed_view
+    {
+    public:
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using const_pointer = const T*;
+        using values_type = std::span<const T>;
+
+        explicit typed_view(const primitive_array<T>& ar);
+
+        /**
+         * Builds a view over a type-erased array. Throws std::runtime_error
+         * if the array does not hold a primitive_array<T>.
+         */
+        explicit typed_view(const array& ar);
+
+        [[nodiscard]] size_type size() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        [[nodiscard]] values_type values() const noexcept;
+        [[nodiscard]] const validity_view& validity() const noexcept;
+        [[nodiscard]] const_pointer data() const noexcept;
+
+        [[nodiscard]] bool has_value(size_type i) const;
+        [[nodiscard]] const T& value(size_type i) const;
+
+    private:
+
+        values_type m_values;
+        validity_view m_validity;
+    };
+
+    /********************************
+     * validity_view implementation *
+     ********************************/
+
+    constexpr validity_view::validity_view(
+        const std::uint8_t* data,
+        size_type offset,
+        size_type size,
+        size_type null_count
+    )
+        : p_data(data)
+        , m_offset(offset)
+        , m_size(size)
+        , m_null_count(data == nullptr ? 0 : null_count)
+    {
+    }
+
+    constexpr auto validity_view::size() const noexcept -> size_type
+    {
+        return m_size;
+    }
+
+    constexpr auto validity_view::offset() const noexcept -> size_type
+    {
+        return m_offset;
+    }
+
+    constexpr auto validity_view::data() const noexcept -> const std::uint8_t*
+    {
+        return p_data;
+    }
+
+    constexpr auto validity_view::null_count() const noexcept -> size_type
+    {
+        return m_null_count;
+    }
+
+    constexpr bool validity_view::all_valid() const noexcept
+    {
+        return m_null_count == 0;
+    }
+
+    constexpr bool validity_view::operator[](size_type i) const
+    {
+        SPARROW_ASSERT_TRUE(i < m_size);
+        if (all_valid())
+        {
+            return true;
+        }
+        const size_type pos = m_offset + i;
+        return (p_data[pos / 8] >> (pos % 8)) & 1u;
+    }
+
+    namespace detail
+    {
+        // Builds a validity_view over the validity buffer, i.e.
+        // the first buffer, of the array held by proxy.
+        inline validity_view make_validity_view(const arrow_proxy& proxy)
+        {
+            const auto size = static_cast<std::size_t>(proxy.length());
+            const std::int64_t null_count = proxy.null_count();
+            return validity_view(
+                proxy.buffers()[0].data(),
+                static_cast<std::size_t>(proxy.offset()),
+                size,
+                // A negative null count means it has not been computed
+                null_count < 0 ? size : static_cast<std::size_t>(null_count)
+            );
+        }
+
+        // Validity of an element-wise kernel: valid where both operands are.
+        inline validity_bitmap and_validity(const validity_view& lhs, const validity_view& rhs)
+        {
+            validity_bitmap result(lhs.size(), true);
+            if (!lhs.all_valid() || !rhs.all_valid())
+            {
+                for (std::size_t i = 0; i < lhs.size(); ++i)
+                {
+                    if (!(lhs[i] && rhs[i]))
+                    {
+                        result.set(i, false);
+                    }
+                }
+            }
+            return result;
+        }
+
+        // Owning copy of a validity, for the results of element-wise kernels.
+        inline validity_bitmap copy_validity(const validity_view& validity)
+        {
+            validity_bitmap result(validity.size(), true);
+            if (!validity.all_valid())
+            {
+                for (std::size_t i = 0; i < validity.size(); ++i)
+                {
+                    if (!validity[i])
+                    {
+                        result.set(i, false);
+                    }
+                }
+            }
+            return result;
+        }
+
+        // Validity of a gather: element i is valid if indices[i] is a valid
+        // element of validity. Indices past the end give null elements.
+        inline validity_bitmap gather_validity(const validity_view& validity, std::span<const std::size_t> indices)
+        {
+            validity_bitmap result(indices.size(), true);
+            for (std::size_t i = 0; i < indices.size(); ++i)
+            {
+                if (indices[i] >= validity.size() || !validity[indices[i]])
+                {
+                    result.set(i, false);
+                }
+            }
+            return result;
+        }
+    }
+
+    /*****************************
+     * typed_view implementation *
+     *****************************/
+
+    template <class T>
+    typed_view<T>::typed_view(const primitive_array<T>& ar)
+        : m_values(ar.data(), ar.size())
+        , m_validity(detail::make_validity_view(ar.get_arrow_proxy()))
+    {
+    }
+
+    template <class T>
+    typed_view<T>::typed_view(const array& ar)
+        : typed_view(ar.as<primitive_array<T>>())
+    {
+    }
+
+    template <class T>
+    auto typed_view<T>::size() const noexcept -> size_type
+    {
+        return m_values.size();
+    }
+
+    template <class T>
+    bool typed_view<T>::empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+    template <class T>
+    auto typed_view<T>::values() const noexcept -> values_type
+    {
+        return m_values;
+    }
+
+    template <class T>
+    auto typed_view<T>::validity() const noexcept -> const validity_view&
+    {
+        return m_validity;
+    }
+
+    template <class T>
+    auto typed_view<T>::data() const noexcept -> const_pointer
+    {
+        return m_values.data();
+    }
+
+    template <class T>
+    bool typed_view<T>::has_value(size_type i) const
+    {
+        return m_validity[i];
+    }
+
+    template <class T>
+    const T& typed_view<T>::value(size_type i) const
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return m_values[i];
+    }
+}
@@ -14,6 +14,12 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 #include "sparrow/config/config.hpp"
 #include "sparrow/layout/array_wrapper.hpp"
 #include "sparrow/array_factory.hpp"
@@ -53,6 +59,36 @@ namespace sparrow
         };
     }
 
+    /**
+     * Element indices of a union array grouped by child.
+     *
+     * The entries of child c are in [bounds[c], bounds[c + 1]); within a
+     * child, entries are sorted by element index. rows holds the index of
+     * the element in the union, indices the index of the element in the
+     * child.
+     */
+    struct union_partition
+    {
+        std::vector<std::size_t> bounds;
+        std::vector<std::size_t> rows;
+        std::vector<std::size_t> indices;
+
+        std::size_t children_count() const noexcept
+        {
+            return bounds.empty() ? 0 : bounds.size() - 1;
+        }
+
+        std::span<const std::size_t> rows_of(std::size_t child) const
+        {
+            return {rows.data() + bounds[child], bounds[child + 1] - bounds[child]};
+        }
+
+        std::span<const std::size_t> indices_of(std::size_t child) const
+        {
+            return {indices.data() + bounds[child], bounds[child + 1] - bounds[child]};
+        }
+    };
+
     // helper crtp-base to have sparse and dense and dense union share most of their code
     template<class DERIVED>
     class union_array_crtp_base : public crtp_base<DERIVED>
@@ -80,6 +116,22 @@ namespace sparrow
         const_iterator cbegin() const;
         const_iterator cend() const;
 
+        std::size_t children_count() const;
+        const array_wrapper* raw_child(std::size_t i) const;
+
+        // Index of the child holding element i.
+        std::size_t child_index(std::size_t i) const;
+        // Index of element i in its child.
+        std::size_t child_element_index(std::size_t i) const;
+
+        /**
+         * Groups the element indices by child with a counting sort over the
+         * type ids: a histogram pass, then a stable scatter pass. This allows
+         * to process the elements of each child in batch instead of
+         * dispatching on the type of each element.
+         */
+        union_partition partition() const;
+
     protected:
 
         using type_id_map = std::array<std::uint8_t, 256>;
@@ -271,6 +323,83 @@ namespace sparrow
         return const_iterator(const_functor_type{&(this->derived_cast())}, this->size());
     }
 
+    template <class DERIVED>
+    std::size_t union_array_crtp_base<DERIVED>::children_count() const
+    {
+        return m_children.size();
+    }
+
+    template <class DERIVED>
+    const array_wrapper* union_array_crtp_base<DERIVED>::raw_child(std::size_t i) const
+    {
+        SPARROW_ASSERT_TRUE(i < m_children.size());
+        return m_children[i].get();
+    }
+
+    template <class DERIVED>
+    std::size_t union_array_crtp_base<DERIVED>::child_index(std::size_t i) const
+    {
+        return static_cast<std::size_t>(m_type_id_map[static_cast<std::size_t>(p_type_ids[i])]);
+    }
+
+    template <class DERIVED>
+    std::size_t union_array_crtp_base<DERIVED>::child_element_index(std::size_t i) const
+    {
+        return this->derived_cast().element_offset(i);
+    }
+
+    template <class DERIVED>
+    union_partition union_array_crtp_base<DERIVED>::partition() const
+    {
+        const std::size_t n = size();
+        const std::size_t n_children = m_children.size();
+
+        // Four interleaved histograms, so that consecutive equal type ids
+        // do not serialize on the same counter.
+        std::array<std::array<std::size_t, 256>, 4> histograms{};
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            ++histograms[0][p_type_ids[i]];
+            ++histograms[1][p_type_ids[i + 1]];
+            ++histograms[2][p_type_ids[i + 2]];
+            ++histograms[3][p_type_ids[i + 3]];
+        }
+        for (; i < n; ++i)
+        {
+            ++histograms[0][p_type_ids[i]];
+        }
+
+        union_partition result;
+        result.bounds.assign(n_children + 1, 0);
+        for (std::size_t type_id = 0; type_id < 256; ++type_id)
+        {
+            const std::size_t count = histograms[0][type_id] + histograms[1][type_id] + histograms[2][type_id]
+                                      + histograms[3][type_id];
+            if (count != 0)
+            {
+                const std::size_t child = m_type_id_map[type_id];
+                SPARROW_ASSERT_TRUE(child < n_children);
+                result.bounds[child + 1] += count;
+            }
+        }
+        for (std::size_t c = 0; c < n_children; ++c)
+        {
+            result.bounds[c + 1] += result.bounds[c];
+        }
+
+        std::vector<std::size_t> cursors(result.bounds.begin(), result.bounds.end() - 1);
+        result.rows.resize(n);
+        result.indices.resize(n);
+        for (i = 0; i < n; ++i)
+        {
+            const std::size_t pos = cursors[child_index(i)]++;
+            result.rows[pos] = i;
+            result.indices[pos] = child_element_index(i);
+        }
+        return result;
+    }
+
     template <class DERIVED>
     auto union_array_crtp_base<DERIVED>::make_children(arrow_proxy& proxy) -> children_type
     {
@@ -0,0 +1,273 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+#include "sparrow/layout/union_array.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    namespace detail
+    {
+        // True if indices is a range of consecutive increasing integers.
+        inline bool is_contiguous(std::span<const std::size_t> indices)
+        {
+            for (std::size_t k = 1; k < indices.size(); ++k)
+            {
+                if (indices[k] != indices[0] + k)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    /**
+     * Elements of a union array held by one of its children.
+     *
+     * @tparam A the concrete type of the child.
+     */
+    template <class A>
+    struct union_batch
+    {
+        const A& child;
+        // Index of the child in the union.
+        std::size_t child_index;
+        // Indices of the elements in the union, sorted.
+        std::span<const std::size_t> rows;
+        // Indices of the elements in the child.
+        std::span<const std::size_t> indices;
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return rows.size();
+        }
+
+        /**
+         * True if the elements are stored contiguously in the child, at
+         * indices [indices.front(), indices.front() + size()). This is
+         * usually the case for dense unions.
+         */
+        [[nodiscard]] bool contiguous() const
+        {
+            return detail::is_contiguous(indices);
+        }
+    };
+
+    /**
+     * Partitions the elements of \c ar by child, then calls \c f once per
+     * non-empty child with a union_batch of its concrete type. The type of
+     * each child is resolved once instead of once per element.
+     */
+    template <class D, class F>
+    void union_scan(const union_array_crtp_base<D>& ar, F&& f);
+
+    /**
+     * Splits \c ar into one dense array per child, holding the elements of
+     * the union stored in that child, in order. Children whose elements are
+     * contiguous are sliced and may be of any type; other children are
+     * gathered and must be primitive or variable size binary arrays.
+     *
+     * @throws std::invalid_argument if a child must be gathered and is not
+     *         of a supported type.
+     */
+    template <class D>
+    [[nodiscard]] std::vector<array> split_union(const union_array_crtp_base<D>& ar);
+
+    /********************************
+     * union kernels implementation *
+     ********************************/
+
+    namespace detail
+    {
+        template <class A>
+        struct union_gather
+        {
+            static constexpr bool supported = false;
+        };
+
+        template <class T>
+        struct union_gather<primitive_array<T>>
+        {
+            static constexpr bool supported = true;
+
+            static primitive_array<T> gather(const primitive_array<T>& child, std::span<const std::size_t> indices)
+            {
+                const typed_view<T> view(child);
+                const T* values = view.data();
+                const std::size_t size = view.size();
+                const std::size_t n = indices.size();
+                u8_buffer<T> result(n);
+                T* out = result.data();
+                // Indices past the end of the child give nulls, as in gather_validity.
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    out[i] = indices[i] < size ? values[indices[i]] : T{};
+                }
+                return primitive_array<T>(std::move(result), gather_validity(view.validity(), indices));
+            }
+
+            static primitive_array<T> slice(const primitive_array<T>& child, std::size_t first, std::size_t count)
+            {
+                const typed_view<T> view(child);
+                u8_buffer<T> result(view.values().subspan(first, count));
+                const validity_view& validity = view.validity();
+                // The null count of the range is unknown, count is an upper bound.
+                const validity_view range(
+                    validity.data(),
+                    validity.offset() + first,
+                    count,
+                    validity.all_valid() ? 0 : count
+                );
+                return primitive_array<T>(std::move(result), copy_validity(range));
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct union_gather<variable_size_binary_array<T, CR, OT>>
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+            static constexpr bool supported = true;
+
+            static array_type gather(const array_type& child, std::span<const std::size_t> indices)
+            {
+                const validity_view validity = make_validity_view(child.get_arrow_proxy());
+                return gather_binary(
+                    child,
+                    indices,
+                    [&](std::size_t i)
+                    {
+                        return indices[i] < validity.size() && validity[indices[i]];
+                    }
+                );
+            }
+
+            static array_type slice(const array_type& child, std::size_t first, std::size_t count)
+            {
+                const validity_view validity = make_validity_view(child.get_arrow_proxy());
+                return gather_binary(
+                    child,
+                    std::views::iota(first, first + count),
+                    [&](std::size_t i)
+                    {
+                        return validity[first + i];
+                    }
+                );
+            }
+        };
+
+        // Copy of the elements [first, first + count) of a child. Primitive
+        // and variable size binary children only copy these elements; other
+        // children are copied as a whole, then offset.
+        inline array slice_child(const array_wrapper& child, std::size_t first, std::size_t count)
+        {
+            return visit(
+                [&](const auto& typed_child) -> array
+                {
+                    using child_type = std::decay_t<decltype(typed_child)>;
+                    if constexpr (union_gather<child_type>::supported)
+                    {
+                        return array(union_gather<child_type>::slice(typed_child, first, count));
+                    }
+                    else
+                    {
+                        arrow_proxy proxy(child.get_arrow_proxy());
+                        proxy.set_offset(proxy.offset() + first);
+                        proxy.set_length(count);
+                        return array(proxy.extract_array(), proxy.extract_schema());
+                    }
+                },
+                child
+            );
+        }
+    }
+
+    template <class D, class F>
+    void union_scan(const union_array_crtp_base<D>& ar, F&& f)
+    {
+        const union_partition partition = ar.partition();
+        for (std::size_t c = 0; c < partition.children_count(); ++c)
+        {
+            const auto rows = partition.rows_of(c);
+            if (rows.empty())
+            {
+                continue;
+            }
+            const auto indices = partition.indices_of(c);
+            visit(
+                [&](const auto& child)
+                {
+                    using child_type = std::decay_t<decltype(child)>;
+                    f(union_batch<child_type>{child, c, rows, indices});
+                },
+                *ar.raw_child(c)
+            );
+        }
+    }
+
+    template <class D>
+    std::vector<array> split_union(const union_array_crtp_base<D>& ar)
+    {
+        const union_partition partition = ar.partition();
+        std::vector<array> result;
+        result.reserve(partition.children_count());
+        for (std::size_t c = 0; c < partition.children_count(); ++c)
+        {
+            const auto indices = partition.indices_of(c);
+            const array_wrapper& child = *ar.raw_child(c);
+            if (detail::is_contiguous(indices))
+            {
+                result.push_back(detail::slice_child(child, indices.empty() ? 0 : indices.front(), indices.size()));
+                continue;
+            }
+            result.push_back(visit(
+                [&](const auto& typed_child) -> array
+                {
+                    using child_type = std::decay_t<decltype(typed_child)>;
+                    if constexpr (detail::union_gather<child_type>::supported)
+                    {
+                        return array(detail::union_gather<child_type>::gather(typed_child, indices));
+                    }
+                    else
+                    {
+                        throw std::invalid_argument(
+                            "union children that are not contiguous must be primitive or variable size binary arrays"
+                        );
+                    }
+                },
+                child
+            ));
+        }
+        return result;
+    }
+}
@@ -14,22 +14,76 @@
 
 #pragma once
 
+#include <algorithm>
 #include <concepts>
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/buffer/buffer_adaptor.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp"
 #include "sparrow/layout/array_bitmap_base.hpp"
+#include "sparrow/layout/borrowed_proxy.hpp"
 #include "sparrow/layout/layout_iterator.hpp"
 #include "sparrow/types/data_type.hpp"
 #include "sparrow/utils/contracts.hpp"
 #include "sparrow/utils/iterator.hpp"
 #include "sparrow/utils/nullable.hpp"
+#include "sparrow/utils/utf8.hpp"
 
 namespace sparrow
 {
     template <std::ranges::sized_range T, class CR, layout_offset OT = std::int32_t>
     class variable_size_binary_array;
 
+    using string_array = variable_size_binary_array<std::string, std::string_view, std::int32_t>;
+    using big_string_array = variable_size_binary_array<std::string, std::string_view, std::int64_t>;
+    using binary_array = variable_size_binary_array<std::vector<byte_t>, std::span<const byte_t>, std::int32_t>;
+    using big_binary_array = variable_size_binary_array<std::vector<byte_t>, std::span<const byte_t>, std::int64_t>;
+
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+
+        // The value type alone does not tell the width of the offsets, we need
+        // to specialize this to distinguish STRING from LARGE_STRING (and BINARY
+        // from LARGE_BINARY).
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        struct get_data_type_from_array<sparrow::variable_size_binary_array<T, CR, OT>>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                constexpr bool is_big = sizeof(OT) == sizeof(std::int64_t);
+                if constexpr (std::same_as<T, std::string>)
+                {
+                    return is_big ? sparrow::data_type::LARGE_STRING : sparrow::data_type::STRING;
+                }
+                else
+                {
+                    return is_big ? sparrow::data_type::LARGE_BINARY : sparrow::data_type::BINARY;
+                }
+            }
+        };
+    }
+
+    /**
+     * Tag type requesting the validation of the buffers of a variable size
+     * binary array built from an arrow_proxy.
+     */
+    struct validate_buffers_t
+    {
+    };
+
+    inline constexpr validate_buffers_t validate_buffers{};
+
     template <class L>
     class variable_size_binary_reference;
 
@@ -42,14 +96,14 @@ namespace sparrow
         using array_type = variable_size_binary_array<T, CR, OT>;
 
         using inner_value_type = T;
-        // using inner_reference = variable_size_binary_reference<self_type>;
+        using inner_reference = variable_size_binary_reference<array_type>;
         using inner_const_reference = CR;
         using offset_type = OT;
 
         using data_value_type = typename T::value_type;
-        // using offset_iterator = OT*;
+        using offset_iterator = OT*;
         using const_offset_iterator = const OT*;
-        // using data_iterator = data_value_type*;
+        using data_iterator = data_value_type*;
         using const_data_iterator = const data_value_type*;
 
         using iterator_tag = std::random_access_iterator_tag;
@@ -57,6 +111,15 @@ namespace sparrow
         using const_bitmap_iterator = bitmap_type::const_iterator;
 
         struct iterator_types
+        {
+            using value_type = inner_value_type;
+            using reference = inner_reference;
+            using value_iterator = data_iterator;
+            using bitmap_iterator = bitmap_type::iterator;
+            using iterator_tag = array_inner_types<variable_size_binary_array<T, CR, OT>>::iterator_tag;
+        };
+
+        struct const_iterator_types
         {
             using value_type = inner_value_type;
             using reference = inner_const_reference;
@@ -65,11 +128,8 @@ namespace sparrow
             using iterator_tag = array_inner_types<variable_size_binary_array<T, CR, OT>>::iterator_tag;
         };
 
-        // using value_iterator = variable_size_binary_value_iterator<array_type, false>;
-        using const_value_iterator = variable_size_binary_value_iterator<array_type, iterator_types>;
-
-        // using iterator = layout_iterator<array_type, false>;
-        // using const_iterator = layout_iterator<array_type, true, CR>;
+        using value_iterator = variable_size_binary_value_iterator<array_type, iterator_types>;
+        using const_value_iterator = variable_size_binary_value_iterator<array_type, const_iterator_types>;
     };
 
     /**
@@ -96,7 +156,10 @@ namespace sparrow
             typename Iterator_types::reference>;
         using reference = typename base_type::reference;
         using difference_type = typename base_type::difference_type;
-        using layout_type = mpl::constify_t<Layout, true>;
+        // Mutable iterators return reference proxies that need a mutable layout
+        using layout_type = mpl::constify_t<
+            Layout,
+            !std::same_as<typename Iterator_types::reference, variable_size_binary_reference<Layout>>>;
         using size_type = size_t;
         using value_type = base_type::value_type;
 
@@ -135,8 +198,8 @@ namespace sparrow
         using const_reference = typename L::inner_const_reference;
         using size_type = typename L::size_type;
         using difference_type = std::ptrdiff_t;
-        using iterator = typename L::value_iterator;
-        using const_iterator = typename L::const_value_iterator;
+        using iterator = typename L::data_iterator;
+        using const_iterator = typename L::const_data_iterator;
         using offset_type = typename L::offset_type;
 
         variable_size_binary_reference(L* layout, size_type index);
@@ -156,9 +219,6 @@ namespace sparrow
 
         size_type size() const;
 
-        // iterator begin();
-        // iterator end();
-
         const_iterator begin() const;
         const_iterator end() const;
         const_iterator cbegin() const;
@@ -189,76 +249,366 @@ namespace sparrow
         size_type m_index = size_type(0);
     };
 
+    /**
+     * Collection of point updates of a variable size binary array.
+     *
+     * Updates are recorded without touching the array; they are applied
+     * all at once by variable_size_binary_array::apply_edits, in a single
+     * pass over the offsets and data buffers. When an index is updated
+     * several times, the last update wins.
+     *
+     * @tparam D the type of the elements of the values (char for strings,
+     *           byte_t for binary values).
+     */
+    template <class D>
+    class variable_size_binary_edits
+    {
+    public:
+
+        using self_type = variable_size_binary_edits<D>;
+        using data_value_type = D;
+        using size_type = std::size_t;
+
+        /**
+         * Records that the element at \c index is replaced by \c value.
+         */
+        template <std::ranges::sized_range R>
+            requires std::convertible_to<std::ranges::range_value_t<R>, D>
+        self_type& set(size_type index, const R& value);
+
+        // This is to avoid string literals from being caught by the previous
+        // overload, that would include the null-terminating char.
+        template <class U = D>
+            requires std::same_as<U, char>
+        self_type& set(size_type index, const char* value);
+
+        /**
+         * Records that the element at \c index becomes null.
+         */
+        self_type& set(size_type index, nullval_t);
+
+        size_type size() const noexcept;
+        bool empty() const noexcept;
+        void clear() noexcept;
+
+    private:
+
+        struct edit
+        {
+            size_type index;
+            size_type data_begin;
+            size_type data_size;
+            bool valid;
+        };
+
+        std::vector<edit> m_edits;
+        std::vector<D> m_data;
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        friend class variable_size_binary_array;
+    };
+
     template <std::ranges::sized_range T, class CR, layout_offset OT>
-    class variable_size_binary_array final : public array_bitmap_base<variable_size_binary_array<T, CR, OT>>
+    class variable_size_binary_array final
+        : public mutable_array_bitmap_base<variable_size_binary_array<T, CR, OT>>
     {
     public:
 
         using self_type = variable_size_binary_array<T, CR, OT>;
-        using base_type = array_bitmap_base<self_type>;
+        using base_type = mutable_array_bitmap_base<self_type>;
         using inner_types = array_inner_types<self_type>;
         using inner_value_type = typename inner_types::inner_value_type;
-        // using inner_reference = typename inner_types::inner_reference;
+        using inner_reference = typename inner_types::inner_reference;
         using inner_const_reference = typename inner_types::inner_const_reference;
         using offset_type = typename inner_types::offset_type;
         using bitmap_type = typename inner_types::bitmap_type;
-        // using bitmap_reference = typename base_type::bitmap_reference;
+        using bitmap_reference = typename base_type::bitmap_reference;
         using bitmap_const_reference = typename base_type::bitmap_const_reference;
         using value_type = nullable<inner_value_type>;
-        // using reference = nullable<inner_reference, bitmap_reference>;
+        using reference = nullable<inner_reference, bitmap_reference>;
         using const_reference = nullable<inner_const_reference, bitmap_const_reference>;
-        // using offset_iterator = typename inner_types::offset_iterator;
+        using offset_iterator = typename inner_types::offset_iterator;
         using const_offset_iterator = typename inner_types::const_offset_iterator;
         using size_type = typename base_type::size_type;
         using difference_type = typename base_type::difference_type;
         using iterator_tag = typename base_type::iterator_tag;
-        // using data_iterator = typename inner_types::data_iterator;
+        using data_iterator = typename inner_types::data_iterator;
         using const_data_iterator = typename inner_types::const_data_iterator;
         using data_value_type = typename inner_types::data_value_type;
 
-        // using bitmap_range = typename base_type::bitmap_range;
+        using bitmap_range = typename base_type::bitmap_range;
         using const_bitmap_range = typename base_type::const_bitmap_range;
 
-        // using value_iterator = typename inner_types::value_iterator;
+        using value_iterator = typename inner_types::value_iterator;
         using const_value_iterator = typename inner_types::const_value_iterator;
 
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using edits_type = variable_size_binary_edits<data_value_type>;
+
         explicit variable_size_binary_array(arrow_proxy);
 
+        /**
+         * Builds the array and validates its buffers: the offsets must be
+         * non-negative and monotonic and, for string layouts, the non-null
+         * values must be valid UTF-8.
+         *
+         * @exception std::invalid_argument if the buffers are not valid.
+         */
+        variable_size_binary_array(arrow_proxy, validate_buffers_t);
+
+        /**
+         * Returns true if the buffers of the array have been validated. The
+         * state is kept by the array and is reset by any modification of its
+         * values.
+         */
+        bool is_validated() const;
+
         using base_type::size;
         using base_type::get_arrow_proxy;
 
+        /**
+         * Applies all the updates recorded in \c edits in a single pass over
+         * the offsets and data buffers, regardless of the number of updates.
+         * The complexity is linear in the size of the array plus the number
+         * of updates.
+         *
+         * @exception std::length_error if the resulting data does not fit
+         *            in the offset type.
+         */
+        void apply_edits(const edits_type& edits);
+
     private:
 
         static constexpr size_t OFFSET_BUFFER_INDEX = 1;
         static constexpr size_t DATA_BUFFER_INDEX = 2;
 
-        // offset_iterator offset(size_type i);
-        // offset_iterator offset_end();
-        // data_iterator data(size_type i);
+        offset_iterator offset(size_type i);
+        data_iterator data(size_type i);
 
         const_offset_iterator offset(size_type i) const;
         const_offset_iterator offset_end() const;
         const_data_iterator data(size_type i) const;
 
-        // template <std::ranges::sized_range U>
-        //     requires mpl::convertible_ranges<U, T>
-        // void assign(U&& rhs, size_type index);
+        template <std::ranges::sized_range U>
+            requires mpl::convertible_ranges<U, T>
+        void assign(U&& rhs, size_type index);
 
-        // inner_reference value(size_type i);
+        inner_reference value(size_type i);
         inner_const_reference value(size_type i) const;
 
-        // value_iterator value_begin();
-        // value_iterator value_end();
-
+        value_iterator value_begin();
+        value_iterator value_end();
 
         const_value_iterator value_cbegin() const;
         const_value_iterator value_cend() const;
 
+        // Modifiers
+
+        void resize_values(size_type new_length, inner_value_type value);
+
+        value_iterator insert_value(const_value_iterator pos, inner_value_type value, size_type count);
+
+        template <std::forward_iterator InputIt>
+        value_iterator insert_values(const_value_iterator pos, InputIt first, InputIt last);
+
+        value_iterator erase_values(const_value_iterator pos, size_type count);
+
+        buffer_adaptor<OT, buffer<uint8_t>&> get_offset_buffer();
+        buffer<uint8_t>& get_data_buffer();
+
+        static void check_data_size(size_type data_size);
+
+        bool m_validated = false;
+
         friend class array_crtp_base<self_type>;
         friend class variable_size_binary_reference<self_type>;
         friend const_value_iterator;
+        friend value_iterator;
+        friend base_type;
+        friend base_type::base_type;
     };
 
+    /**
+     * Returns true if the offsets of \c ar can be represented with 32-bit integers,
+     * i.e. if \c ar can be converted to the layout with 32-bit offsets.
+     */
+    template <std::ranges::sized_range T, class CR>
+    bool fits_small_offsets(const variable_size_binary_array<T, CR, std::int64_t>& ar);
+
+    /**
+     * Converts a layout with 64-bit offsets into a layout with 32-bit offsets.
+     * The validity bitmap and the data buffer are moved to the new layout, or
+     * shared with it when they are not owned by sparrow; only the offsets
+     * buffer is rewritten.
+     *
+     * @exception std::runtime_error if the offsets do not fit in 32-bit integers.
+     */
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int32_t>
+    to_small_offsets(variable_size_binary_array<T, CR, std::int64_t>&& ar);
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int32_t>
+    to_small_offsets(const variable_size_binary_array<T, CR, std::int64_t>& ar);
+
+    /**
+     * Converts a layout with 32-bit offsets into a layout with 64-bit offsets.
+     * This is required when the data of the array is about to exceed 2 GiB.
+     * The buffers are handled as in to_small_offsets.
+     */
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int64_t>
+    to_large_offsets(variable_size_binary_array<T, CR, std::int32_t>&& ar);
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int64_t>
+    to_large_offsets(const variable_size_binary_array<T, CR, std::int32_t>& ar);
+
+    namespace detail
+    {
+        // Checks that the offsets are non-negative and monotonic and, if
+        // check_utf8 is true, that the non-null values are valid UTF-8.
+        template <layout_offset OT>
+        void validate_variable_size_binary(const arrow_proxy& proxy, bool check_utf8)
+        {
+            const std::size_t length = proxy.length();
+            if (length == 0)
+            {
+                return;
+            }
+            const auto array_offset = static_cast<std::size_t>(proxy.offset());
+            const auto& buffers = proxy.buffers();
+            const OT* offsets = buffers[1].template data<const OT>();
+            if (offsets == nullptr)
+            {
+                throw std::invalid_argument("variable size binary array: missing offsets buffer");
+            }
+            offsets += array_offset;
+
+            // Branchless reduction so that the compiler can vectorize the
+            // comparisons, the faulty index is searched only on failure.
+            bool monotonic = offsets[0] >= 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                monotonic &= offsets[i] <= offsets[i + 1];
+            }
+            if (!monotonic)
+            {
+                throw std::invalid_argument("variable size binary array: offsets are negative or decreasing");
+            }
+
+            const auto data_end = static_cast<std::size_t>(offsets[length]);
+            const std::uint8_t* data = buffers[2].template data<const std::uint8_t>();
+            if (data == nullptr && data_end != 0)
+            {
+                throw std::invalid_argument("variable size binary array: missing data buffer");
+            }
+            if (!check_utf8)
+            {
+                return;
+            }
+
+            auto throw_invalid_utf8 = [](std::size_t index)
+            {
+                throw std::invalid_argument(
+                    "variable size binary array: invalid UTF-8 sequence in value " + std::to_string(index)
+                );
+            };
+
+            const std::uint8_t* bitmap_data = buffers[0].data();
+            if (proxy.null_count() == 0 || bitmap_data == nullptr)
+            {
+                // The data is validated at once; the values are then valid if
+                // none of them starts in the middle of a character.
+                const auto data_begin = static_cast<std::size_t>(offsets[0]);
+                const std::size_t invalid_pos = data_begin
+                                                + find_invalid_utf8(data + data_begin, data_end - data_begin);
+                if (invalid_pos != data_end)
+                {
+                    const auto it = std::upper_bound(offsets, offsets + length + 1, static_cast<OT>(invalid_pos));
+                    throw_invalid_utf8(static_cast<std::size_t>(std::distance(offsets, it)) - 1);
+                }
+                for (std::size_t i = 1; i < length; ++i)
+                {
+                    const auto value_begin = static_cast<std::size_t>(offsets[i]);
+                    if (value_begin < data_end && is_utf8_continuation_byte(data[value_begin]))
+                    {
+                        throw_invalid_utf8(i);
+                    }
+                }
+            }
+            else
+            {
+                // Null values may hold arbitrary bytes, only the non-null ones
+                // are validated.
+                const dynamic_bitset_view<const std::uint8_t> bitmap(bitmap_data, array_offset + length);
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    if (!bitmap.test(array_offset + i))
+                    {
+                        continue;
+                    }
+                    const auto value_begin = static_cast<std::size_t>(offsets[i]);
+                    const auto value_size = static_cast<std::size_t>(offsets[i + 1]) - value_begin;
+                    if (find_invalid_utf8(data + value_begin, value_size) != value_size)
+                    {
+                        throw_invalid_utf8(i);
+                    }
+                }
+            }
+        }
+    }
+
+    /*********************************************
+     * variable_size_binary_edits implementation *
+     *********************************************/
+
+    template <class D>
+    template <std::ranges::sized_range R>
+        requires std::convertible_to<std::ranges::range_value_t<R>, D>
+    auto variable_size_binary_edits<D>::set(size_type index, const R& value) -> self_type&
+    {
+        m_edits.push_back({index, m_data.size(), static_cast<size_type>(std::ranges::size(value)), true});
+        m_data.insert(m_data.end(), std::ranges::begin(value), std::ranges::end(value));
+        return *this;
+    }
+
+    template <class D>
+    template <class U>
+        requires std::same_as<U, char>
+    auto variable_size_binary_edits<D>::set(size_type index, const char* value) -> self_type&
+    {
+        return set(index, std::string_view(value));
+    }
+
+    template <class D>
+    auto variable_size_binary_edits<D>::set(size_type index, nullval_t) -> self_type&
+    {
+        m_edits.push_back({index, m_data.size(), 0u, false});
+        return *this;
+    }
+
+    template <class D>
+    auto variable_size_binary_edits<D>::size() const noexcept -> size_type
+    {
+        return m_edits.size();
+    }
+
+    template <class D>
+    bool variable_size_binary_edits<D>::empty() const noexcept
+    {
+        return m_edits.empty();
+    }
+
+    template <class D>
+    void variable_size_binary_edits<D>::clear() noexcept
+    {
+        m_edits.clear();
+        m_data.clear();
+    }
+
     /******************************************************
      * variable_size_binary_value_iterator implementation *
      ******************************************************/
@@ -276,14 +626,7 @@ namespace sparrow
     template <class Layout, iterator_types Iterator_types>
     auto variable_size_binary_value_iterator<Layout, Iterator_types>::dereference() const -> reference
     {
-        // if constexpr (is_const)
-        // {
         return p_layout->value(static_cast<size_type>(m_index));
-        // }
-        // else
-        // {
-        //     return reference(p_layout, static_cast<size_type>(m_index));
-        // }
     }
 
     template <class Layout, iterator_types Iterator_types>
@@ -357,18 +700,6 @@ namespace sparrow
         return static_cast<size_type>(offset(m_index + 1) - offset(m_index));
     }
 
-    // template <class L>
-    // auto variable_size_binary_reference<L>::begin() -> iterator
-    // {
-    //     return p_layout->data(uoffset(m_index));
-    // }
-
-    // template <class L>
-    // auto variable_size_binary_reference<L>::end() -> iterator
-    // {
-    //     return p_layout->data(uoffset(m_index + 1));
-    // }
-
     template <class L>
     auto variable_size_binary_reference<L>::begin() const -> const_iterator
     {
@@ -446,28 +777,36 @@ namespace sparrow
         : base_type(std::move(proxy))
     {
         const auto type = get_arrow_proxy().data_type();
-        SPARROW_ASSERT_TRUE(type == data_type::STRING || type == data_type::BINARY);  // TODO: Add
-                                                                                      // data_type::LARGE_STRING
-                                                                                      // and
-                                                                                      // data_type::LARGE_BINARY
+        SPARROW_ASSERT_TRUE(
+            type == data_type::STRING || type == data_type::BINARY || type == data_type::LARGE_STRING
+            || type == data_type::LARGE_BINARY
+        );
         SPARROW_ASSERT_TRUE(
             ((type == data_type::STRING || type == data_type::BINARY) && std::same_as<OT, int32_t>)
+            || ((type == data_type::LARGE_STRING || type == data_type::LARGE_BINARY) && std::same_as<OT, int64_t>)
         );
     }
 
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // auto variable_size_binary_array<T, CR, OT>::data() -> pointer
-    // {
-    //     return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<inner_value_type>()
-    //            + static_cast<size_type>(get_arrow_proxy().offset());
-    // }
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT>::variable_size_binary_array(arrow_proxy proxy, validate_buffers_t)
+        : variable_size_binary_array(std::move(proxy))
+    {
+        detail::validate_variable_size_binary<OT>(get_arrow_proxy(), std::same_as<T, std::string>);
+        m_validated = true;
+    }
 
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // auto variable_size_binary_array<T, CR, OT>::data(size_type i) -> data_iterator
-    // {
-    //     SPARROW_ASSERT_FALSE(get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].size() == 0u);
-    //     return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<data_value_type>() + i;
-    // }
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    bool variable_size_binary_array<T, CR, OT>::is_validated() const
+    {
+        return m_validated;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::data(size_type i) -> data_iterator
+    {
+        SPARROW_ASSERT_FALSE(get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].size() == 0u);
+        return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<data_value_type>() + i;
+    }
 
     template <std::ranges::sized_range T, class CR, layout_offset OT>
     auto variable_size_binary_array<T, CR, OT>::data(size_type i) const -> const_data_iterator
@@ -476,66 +815,77 @@ namespace sparrow
         return get_arrow_proxy().buffers()[DATA_BUFFER_INDEX].template data<const data_value_type>() + i;
     }
 
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // template <std::ranges::sized_range U>
-    //     requires mpl::convertible_ranges<U, T>
-    // void variable_size_binary_array<T, CR, OT>::assign(U&& rhs, size_type index)
-    // {
-    //     auto& data_buffer = get_arrow_proxy().buffers()[1];
-    //     const auto offset_beg = *offset(index);
-    //     const auto offset_end = *offset(index + 1);
-    //     const auto initial_value_length = offset_end - offset_beg;
-    //     const auto new_value_length = static_cast<difference_type>(std::ranges::size(rhs));
-    //     const auto shift_val = new_value_length - initial_value_length;
-
-    //     if (shift_val != 0)
-    //     {
-    //         const auto shift_val_abs = static_cast<size_type>(std::abs(shift_val));
-    //         const auto layout_data_length = size();
-    //         const auto new_data_buffer_size = shift_val < 0 ? data_buffer.size() - shift_val_abs
-    //                                                         : data_buffer.size() + shift_val_abs;
-    //         data_buffer.resize(new_data_buffer_size);
-    //         // Move elements to make space for the new value
-    //         std::move_backward(data_buffer.begin() + offset_end, data_buffer.end() - shift_val,
-    //         data_buffer.end());
-    //         // Adjust offsets for subsequent elements
-    //         std::for_each(
-    //             std::execution::unseq,
-    //             offset(index + 1),
-    //             offset(layout_data_length + 1),
-    //             [shift_val](auto& offset)
-    //             {
-    //                 offset += shift_val;
-    //             }
-    //         );
-    //     }
-    //     // Copy the new value into the buffer
-    //     std::copy(std::ranges::begin(rhs), std::ranges::end(rhs), data_buffer.begin() + offset_beg);
-    // }
-
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // auto variable_size_binary_array<T, CR, OT>::offset(size_type i) -> offset_iterator
-    // {
-    //     SPARROW_ASSERT_TRUE(i < size() + get_arrow_proxy().offset());
-    //     return get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].template data<OT>()
-    //            + static_cast<size_type>(get_arrow_proxy().offset()) + i;
-    // }
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    template <std::ranges::sized_range U>
+        requires mpl::convertible_ranges<U, T>
+    void variable_size_binary_array<T, CR, OT>::assign(U&& rhs, size_type index)
+    {
+        SPARROW_ASSERT_TRUE(index < size());
+        m_validated = false;
+        const auto array_offset = static_cast<size_type>(get_arrow_proxy().offset());
+        auto offsets = get_offset_buffer();
+        const auto& old_data = get_data_buffer();
+        const auto value_begin = static_cast<size_type>(offsets[array_offset + index]);
+        const auto value_end = static_cast<size_type>(offsets[array_offset + index + 1]);
+        const auto old_value_size = value_end - value_begin;
+        const auto new_value_size = static_cast<size_type>(std::ranges::size(rhs));
+        if (new_value_size == old_value_size)
+        {
+            // Values of the same size are overwritten in place; rhs is either
+            // this very value or does not overlap it.
+            auto* value_data = get_data_buffer().template data<data_value_type>() + value_begin;
+            if constexpr (std::ranges::contiguous_range<U>)
+            {
+                if (static_cast<const void*>(std::ranges::data(rhs)) == static_cast<const void*>(value_data))
+                {
+                    return;
+                }
+            }
+            std::ranges::copy(rhs, value_data);
+            return;
+        }
+        check_data_size(static_cast<size_type>(offsets[array_offset + size()]) - old_value_size + new_value_size);
+
+        // rhs may refer to a value of this array, it is copied before the
+        // offsets are modified.
+        buffer<uint8_t> new_data(old_data.size() - old_value_size + new_value_size);
+        std::copy(old_data.cbegin(), sparrow::next(old_data.cbegin(), value_begin), new_data.begin());
+        std::ranges::copy(rhs, new_data.template data<data_value_type>() + value_begin);
+        std::copy(
+            sparrow::next(old_data.cbegin(), value_end),
+            old_data.cend(),
+            sparrow::next(new_data.begin(), value_begin + new_value_size)
+        );
+
+        for (size_type i = array_offset + index + 1; i <= array_offset + size(); ++i)
+        {
+            offsets[i] = static_cast<OT>(offsets[i] - static_cast<OT>(old_value_size) + static_cast<OT>(new_value_size));
+        }
+        get_arrow_proxy().set_buffer(DATA_BUFFER_INDEX, std::move(new_data));
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::offset(size_type i) -> offset_iterator
+    {
+        SPARROW_ASSERT_TRUE(i <= size());
+        return get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].template data<OT>()
+               + static_cast<size_type>(get_arrow_proxy().offset()) + i;
+    }
 
     template <std::ranges::sized_range T, class CR, layout_offset OT>
     auto variable_size_binary_array<T, CR, OT>::offset(size_type i) const -> const_offset_iterator
     {
-        SPARROW_ASSERT_TRUE(i < size() + get_arrow_proxy().offset());
+        SPARROW_ASSERT_TRUE(i <= size());
         return get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].template data<OT>()
                + static_cast<size_type>(get_arrow_proxy().offset()) + i;
     }
 
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // auto variable_size_binary_array<T, CR, OT>::value(size_type i) -> inner_reference
-    // {
-    //     SPARROW_ASSERT_TRUE(i < size());
-    //     return get_arrow_proxy().buffers()[OFFSET_BUFFER_INDEX].template data<OT>()
-    //            + static_cast<size_type>(get_arrow_proxy().offset()) + i;
-    // }
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::value(size_type i) -> inner_reference
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return inner_reference(this, i);
+    }
 
     template <std::ranges::sized_range T, class CR, layout_offset OT>
     auto variable_size_binary_array<T, CR, OT>::value(size_type i) const -> inner_const_reference
@@ -550,17 +900,17 @@ namespace sparrow
         return inner_const_reference(pointer_begin, pointer_end);
     }
 
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // auto variable_size_binary_array<T, CR, OT>::value_begin() -> value_iterator
-    // {
-    //     return value_iterator{data()};
-    // }
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::value_begin() -> value_iterator
+    {
+        return value_iterator{this, 0};
+    }
 
-    // template <std::ranges::sized_range T, class CR, layout_offset OT>
-    // auto variable_size_binary_array<T, CR, OT>::value_end() -> value_iterator
-    // {
-    //     return sparrow::next(value_begin(), size());
-    // }
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::value_end() -> value_iterator
+    {
+        return sparrow::next(value_begin(), size());
+    }
 
     template <std::ranges::sized_range T, class CR, layout_offset OT>
     auto variable_size_binary_array<T, CR, OT>::value_cbegin() const -> const_value_iterator
@@ -573,4 +923,362 @@ namespace sparrow
     {
         return sparrow::next(value_cbegin(), size());
     }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::get_offset_buffer() -> buffer_adaptor<OT, buffer<uint8_t>&>
+    {
+        auto& buffers = get_arrow_proxy().get_array_private_data()->buffers();
+        return make_buffer_adaptor<OT>(buffers[OFFSET_BUFFER_INDEX]);
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::get_data_buffer() -> buffer<uint8_t>&
+    {
+        auto& buffers = get_arrow_proxy().get_array_private_data()->buffers();
+        return buffers[DATA_BUFFER_INDEX];
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array<T, CR, OT>::check_data_size(size_type data_size)
+    {
+        if (data_size > static_cast<size_type>(std::numeric_limits<OT>::max()))
+        {
+            throw std::length_error("variable size binary data exceeds the capacity of the offset type");
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array<T, CR, OT>::resize_values(size_type new_length, inner_value_type value)
+    {
+        const size_type length = size();
+        if (new_length > length)
+        {
+            insert_value(value_cend(), std::move(value), new_length - length);
+        }
+        else if (new_length < length)
+        {
+            erase_values(sparrow::next(value_cbegin(), new_length), length - new_length);
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::insert_value(
+        const_value_iterator pos,
+        inner_value_type value,
+        size_type count
+    ) -> value_iterator
+    {
+        SPARROW_ASSERT_TRUE(value_cbegin() <= pos);
+        SPARROW_ASSERT_TRUE(pos <= value_cend());
+        m_validated = false;
+        const auto index = static_cast<size_type>(std::distance(value_cbegin(), pos));
+        const auto array_offset = static_cast<size_type>(get_arrow_proxy().offset());
+        auto offsets = get_offset_buffer();
+        auto& data_buffer = get_data_buffer();
+
+        const auto value_size = static_cast<size_type>(std::ranges::size(value));
+        const size_type inserted_size = value_size * count;
+        check_data_size(static_cast<size_type>(offsets[array_offset + size()]) + inserted_size);
+
+        const auto data_pos = static_cast<size_type>(offsets[array_offset + index]);
+        data_buffer.insert(sparrow::next(data_buffer.cbegin(), data_pos), inserted_size, 0);
+        auto* dst = data_buffer.template data<data_value_type>() + data_pos;
+        for (size_type i = 0; i < count; ++i)
+        {
+            dst = std::ranges::copy(value, dst).out;
+        }
+
+        for (size_type i = array_offset + index + 1; i <= array_offset + size(); ++i)
+        {
+            offsets[i] += static_cast<OT>(inserted_size);
+        }
+        offsets.insert(sparrow::next(offsets.cbegin(), array_offset + index + 1), count, OT(0));
+        for (size_type i = 0; i < count; ++i)
+        {
+            offsets[array_offset + index + 1 + i] = static_cast<OT>(data_pos + value_size * (i + 1));
+        }
+        return sparrow::next(value_begin(), index);
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    template <std::forward_iterator InputIt>
+    auto variable_size_binary_array<T, CR, OT>::insert_values(const_value_iterator pos, InputIt first, InputIt last)
+        -> value_iterator
+    {
+        SPARROW_ASSERT_TRUE(value_cbegin() <= pos);
+        SPARROW_ASSERT_TRUE(pos <= value_cend());
+        m_validated = false;
+        const auto index = static_cast<size_type>(std::distance(value_cbegin(), pos));
+        const auto array_offset = static_cast<size_type>(get_arrow_proxy().offset());
+        auto offsets = get_offset_buffer();
+        auto& data_buffer = get_data_buffer();
+
+        // First pass to compute the sizes, so that buffers are resized only once
+        size_type count = 0;
+        size_type inserted_size = 0;
+        for (auto it = first; it != last; ++it)
+        {
+            inserted_size += static_cast<size_type>(std::ranges::size(*it));
+            ++count;
+        }
+        check_data_size(static_cast<size_type>(offsets[array_offset + size()]) + inserted_size);
+
+        const auto data_pos = static_cast<size_type>(offsets[array_offset + index]);
+        data_buffer.insert(sparrow::next(data_buffer.cbegin(), data_pos), inserted_size, 0);
+        for (size_type i = array_offset + index + 1; i <= array_offset + size(); ++i)
+        {
+            offsets[i] += static_cast<OT>(inserted_size);
+        }
+        offsets.insert(sparrow::next(offsets.cbegin(), array_offset + index + 1), count, OT(0));
+
+        auto* dst = data_buffer.template data<data_value_type>() + data_pos;
+        size_type offset_pos = array_offset + index + 1;
+        size_type current = data_pos;
+        for (auto it = first; it != last; ++it, ++offset_pos)
+        {
+            const auto& value = *it;
+            dst = std::ranges::copy(value, dst).out;
+            current += static_cast<size_type>(std::ranges::size(value));
+            offsets[offset_pos] = static_cast<OT>(current);
+        }
+        return sparrow::next(value_begin(), index);
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array<T, CR, OT>::erase_values(const_value_iterator pos, size_type count)
+        -> value_iterator
+    {
+        SPARROW_ASSERT_TRUE(value_cbegin() <= pos);
+        SPARROW_ASSERT_TRUE(pos < value_cend());
+        m_validated = false;
+        const auto index = static_cast<size_type>(std::distance(value_cbegin(), pos));
+        SPARROW_ASSERT_TRUE(index + count <= size());
+        const auto array_offset = static_cast<size_type>(get_arrow_proxy().offset());
+        auto offsets = get_offset_buffer();
+        auto& data_buffer = get_data_buffer();
+
+        const auto data_first = static_cast<size_type>(offsets[array_offset + index]);
+        const auto data_last = static_cast<size_type>(offsets[array_offset + index + count]);
+        const size_type erased_size = data_last - data_first;
+        data_buffer.erase(
+            sparrow::next(data_buffer.cbegin(), data_first),
+            sparrow::next(data_buffer.cbegin(), data_last)
+        );
+
+        const auto offset_first = sparrow::next(offsets.cbegin(), array_offset + index + 1);
+        offsets.erase(offset_first, sparrow::next(offset_first, count));
+        for (size_type i = array_offset + index + 1; i <= array_offset + size() - count; ++i)
+        {
+            offsets[i] -= static_cast<OT>(erased_size);
+        }
+        return sparrow::next(value_begin(), index);
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array<T, CR, OT>::apply_edits(const edits_type& edits)
+    {
+        using edit_type = typename edits_type::edit;
+        if (edits.empty())
+        {
+            return;
+        }
+        m_validated = false;
+
+        // The stable sort keeps the recording order of the updates of a same
+        // index, so that the last one wins.
+        std::vector<size_type> order(edits.m_edits.size());
+        std::iota(order.begin(), order.end(), size_type(0));
+        std::ranges::stable_sort(
+            order,
+            [&edits](size_type lhs, size_type rhs)
+            {
+                return edits.m_edits[lhs].index < edits.m_edits[rhs].index;
+            }
+        );
+        std::vector<const edit_type*> effective_edits;
+        effective_edits.reserve(order.size());
+        for (size_type i : order)
+        {
+            const edit_type& e = edits.m_edits[i];
+            SPARROW_ASSERT_TRUE(e.index < size());
+            if (!effective_edits.empty() && effective_edits.back()->index == e.index)
+            {
+                effective_edits.back() = &e;
+            }
+            else
+            {
+                effective_edits.push_back(&e);
+            }
+        }
+
+        const size_type length = size();
+        const auto array_offset = static_cast<size_type>(get_arrow_proxy().offset());
+        const auto& old_offset_buffer = get_arrow_proxy().get_array_private_data()->buffers()[OFFSET_BUFFER_INDEX];
+        const auto& old_data_buffer = get_data_buffer();
+        const OT* src_offsets = old_offset_buffer.template data<const OT>();
+        const data_value_type* src_data = old_data_buffer.template data<const data_value_type>();
+
+        size_type added_size = 0;
+        size_type removed_size = 0;
+        for (const edit_type* e : effective_edits)
+        {
+            added_size += e->data_size;
+            removed_size += static_cast<size_type>(
+                src_offsets[array_offset + e->index + 1] - src_offsets[array_offset + e->index]
+            );
+        }
+        check_data_size(static_cast<size_type>(src_offsets[array_offset + length]) + added_size - removed_size);
+
+        auto& validity_buffer = get_arrow_proxy().get_array_private_data()->buffers()[0];
+        SPARROW_ASSERT_FALSE(validity_buffer.empty());
+        dynamic_bitset_view<std::uint8_t> validity(validity_buffer.data(), array_offset + length);
+
+        buffer<uint8_t> new_offset_buffer(old_offset_buffer);
+        buffer<uint8_t> new_data_buffer(old_data_buffer.size() + added_size - removed_size);
+        OT* dst_offsets = new_offset_buffer.template data<OT>();
+        data_value_type* dst_data = new_data_buffer.template data<data_value_type>();
+
+        // Data preceding the first element of the array is kept as is.
+        size_type write_pos = static_cast<size_type>(src_offsets[array_offset]);
+        std::copy(src_data, src_data + write_pos, dst_data);
+
+        // Copies the unchanged elements in [first, last) as a single block
+        // and shifts their offsets.
+        auto copy_unchanged = [&](size_type first, size_type last)
+        {
+            const auto data_first = static_cast<size_type>(src_offsets[array_offset + first]);
+            const auto data_last = static_cast<size_type>(src_offsets[array_offset + last]);
+            std::copy(src_data + data_first, src_data + data_last, dst_data + write_pos);
+            for (size_type i = first; i < last; ++i)
+            {
+                const auto value_end = static_cast<size_type>(src_offsets[array_offset + i + 1]);
+                dst_offsets[array_offset + i + 1] = static_cast<OT>(write_pos + value_end - data_first);
+            }
+            write_pos += data_last - data_first;
+        };
+
+        size_type next_index = 0;
+        for (const edit_type* e : effective_edits)
+        {
+            copy_unchanged(next_index, e->index);
+            const auto edit_data = sparrow::next(edits.m_data.cbegin(), e->data_begin);
+            std::copy(edit_data, sparrow::next(edit_data, e->data_size), dst_data + write_pos);
+            write_pos += e->data_size;
+            dst_offsets[array_offset + e->index + 1] = static_cast<OT>(write_pos);
+            validity.set(array_offset + e->index, e->valid);
+            next_index = e->index + 1;
+        }
+        copy_unchanged(next_index, length);
+
+        // Data following the last element of the array is kept as is.
+        const auto data_end = static_cast<size_type>(src_offsets[array_offset + length]);
+        std::copy(src_data + data_end, src_data + old_data_buffer.size(), dst_data + write_pos);
+
+        get_arrow_proxy().set_buffer(OFFSET_BUFFER_INDEX, std::move(new_offset_buffer));
+        get_arrow_proxy().set_buffer(DATA_BUFFER_INDEX, std::move(new_data_buffer));
+        this->update();
+    }
+
+    /*********************************************************
+     * variable_size_binary_array conversions implementation *
+     *********************************************************/
+
+    namespace detail
+    {
+        constexpr data_type with_offset_width(data_type dt, bool large)
+        {
+            if (dt == data_type::STRING || dt == data_type::LARGE_STRING)
+            {
+                return large ? data_type::LARGE_STRING : data_type::STRING;
+            }
+            return large ? data_type::LARGE_BINARY : data_type::BINARY;
+        }
+
+        // Rewrites the offsets buffer of proxy with offsets of type TO. The other
+        // buffers are left untouched: they are kept in proxy when sparrow owns
+        // it, and borrowed from it otherwise.
+        template <class FROM, class TO>
+        arrow_proxy convert_offsets(arrow_proxy proxy)
+        {
+            constexpr std::size_t offset_buffer_index = 1;
+            const std::size_t count = proxy.length() + proxy.offset() + 1;
+            const FROM* src = proxy.buffers()[offset_buffer_index].template data<const FROM>();
+
+            buffer<std::uint8_t> offsets(count * sizeof(TO));
+            TO* dst = offsets.template data<TO>();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                dst[i] = static_cast<TO>(src[i]);
+            }
+
+            const bool large = sizeof(TO) == sizeof(std::int64_t);
+            const data_type dt = with_offset_width(proxy.data_type(), large);
+            if (proxy.is_created_with_sparrow())
+            {
+                proxy.set_data_type(dt);
+                proxy.set_buffer(offset_buffer_index, std::move(offsets));
+                return proxy;
+            }
+
+            // Buffers that are not owned by sparrow cannot be replaced: the
+            // result borrows them and shares the ownership of proxy.
+            struct owner_type
+            {
+                arrow_proxy source;
+                buffer<std::uint8_t> offsets;
+            };
+            auto owner = std::make_shared<owner_type>(std::move(proxy), std::move(offsets));
+            borrowed_proxy_parts parts = borrow_parts(owner->source);
+            parts.format = data_type_to_format(dt);
+            parts.borrowed_buffers[offset_buffer_index] = owner->offsets.data();
+            parts.owner = std::move(owner);
+            return make_borrowed_proxy(std::move(parts));
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    bool fits_small_offsets(const variable_size_binary_array<T, CR, std::int64_t>& ar)
+    {
+        const auto& proxy = ar.get_arrow_proxy();
+        const std::size_t count = proxy.length() + proxy.offset() + 1;
+        // Offsets are monotonic, checking the last one is enough.
+        const std::int64_t last = proxy.buffers()[1].template data<const std::int64_t>()[count - 1];
+        return last <= std::numeric_limits<std::int32_t>::max();
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int32_t>
+    to_small_offsets(variable_size_binary_array<T, CR, std::int64_t>&& ar)
+    {
+        if (!fits_small_offsets(ar))
+        {
+            throw std::runtime_error("variable size binary data does not fit in an array with 32-bit offsets");
+        }
+        return variable_size_binary_array<T, CR, std::int32_t>(
+            detail::convert_offsets<std::int64_t, std::int32_t>(std::move(ar.get_arrow_proxy()))
+        );
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int32_t>
+    to_small_offsets(const variable_size_binary_array<T, CR, std::int64_t>& ar)
+    {
+        return to_small_offsets(variable_size_binary_array<T, CR, std::int64_t>(ar));
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int64_t>
+    to_large_offsets(variable_size_binary_array<T, CR, std::int32_t>&& ar)
+    {
+        return variable_size_binary_array<T, CR, std::int64_t>(
+            detail::convert_offsets<std::int32_t, std::int64_t>(std::move(ar.get_arrow_proxy()))
+        );
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_array<T, CR, std::int64_t>
+    to_large_offsets(const variable_size_binary_array<T, CR, std::int32_t>& ar)
+    {
+        return to_large_offsets(variable_size_binary_array<T, CR, std::int32_t>(ar));
+    }
 }
@@ -0,0 +1,261 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/nullable.hpp"
+
+namespace sparrow
+{
+    /**
+     * Incremental builder of variable_size_binary_array.
+     *
+     * Values are appended one at a time into offset, data and validity buffers
+     * that grow geometrically, so appending is amortized O(1) even when the
+     * total size is not known up front. The validity bitmap is only allocated
+     * when the first null is appended. finish() moves the buffers into the
+     * resulting array without copying them.
+     *
+     * @tparam T the value type of the built array.
+     * @tparam CR the type of the appended values.
+     * @tparam OT the offset type of the built array.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT = std::int32_t>
+    class variable_size_binary_array_builder
+    {
+    public:
+
+        using array_type = variable_size_binary_array<T, CR, OT>;
+        using value_type = CR;
+        using offset_type = OT;
+        using size_type = std::size_t;
+
+        variable_size_binary_array_builder();
+
+        /// Preallocates room for n_values values holding n_bytes bytes in total.
+        void reserve(size_type n_values, size_type n_bytes);
+
+        void push_back(const value_type& value);
+        void push_back(nullval_t);
+
+        [[nodiscard]] size_type size() const noexcept;
+        [[nodiscard]] size_type data_size() const noexcept;
+        [[nodiscard]] size_type null_count() const noexcept;
+
+        /// Builds the array from the appended values and resets the builder.
+        [[nodiscard]] array_type finish();
+
+    private:
+
+        static void grow(buffer<std::uint8_t>& buf, size_type required);
+
+        offset_type* offsets();
+        void reserve_values(size_type n_values);
+        void append_validity(bool valid);
+
+        // The sizes of the buffers are their capacities, the number of
+        // elements actually written is tracked by m_size and m_data_size.
+        buffer<std::uint8_t> m_offsets;
+        buffer<std::uint8_t> m_data;
+        buffer<std::uint8_t> m_validity;
+        size_type m_size = 0;
+        size_type m_data_size = 0;
+        size_type m_null_count = 0;
+    };
+
+    using string_array_builder = variable_size_binary_array_builder<std::string, std::string_view, std::int32_t>;
+    using big_string_array_builder = variable_size_binary_array_builder<std::string, std::string_view, std::int64_t>;
+    using binary_array_builder = variable_size_binary_array_builder<
+        std::vector<byte_t>,
+        std::span<const byte_t>,
+        std::int32_t>;
+    using big_binary_array_builder = variable_size_binary_array_builder<
+        std::vector<byte_t>,
+        std::span<const byte_t>,
+        std::int64_t>;
+
+    /*****************************************************
+     * variable_size_binary_array_builder implementation *
+     *****************************************************/
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array_builder<T, CR, OT>::variable_size_binary_array_builder()
+        : m_offsets(sizeof(offset_type), std::uint8_t(0))
+        , m_data(0)
+        , m_validity(0)
+    {
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_builder<T, CR, OT>::reserve(size_type n_values, size_type n_bytes)
+    {
+        reserve_values(n_values);
+        if (m_data.size() < n_bytes)
+        {
+            m_data.resize(n_bytes, std::uint8_t(0));
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_builder<T, CR, OT>::push_back(const value_type& value)
+    {
+        const size_type length = std::ranges::size(value);
+        if (length > static_cast<size_type>(std::numeric_limits<offset_type>::max()) - m_data_size)
+        {
+            throw std::length_error("variable size binary data exceeds the capacity of the offset type");
+        }
+        grow(m_data, m_data_size + length);
+        if (length != 0)
+        {
+            std::memcpy(m_data.data() + m_data_size, std::ranges::data(value), length);
+        }
+        m_data_size += length;
+        reserve_values(m_size + 1);
+        offsets()[m_size + 1] = static_cast<offset_type>(m_data_size);
+        if (!m_validity.empty())
+        {
+            append_validity(true);
+        }
+        ++m_size;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_builder<T, CR, OT>::push_back(nullval_t)
+    {
+        reserve_values(m_size + 1);
+        offsets()[m_size + 1] = offsets()[m_size];
+        if (m_validity.empty())
+        {
+            // First null: all the previous values are valid.
+            grow(m_validity, m_size / 8 + 1);
+            std::fill_n(m_validity.data(), m_size / 8, std::uint8_t(0xFF));
+            m_validity.data()[m_size / 8] = static_cast<std::uint8_t>((1u << (m_size % 8)) - 1u);
+        }
+        append_validity(false);
+        ++m_null_count;
+        ++m_size;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array_builder<T, CR, OT>::size() const noexcept -> size_type
+    {
+        return m_size;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array_builder<T, CR, OT>::data_size() const noexcept -> size_type
+    {
+        return m_data_size;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array_builder<T, CR, OT>::null_count() const noexcept -> size_type
+    {
+        return m_null_count;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array_builder<T, CR, OT>::finish() -> array_type
+    {
+        const size_type bitmap_size = (m_size + 7) / 8;
+        if (m_validity.empty())
+        {
+            m_validity.resize(bitmap_size, std::uint8_t(0xFF));
+        }
+        else
+        {
+            m_validity.resize(bitmap_size);
+        }
+        m_offsets.resize((m_size + 1) * sizeof(offset_type));
+        m_data.resize(m_data_size);
+
+        std::vector<buffer<std::uint8_t>> buffers(3);
+        buffers[0] = std::exchange(m_validity, buffer<std::uint8_t>(0));
+        buffers[1] = std::exchange(m_offsets, buffer<std::uint8_t>(sizeof(offset_type), std::uint8_t(0)));
+        buffers[2] = std::exchange(m_data, buffer<std::uint8_t>(0));
+
+        ArrowSchema schema = make_arrow_schema(
+            data_type_to_format(detail::get_data_type_from_array<array_type>::get()),
+            std::nullopt,  // name
+            std::nullopt,  // metadata
+            std::nullopt,  // flags
+            0,             // n_children
+            nullptr,       // children
+            nullptr        // dictionary
+        );
+        ArrowArray arr = make_arrow_array(
+            static_cast<std::int64_t>(m_size),        // length
+            static_cast<std::int64_t>(m_null_count),  // null_count
+            0,                                        // offset
+            std::move(buffers),
+            0,        // n_children
+            nullptr,  // children
+            nullptr   // dictionary
+        );
+        m_size = 0;
+        m_data_size = 0;
+        m_null_count = 0;
+        return array_type(arrow_proxy(std::move(arr), std::move(schema)));
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_builder<T, CR, OT>::grow(buffer<std::uint8_t>& buf, size_type required)
+    {
+        if (buf.size() < required)
+        {
+            buf.resize(std::max(required, 2 * buf.size()), std::uint8_t(0));
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    auto variable_size_binary_array_builder<T, CR, OT>::offsets() -> offset_type*
+    {
+        return m_offsets.data<offset_type>();
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_builder<T, CR, OT>::reserve_values(size_type n_values)
+    {
+        grow(m_offsets, (n_values + 1) * sizeof(offset_type));
+        if (!m_validity.empty())
+        {
+            grow(m_validity, (n_values + 7) / 8);
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    void variable_size_binary_array_builder<T, CR, OT>::append_validity(bool valid)
+    {
+        grow(m_validity, m_size / 8 + 1);
+        std::uint8_t& byte = m_validity.data()[m_size / 8];
+        const auto mask = static_cast<std::uint8_t>(1u << (m_size % 8));
+        byte = valid ? static_cast<std::uint8_t>(byte | mask) : static_cast<std::uint8_t>(byte & ~mask);
+    }
+}
@@ -0,0 +1,504 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_schema.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset.hpp"
+#include "sparrow/buffer/dynamic_bitset/dynamic_bitset_view.hpp"
+#include "sparrow/buffer/u8_buffer.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_array_builder.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+#include "sparrow/types/data_traits.hpp"
+#include "sparrow/utils/utf8.hpp"
+
+namespace sparrow
+{
+    /**
+     * String kernels working directly on the offsets and data buffers of
+     * variable size binary arrays. They apply to string and binary layouts
+     * alike; patterns are compared byte-wise.
+     *
+     * Predicates return a bitmap with one bit per element of the array; null
+     * elements never match.
+     */
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    validity_bitmap starts_with(const variable_size_binary_array<T, CR, OT>& ar, std::string_view pattern);
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    validity_bitmap ends_with(const variable_size_binary_array<T, CR, OT>& ar, std::string_view pattern);
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    validity_bitmap contains(const variable_size_binary_array<T, CR, OT>& ar, std::string_view pattern);
+
+    /**
+     * Returns the number of UTF-8 code points of each element of \c ar.
+     * Null elements have a length of 0 and stay null.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    primitive_array<OT> utf8_length(const variable_size_binary_array<T, CR, OT>& ar);
+
+    /**
+     * Returns the bytes [start, start + length) of each element of \c ar,
+     * clamped to the size of the element. The result is compacted into new
+     * offsets and data buffers.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT> substring(
+        const variable_size_binary_array<T, CR, OT>& ar,
+        std::size_t start,
+        std::size_t length = std::numeric_limits<std::size_t>::max()
+    );
+
+    /**
+     * Same as substring, but the result is a view layout that shares the data
+     * buffer of \c ar instead of copying the selected bytes. Only the views
+     * are written.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_view_array<T, CR> substring_view(
+        variable_size_binary_array<T, CR, OT>&& ar,
+        std::size_t start,
+        std::size_t length = std::numeric_limits<std::size_t>::max()
+    );
+
+    /**
+     * Converts the ASCII upper case letters of each element of \c ar to
+     * lower case; other bytes are left untouched. When \c ar is moved in and
+     * owns its buffers, the conversion is done in place.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT> ascii_lower(variable_size_binary_array<T, CR, OT> ar);
+
+    /**
+     * Converts the ASCII lower case letters of each element of \c ar to
+     * upper case; other bytes are left untouched. When \c ar is moved in and
+     * owns its buffers, the conversion is done in place.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT> ascii_upper(variable_size_binary_array<T, CR, OT> ar);
+
+    /*********************************
+     * string kernels implementation *
+     *********************************/
+
+    namespace detail
+    {
+        // Offsets and data of the elements of a variable size binary array;
+        // offsets are shifted by the offset of the array.
+        template <layout_offset OT>
+        struct binary_buffers
+        {
+            const OT* offsets;
+            const std::uint8_t* data;
+            const std::uint8_t* validity;
+            std::size_t array_offset;
+            std::size_t size;
+
+            std::size_t value_begin(std::size_t i) const
+            {
+                return static_cast<std::size_t>(offsets[i]);
+            }
+
+            std::size_t value_size(std::size_t i) const
+            {
+                return static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+            }
+
+            const std::uint8_t* value_data(std::size_t i) const
+            {
+                return data + value_begin(i);
+            }
+        };
+
+        template <std::ranges::sized_range T, class CR, layout_offset OT>
+        binary_buffers<OT> get_binary_buffers(const variable_size_binary_array<T, CR, OT>& ar)
+        {
+            const auto& proxy = ar.get_arrow_proxy();
+            const auto& buffers = proxy.buffers();
+            const auto array_offset = static_cast<std::size_t>(proxy.offset());
+            return {
+                buffers[1].template data<const OT>() + array_offset,
+                buffers[2].data(),
+                proxy.null_count() == 0 ? nullptr : buffers[0].data(),
+                array_offset,
+                proxy.length()
+            };
+        }
+
+        // Returns a bitmap whose bit i is set if the element i is not null and
+        // pred(data, size) is true for it.
+        template <layout_offset OT, class F>
+        validity_bitmap match_bitmap(const binary_buffers<OT>& bufs, F&& pred)
+        {
+            validity_bitmap result(bufs.size, false);
+            if (bufs.validity == nullptr)
+            {
+                for (std::size_t i = 0; i < bufs.size; ++i)
+                {
+                    if (pred(bufs.value_data(i), bufs.value_size(i)))
+                    {
+                        result.set(i, true);
+                    }
+                }
+            }
+            else
+            {
+                const dynamic_bitset_view<const std::uint8_t> validity(
+                    bufs.validity,
+                    bufs.array_offset + bufs.size
+                );
+                for (std::size_t i = 0; i < bufs.size; ++i)
+                {
+                    if (validity.test(bufs.array_offset + i) && pred(bufs.value_data(i), bufs.value_size(i)))
+                    {
+                        result.set(i, true);
+                    }
+                }
+            }
+            return result;
+        }
+
+        inline const std::uint8_t* bytes_of(std::string_view str)
+        {
+            return reinterpret_cast<const std::uint8_t*>(str.data());
+        }
+
+        // Searches pattern in [data, data + size): candidates are found with
+        // memchr on the first byte of the pattern and filtered on its last byte
+        // before the full comparison.
+        inline bool contains_bytes(const std::uint8_t* data, std::size_t size, std::string_view pattern)
+        {
+            const std::size_t m = pattern.size();
+            if (m == 0)
+            {
+                return true;
+            }
+            if (size < m)
+            {
+                return false;
+            }
+            const std::uint8_t* pat = bytes_of(pattern);
+            const std::uint8_t first = pat[0];
+            const std::uint8_t last = pat[m - 1];
+            const std::uint8_t* it = data;
+            const std::uint8_t* end = data + (size - m + 1);
+            while (it < end)
+            {
+                it = static_cast<const std::uint8_t*>(std::memchr(it, first, static_cast<std::size_t>(end - it)));
+                if (it == nullptr)
+                {
+                    return false;
+                }
+                if (it[m - 1] == last && std::memcmp(it, pat, m) == 0)
+                {
+                    return true;
+                }
+                ++it;
+            }
+            return false;
+        }
+
+        // Applies f to every byte of the elements of ar, in place. Buffers that
+        // are not owned by sparrow are copied first.
+        template <std::ranges::sized_range T, class CR, layout_offset OT, class F>
+        void transform_bytes(variable_size_binary_array<T, CR, OT>& ar, F f)
+        {
+            if (!ar.get_arrow_proxy().is_created_with_sparrow())
+            {
+                ar = variable_size_binary_array<T, CR, OT>(arrow_proxy(ar.get_arrow_proxy()));
+            }
+            const auto bufs = get_binary_buffers(ar);
+            if (bufs.size == 0)
+            {
+                return;
+            }
+            std::uint8_t* data = ar.get_arrow_proxy().buffers()[2].data();
+            const std::size_t first = bufs.value_begin(0);
+            const std::size_t last = bufs.value_begin(bufs.size);
+            // Branchless loop so that the compiler can vectorize it.
+            for (std::size_t i = first; i < last; ++i)
+            {
+                data[i] = f(data[i]);
+            }
+        }
+
+        // Returns the array whose element i is the element indices[i] of ar
+        // if keep(i) is true, and null otherwise; indices[i] is not read when
+        // keep(i) is false. The offsets are computed first, so that the data
+        // buffer is allocated once and the values are then copied with memcpy.
+        template <std::ranges::sized_range T, class CR, layout_offset OT, std::ranges::random_access_range R, class F>
+            requires std::ranges::sized_range<R>
+        variable_size_binary_array<T, CR, OT>
+        gather_binary(const variable_size_binary_array<T, CR, OT>& ar, const R& indices, F&& keep)
+        {
+            using array_type = variable_size_binary_array<T, CR, OT>;
+            const binary_buffers<OT> bufs = get_binary_buffers(ar);
+            const std::size_t n = std::ranges::size(indices);
+            const auto index = [&indices](std::size_t i)
+            {
+                return static_cast<std::size_t>(std::ranges::begin(indices)[static_cast<std::ptrdiff_t>(i)]);
+            };
+
+            buffer<std::uint8_t> offset_buffer((n + 1) * sizeof(OT), std::uint8_t(0));
+            OT* offsets = offset_buffer.template data<OT>();
+            validity_bitmap validity(n, true);
+            std::size_t total_size = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (keep(i))
+                {
+                    total_size += bufs.value_size(index(i));
+                    if (total_size > static_cast<std::size_t>(std::numeric_limits<OT>::max()))
+                    {
+                        throw std::length_error("variable size binary data exceeds the capacity of the offset type");
+                    }
+                }
+                else
+                {
+                    validity.set(i, false);
+                }
+                offsets[i + 1] = static_cast<OT>(total_size);
+            }
+
+            buffer<std::uint8_t> data_buffer(total_size, std::uint8_t(0));
+            std::uint8_t* data = data_buffer.data();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto length = static_cast<std::size_t>(offsets[i + 1] - offsets[i]);
+                if (length != 0)
+                {
+                    std::memcpy(data + offsets[i], bufs.value_data(index(i)), length);
+                }
+            }
+
+            const auto null_count = static_cast<std::int64_t>(validity.null_count());
+            std::vector<buffer<std::uint8_t>> buffers(3);
+            buffers[0] = std::move(validity).extract_storage();
+            buffers[1] = std::move(offset_buffer);
+            buffers[2] = std::move(data_buffer);
+
+            ArrowSchema schema = make_arrow_schema(
+                data_type_to_format(get_data_type_from_array<array_type>::get()),
+                std::nullopt,  // name
+                std::nullopt,  // metadata
+                std::nullopt,  // flags
+                0,             // n_children
+                nullptr,       // children
+                nullptr        // dictionary
+            );
+            ArrowArray arr = make_arrow_array(
+                static_cast<std::int64_t>(n),  // length
+                null_count,                    // null_count
+                0,                             // offset
+                std::move(buffers),
+                0,        // n_children
+                nullptr,  // children
+                nullptr   // dictionary
+            );
+            return array_type(arrow_proxy(std::move(arr), std::move(schema)));
+        }
+
+        inline std::size_t clamped_begin(std::size_t size, std::size_t start)
+        {
+            return std::min(start, size);
+        }
+
+        inline std::size_t clamped_size(std::size_t size, std::size_t start, std::size_t length)
+        {
+            return std::min(length, size - clamped_begin(size, start));
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    validity_bitmap starts_with(const variable_size_binary_array<T, CR, OT>& ar, std::string_view pattern)
+    {
+        const std::uint8_t* pat = detail::bytes_of(pattern);
+        const std::size_t m = pattern.size();
+        return detail::match_bitmap(
+            detail::get_binary_buffers(ar),
+            [pat, m](const std::uint8_t* data, std::size_t size)
+            {
+                return size >= m && (m == 0 || (data[0] == pat[0] && std::memcmp(data, pat, m) == 0));
+            }
+        );
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    validity_bitmap ends_with(const variable_size_binary_array<T, CR, OT>& ar, std::string_view pattern)
+    {
+        const std::uint8_t* pat = detail::bytes_of(pattern);
+        const std::size_t m = pattern.size();
+        return detail::match_bitmap(
+            detail::get_binary_buffers(ar),
+            [pat, m](const std::uint8_t* data, std::size_t size)
+            {
+                if (size < m)
+                {
+                    return false;
+                }
+                const std::uint8_t* tail = data + (size - m);
+                return m == 0 || (tail[m - 1] == pat[m - 1] && std::memcmp(tail, pat, m) == 0);
+            }
+        );
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    validity_bitmap contains(const variable_size_binary_array<T, CR, OT>& ar, std::string_view pattern)
+    {
+        return detail::match_bitmap(
+            detail::get_binary_buffers(ar),
+            [pattern](const std::uint8_t* data, std::size_t size)
+            {
+                return detail::contains_bytes(data, size, pattern);
+            }
+        );
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    primitive_array<OT> utf8_length(const variable_size_binary_array<T, CR, OT>& ar)
+    {
+        const auto bufs = detail::get_binary_buffers(ar);
+        u8_buffer<OT> lengths(bufs.size, OT(0));
+        validity_bitmap validity(bufs.size, true);
+        const dynamic_bitset_view<const std::uint8_t> source_validity(
+            bufs.validity,
+            bufs.validity == nullptr ? 0 : bufs.array_offset + bufs.size
+        );
+        for (std::size_t i = 0; i < bufs.size; ++i)
+        {
+            if (bufs.validity != nullptr && !source_validity.test(bufs.array_offset + i))
+            {
+                validity.set(i, false);
+                continue;
+            }
+            const std::uint8_t* data = bufs.value_data(i);
+            const std::size_t size = bufs.value_size(i);
+            OT count = 0;
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                count += static_cast<OT>(!is_utf8_continuation_byte(data[j]));
+            }
+            lengths[i] = count;
+        }
+        return primitive_array<OT>(std::move(lengths), std::move(validity));
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT>
+    substring(const variable_size_binary_array<T, CR, OT>& ar, std::size_t start, std::size_t length)
+    {
+        using data_value_type = typename variable_size_binary_array<T, CR, OT>::data_value_type;
+        const auto bufs = detail::get_binary_buffers(ar);
+        const std::size_t total_size = bufs.size == 0 ? 0 : bufs.value_begin(bufs.size) - bufs.value_begin(0);
+
+        // The substrings cannot be larger than the original data.
+        variable_size_binary_array_builder<T, CR, OT> builder;
+        builder.reserve(bufs.size, total_size);
+        for (std::size_t i = 0; i < bufs.size; ++i)
+        {
+            if (!ar.has_value(i))
+            {
+                builder.push_back(nullval);
+                continue;
+            }
+            const std::size_t size = bufs.value_size(i);
+            const auto* data = reinterpret_cast<const data_value_type*>(bufs.value_data(i));
+            builder.push_back(CR(data + detail::clamped_begin(size, start), detail::clamped_size(size, start, length)));
+        }
+        return builder.finish();
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_view_array<T, CR>
+    substring_view(variable_size_binary_array<T, CR, OT>&& ar, std::size_t start, std::size_t length)
+    {
+        // The views built by to_view_array reference the data buffer of ar,
+        // they only need to be narrowed.
+        variable_size_binary_view_array<T, CR> result = to_view_array(std::move(ar));
+        auto& buffers = result.get_arrow_proxy().buffers();
+        std::uint8_t* views = buffers[1].data();
+        const std::uint8_t* data = buffers[2].data();
+        const std::size_t count = result.get_arrow_proxy().length() + result.get_arrow_proxy().offset();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint8_t* view = views + i * binary_view_size;
+            const std::size_t size = detail::view_length(view);
+            const std::size_t begin = detail::clamped_begin(size, start);
+            const std::size_t new_size = detail::clamped_size(size, start, length);
+            if (size <= binary_view_inline_capacity)
+            {
+                std::uint8_t value[binary_view_inline_capacity];
+                std::memcpy(value, view + detail::view_prefix_pos, binary_view_inline_capacity);
+                detail::write_view(view, value + begin, static_cast<std::int32_t>(new_size), 0, 0);
+            }
+            else
+            {
+                const auto value_offset = static_cast<std::size_t>(detail::read_view_int(view, detail::view_offset_pos));
+                detail::write_view(
+                    view,
+                    data + value_offset + begin,
+                    static_cast<std::int32_t>(new_size),
+                    0,
+                    static_cast<std::int32_t>(value_offset + begin)
+                );
+            }
+        }
+        return result;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT> ascii_lower(variable_size_binary_array<T, CR, OT> ar)
+    {
+        detail::transform_bytes(
+            ar,
+            [](std::uint8_t c)
+            {
+                return static_cast<std::uint8_t>(c + (static_cast<std::uint8_t>(c - 'A') < 26u ? 0x20 : 0));
+            }
+        );
+        return ar;
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_array<T, CR, OT> ascii_upper(variable_size_binary_array<T, CR, OT> ar)
+    {
+        detail::transform_bytes(
+            ar,
+            [](std::uint8_t c)
+            {
+                return static_cast<std::uint8_t>(c - (static_cast<std::uint8_t>(c - 'a') < 26u ? 0x20 : 0));
+            }
+        );
+        return ar;
+    }
+}
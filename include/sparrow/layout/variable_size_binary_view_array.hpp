@@ -0,0 +1,485 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/arrow_array_schema_proxy.hpp"
+#include "sparrow/arrow_interface/arrow_array.hpp"
+#include "sparrow/arrow_interface/arrow_array/private_data.hpp"
+#include "sparrow/arrow_interface/arrow_array_schema_info_utils.hpp"
+#include "sparrow/buffer/buffer.hpp"
+#include "sparrow/layout/array_bitmap_base.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/types/data_type.hpp"
+#include "sparrow/utils/bit.hpp"
+#include "sparrow/utils/contracts.hpp"
+
+namespace sparrow
+{
+    template <std::ranges::sized_range T, class CR>
+    class variable_size_binary_view_array;
+
+    using string_view_array = variable_size_binary_view_array<std::string, std::string_view>;
+    using binary_view_array = variable_size_binary_view_array<std::vector<byte_t>, std::span<const byte_t>>;
+
+    namespace detail
+    {
+        template <class T>
+        struct get_data_type_from_array;
+
+        template <std::ranges::sized_range T, class CR>
+        struct get_data_type_from_array<sparrow::variable_size_binary_view_array<T, CR>>
+        {
+            constexpr static sparrow::data_type get()
+            {
+                return std::same_as<T, std::string> ? sparrow::data_type::STRING_VIEW
+                                                    : sparrow::data_type::BINARY_VIEW;
+            }
+        };
+    }
+
+    /// Values up to this size are stored inside their view.
+    inline constexpr std::size_t binary_view_inline_capacity = 12;
+    /// Number of leading bytes of a value copied into its view.
+    inline constexpr std::size_t binary_view_prefix_size = 4;
+
+    namespace detail
+    {
+        // A view starts with the length of the value as an int32. Values of up to
+        // 12 bytes follow inline; longer values are described by their 4-byte prefix,
+        // the index of the data buffer holding them and their offset in that buffer.
+        // In both cases, the first bytes of the value are at the same position.
+        inline constexpr std::size_t view_prefix_pos = 4;
+        inline constexpr std::size_t view_buffer_index_pos = 8;
+        inline constexpr std::size_t view_offset_pos = 12;
+
+        inline std::int32_t read_view_int(const std::uint8_t* view, std::size_t pos)
+        {
+            std::int32_t res;
+            std::memcpy(&res, view + pos, sizeof(res));
+            return res;
+        }
+
+        inline std::size_t view_length(const std::uint8_t* view)
+        {
+            return static_cast<std::size_t>(read_view_int(view, 0));
+        }
+
+        inline void write_view(
+            std::uint8_t* view,
+            const std::uint8_t* value,
+            std::int32_t length,
+            std::int32_t buffer_index,
+            std::int32_t offset
+        )
+        {
+            std::memset(view, 0, binary_view_size);
+            std::memcpy(view, &length, sizeof(length));
+            const auto ulength = static_cast<std::size_t>(length);
+            if (ulength <= binary_view_inline_capacity)
+            {
+                if (ulength != 0)
+                {
+                    std::memcpy(view + view_prefix_pos, value, ulength);
+                }
+            }
+            else
+            {
+                std::memcpy(view + view_prefix_pos, value, binary_view_prefix_size);
+                std::memcpy(view + view_buffer_index_pos, &buffer_index, sizeof(buffer_index));
+                std::memcpy(view + view_offset_pos, &offset, sizeof(offset));
+            }
+        }
+
+        // Hash of a value stored inline, read from its view as two words. The
+        // bytes following the value are cleared first so that the padding of
+        // the view does not change the result.
+        inline std::size_t inline_view_hash(const std::uint8_t* view)
+        {
+            std::uint8_t bytes[binary_view_size] = {};
+            std::memcpy(bytes, view, view_prefix_pos + view_length(view));
+            std::uint64_t words[2];
+            std::memcpy(words, bytes, sizeof(words));
+            return static_cast<std::size_t>(mix_hash(words[0] ^ mix_hash(words[1])));
+        }
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    struct array_inner_types<variable_size_binary_view_array<T, CR>> : array_inner_types_base
+    {
+        using array_type = variable_size_binary_view_array<T, CR>;
+
+        using inner_value_type = T;
+        using inner_const_reference = CR;
+
+        using data_value_type = typename T::value_type;
+        using const_data_iterator = const data_value_type*;
+
+        using iterator_tag = std::random_access_iterator_tag;
+
+        using const_bitmap_iterator = bitmap_type::const_iterator;
+
+        struct iterator_types
+        {
+            using value_type = inner_value_type;
+            using reference = inner_const_reference;
+            using value_iterator = const_data_iterator;
+            using bitmap_iterator = const_bitmap_iterator;
+            using iterator_tag = array_inner_types<variable_size_binary_view_array<T, CR>>::iterator_tag;
+        };
+
+        using const_value_iterator = variable_size_binary_value_iterator<array_type, iterator_types>;
+    };
+
+    /**
+     * Array of variable size binary values stored as 16-byte views (the Arrow
+     * BinaryView and Utf8View layouts, "vz" and "vu").
+     *
+     * Since the length and the first bytes of each value are stored in its view,
+     * value_equals, value_compare, value_starts_with and value_hash can often
+     * decide without reading the data buffers, and never read them for values
+     * of up to 12 bytes.
+     */
+    template <std::ranges::sized_range T, class CR>
+    class variable_size_binary_view_array final
+        : public array_bitmap_base<variable_size_binary_view_array<T, CR>>
+    {
+    public:
+
+        using self_type = variable_size_binary_view_array<T, CR>;
+        using base_type = array_bitmap_base<self_type>;
+        using inner_types = array_inner_types<self_type>;
+        using inner_value_type = typename inner_types::inner_value_type;
+        using inner_const_reference = typename inner_types::inner_const_reference;
+        using bitmap_type = typename inner_types::bitmap_type;
+        using bitmap_const_reference = typename base_type::bitmap_const_reference;
+        using value_type = nullable<inner_value_type>;
+        using const_reference = nullable<inner_const_reference, bitmap_const_reference>;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using iterator_tag = typename base_type::iterator_tag;
+        using const_data_iterator = typename inner_types::const_data_iterator;
+        using data_value_type = typename inner_types::data_value_type;
+
+        using const_bitmap_range = typename base_type::const_bitmap_range;
+        using const_value_iterator = typename inner_types::const_value_iterator;
+
+        explicit variable_size_binary_view_array(arrow_proxy);
+
+        using base_type::size;
+        using base_type::get_arrow_proxy;
+
+        /// Number of variadic data buffers holding the values that are not inlined.
+        size_type data_buffer_count() const;
+
+        // The following methods work on the values and ignore the validity bitmap.
+
+        /// Returns true if the i-th value is equal to rhs.
+        bool value_equals(size_type i, const inner_const_reference& rhs) const;
+        /// Returns true if the i-th and the j-th values are equal.
+        bool value_equals(size_type i, size_type j) const;
+        /// Compares the i-th value with rhs, byte-wise.
+        std::strong_ordering value_compare(size_type i, const inner_const_reference& rhs) const;
+        /// Returns true if the i-th value starts with prefix.
+        bool value_starts_with(size_type i, const inner_const_reference& prefix) const;
+        /// Returns the hash of the i-th value. Equal values have equal hashes;
+        /// values of up to 12 bytes are hashed from their view only.
+        std::size_t value_hash(size_type i) const;
+
+    private:
+
+        static constexpr size_t VIEW_BUFFER_INDEX = 1;
+        static constexpr size_t FIRST_DATA_BUFFER_INDEX = 2;
+
+        const std::uint8_t* view(size_type i) const;
+        const std::uint8_t* value_data(const std::uint8_t* v) const;
+        static const std::uint8_t* bytes_of(const inner_const_reference& value);
+
+        inner_const_reference value(size_type i) const;
+
+        const_value_iterator value_cbegin() const;
+        const_value_iterator value_cend() const;
+
+        friend class array_crtp_base<self_type>;
+        friend const_value_iterator;
+    };
+
+    /**
+     * Builds a view array from a variable size binary array. The validity
+     * bitmap and the data buffer are moved to the result, which becomes the
+     * only data buffer of the view array; only the views are computed.
+     *
+     * @exception std::runtime_error if the data buffer is too large to be
+     * referenced by 32-bit offsets.
+     */
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_view_array<T, CR> to_view_array(variable_size_binary_array<T, CR, OT>&& ar);
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_view_array<T, CR> to_view_array(const variable_size_binary_array<T, CR, OT>& ar);
+
+    /**************************************************
+     * variable_size_binary_view_array implementation *
+     **************************************************/
+
+    template <std::ranges::sized_range T, class CR>
+    variable_size_binary_view_array<T, CR>::variable_size_binary_view_array(arrow_proxy proxy)
+        : base_type(std::move(proxy))
+    {
+        SPARROW_ASSERT_TRUE(get_arrow_proxy().data_type() == detail::get_data_type_from_array<self_type>::get());
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::data_buffer_count() const -> size_type
+    {
+        return get_arrow_proxy().n_buffers() - FIRST_DATA_BUFFER_INDEX - 1;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    bool variable_size_binary_view_array<T, CR>::value_equals(size_type i, const inner_const_reference& rhs) const
+    {
+        const std::uint8_t* v = view(i);
+        const std::size_t length = detail::view_length(v);
+        if (length != std::ranges::size(rhs))
+        {
+            return false;
+        }
+        const std::uint8_t* rhs_data = bytes_of(rhs);
+        const std::size_t prefix_length = std::min(length, binary_view_prefix_size);
+        if (std::memcmp(v + detail::view_prefix_pos, rhs_data, prefix_length) != 0)
+        {
+            return false;
+        }
+        return length == prefix_length
+               || std::memcmp(
+                      value_data(v) + prefix_length,
+                      rhs_data + prefix_length,
+                      length - prefix_length
+                  ) == 0;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    bool variable_size_binary_view_array<T, CR>::value_equals(size_type i, size_type j) const
+    {
+        const std::uint8_t* lhs = view(i);
+        const std::uint8_t* rhs = view(j);
+        const std::size_t length = detail::view_length(lhs);
+        if (length != detail::view_length(rhs))
+        {
+            return false;
+        }
+        const std::size_t prefix_length = std::min(length, binary_view_prefix_size);
+        if (std::memcmp(lhs + detail::view_prefix_pos, rhs + detail::view_prefix_pos, prefix_length) != 0)
+        {
+            return false;
+        }
+        return length == prefix_length
+               || std::memcmp(
+                      value_data(lhs) + prefix_length,
+                      value_data(rhs) + prefix_length,
+                      length - prefix_length
+                  ) == 0;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    std::strong_ordering
+    variable_size_binary_view_array<T, CR>::value_compare(size_type i, const inner_const_reference& rhs) const
+    {
+        const std::uint8_t* v = view(i);
+        const std::size_t length = detail::view_length(v);
+        const std::size_t rhs_length = std::ranges::size(rhs);
+        const std::uint8_t* rhs_data = bytes_of(rhs);
+        const std::size_t common_length = std::min(length, rhs_length);
+        const std::size_t prefix_length = std::min(common_length, binary_view_prefix_size);
+        int res = std::memcmp(v + detail::view_prefix_pos, rhs_data, prefix_length);
+        if (res == 0 && common_length > prefix_length)
+        {
+            res = std::memcmp(
+                value_data(v) + prefix_length,
+                rhs_data + prefix_length,
+                common_length - prefix_length
+            );
+        }
+        return res != 0 ? res <=> 0 : length <=> rhs_length;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    bool
+    variable_size_binary_view_array<T, CR>::value_starts_with(size_type i, const inner_const_reference& prefix) const
+    {
+        const std::uint8_t* v = view(i);
+        const std::size_t length = detail::view_length(v);
+        const std::size_t prefix_length = std::ranges::size(prefix);
+        if (prefix_length > length)
+        {
+            return false;
+        }
+        const std::uint8_t* prefix_data = bytes_of(prefix);
+        const std::size_t inline_length = std::min(prefix_length, binary_view_prefix_size);
+        if (std::memcmp(v + detail::view_prefix_pos, prefix_data, inline_length) != 0)
+        {
+            return false;
+        }
+        return prefix_length == inline_length
+               || std::memcmp(
+                      value_data(v) + inline_length,
+                      prefix_data + inline_length,
+                      prefix_length - inline_length
+                  ) == 0;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    std::size_t variable_size_binary_view_array<T, CR>::value_hash(size_type i) const
+    {
+        const std::uint8_t* v = view(i);
+        const std::size_t length = detail::view_length(v);
+        if (length <= binary_view_inline_capacity)
+        {
+            return detail::inline_view_hash(v);
+        }
+        const std::string_view bytes(reinterpret_cast<const char*>(value_data(v)), length);
+        return std::hash<std::string_view>{}(bytes);
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::view(size_type i) const -> const std::uint8_t*
+    {
+        SPARROW_ASSERT_TRUE(i < size());
+        return get_arrow_proxy().buffers()[VIEW_BUFFER_INDEX].data()
+               + (get_arrow_proxy().offset() + i) * binary_view_size;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::value_data(const std::uint8_t* v) const -> const std::uint8_t*
+    {
+        if (detail::view_length(v) <= binary_view_inline_capacity)
+        {
+            return v + detail::view_prefix_pos;
+        }
+        const auto buffer_index = static_cast<std::size_t>(detail::read_view_int(v, detail::view_buffer_index_pos));
+        const auto offset = static_cast<std::size_t>(detail::read_view_int(v, detail::view_offset_pos));
+        SPARROW_ASSERT_TRUE(buffer_index < data_buffer_count());
+        return get_arrow_proxy().buffers()[FIRST_DATA_BUFFER_INDEX + buffer_index].data() + offset;
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::bytes_of(const inner_const_reference& value)
+        -> const std::uint8_t*
+    {
+        return reinterpret_cast<const std::uint8_t*>(std::ranges::data(value));
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::value(size_type i) const -> inner_const_reference
+    {
+        const std::uint8_t* v = view(i);
+        const auto* first = reinterpret_cast<const_data_iterator>(value_data(v));
+        return inner_const_reference(first, first + detail::view_length(v));
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::value_cbegin() const -> const_value_iterator
+    {
+        return const_value_iterator{this, 0};
+    }
+
+    template <std::ranges::sized_range T, class CR>
+    auto variable_size_binary_view_array<T, CR>::value_cend() const -> const_value_iterator
+    {
+        return sparrow::next(value_cbegin(), size());
+    }
+
+    /********************************
+     * to_view_array implementation *
+     ********************************/
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_view_array<T, CR> to_view_array(variable_size_binary_array<T, CR, OT>&& ar)
+    {
+        constexpr std::size_t offset_buffer_index = 1;
+        constexpr std::size_t data_buffer_index = 2;
+
+        arrow_proxy proxy = std::move(ar.get_arrow_proxy());
+        if (!proxy.is_created_with_sparrow() || !proxy.owns_array() || !proxy.owns_schema())
+        {
+            // We need to own the buffers to move them, we work on a deep copy instead.
+            proxy = arrow_proxy(proxy);
+        }
+
+        const std::size_t count = proxy.length() + proxy.offset();
+        const OT* offsets = proxy.buffers()[offset_buffer_index].template data<const OT>();
+        if (offsets[count] > std::numeric_limits<std::int32_t>::max())
+        {
+            throw std::runtime_error("variable size binary data is too large to be referenced by views");
+        }
+        const std::uint8_t* data = proxy.buffers()[data_buffer_index].data();
+
+        buffer<std::uint8_t> views(count * binary_view_size);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto begin = static_cast<std::size_t>(offsets[i]);
+            const auto length = static_cast<std::int32_t>(offsets[i + 1] - offsets[i]);
+            detail::write_view(
+                views.data() + i * binary_view_size,
+                data == nullptr ? nullptr : data + begin,
+                length,
+                0,
+                static_cast<std::int32_t>(offsets[i])
+            );
+        }
+
+        const auto length = static_cast<std::int64_t>(proxy.length());
+        const std::int64_t null_count = proxy.null_count();
+        const auto offset = static_cast<std::int64_t>(proxy.offset());
+
+        proxy.set_data_type(detail::get_data_type_from_array<variable_size_binary_view_array<T, CR>>::get());
+        ArrowSchema schema = proxy.extract_schema();
+        ArrowArray source = proxy.extract_array();
+        auto& source_buffers = static_cast<arrow_array_private_data*>(source.private_data)->buffers();
+
+        const auto data_size = static_cast<std::int64_t>(source_buffers[data_buffer_index].size());
+        buffer<std::uint8_t> sizes(sizeof(std::int64_t));
+        std::memcpy(sizes.data(), &data_size, sizeof(data_size));
+
+        std::vector<buffer<std::uint8_t>> buffers;
+        buffers.reserve(4);
+        buffers.push_back(std::move(source_buffers[0]));
+        buffers.push_back(std::move(views));
+        buffers.push_back(std::move(source_buffers[data_buffer_index]));
+        buffers.push_back(std::move(sizes));
+        source.release(&source);
+
+        ArrowArray arr = make_arrow_array(length, null_count, offset, std::move(buffers), 0, nullptr, nullptr);
+        return variable_size_binary_view_array<T, CR>(arrow_proxy(std::move(arr), std::move(schema)));
+    }
+
+    template <std::ranges::sized_range T, class CR, layout_offset OT>
+    variable_size_binary_view_array<T, CR> to_view_array(const variable_size_binary_array<T, CR, OT>& ar)
+    {
+        return to_view_array(variable_size_binary_array<T, CR, OT>(ar));
+    }
+}
@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <concepts>
+#include <span>
 
 #include "sparrow/types/data_type.hpp"
 #include "sparrow/utils/nullable.hpp"
@@ -54,20 +57,119 @@ namespace sparrow
         using const_reference = std::string_view;
     };
 
+    /// Bytes of a binary value: a std::span that compares equal to another
+    /// one holding the same bytes.
+    class binary_span : public std::span<const byte_t>
+    {
+    public:
+
+        using base_type = std::span<const byte_t>;
+        using base_type::base_type;
+
+        constexpr binary_span(base_type bytes) noexcept
+            : base_type(bytes)
+        {
+        }
+
+        friend bool operator==(const binary_span& lhs, const binary_span& rhs)
+        {
+            return std::ranges::equal(lhs, rhs);
+        }
+    };
+
     template <>
     struct arrow_traits<std::vector<byte_t>>
     {
-        static constexpr data_type type_id = data_type::STRING;
+        static constexpr data_type type_id = data_type::BINARY;
         using value_type = std::vector<byte_t>;
+        using const_reference = binary_span;
+    };
+
+    namespace detail
+    {
+        template <class D>
+        concept time_unit = mpl::contains<D>(mpl::typelist<
+                                             std::chrono::seconds,
+                                             std::chrono::milliseconds,
+                                             std::chrono::microseconds,
+                                             std::chrono::nanoseconds>{});
+
+        // Data type of the given unit among the data types of a temporal family,
+        // listed from seconds to nanoseconds.
+        template <time_unit D>
+        constexpr data_type temporal_type_id(data_type s, data_type ms, data_type us, data_type ns)
+        {
+            if constexpr (std::same_as<D, std::chrono::seconds>)
+            {
+                return s;
+            }
+            else if constexpr (std::same_as<D, std::chrono::milliseconds>)
+            {
+                return ms;
+            }
+            else if constexpr (std::same_as<D, std::chrono::microseconds>)
+            {
+                return us;
+            }
+            else
+            {
+                return ns;
+            }
+        }
+    }
+
+    // Temporal values are built from the raw counts of the data buffer,
+    // hence they are accessed by value.
+    template <class T>
+    struct temporal_types_traits
+    {
+        using value_type = T;
+        using const_reference = T;
+    };
+
+    template <>
+    struct arrow_traits<date_days> : temporal_types_traits<date_days>
+    {
+        static constexpr data_type type_id = data_type::DATE_DAYS;
     };
 
     template <>
-    struct arrow_traits<timestamp> : common_native_types_traits<timestamp>
+    struct arrow_traits<date_milliseconds> : temporal_types_traits<date_milliseconds>
+    {
+        static constexpr data_type type_id = data_type::DATE_MILLISECONDS;
+    };
+
+    template <detail::time_unit D>
+    struct arrow_traits<time_of_day<D>> : temporal_types_traits<time_of_day<D>>
+    {
+        static constexpr data_type type_id = detail::temporal_type_id<D>(
+            data_type::TIME_SECONDS,
+            data_type::TIME_MILLISECONDS,
+            data_type::TIME_MICROSECONDS,
+            data_type::TIME_NANOSECONDS
+        );
+    };
+
+    template <detail::time_unit D>
+    struct arrow_traits<std::chrono::sys_time<D>> : temporal_types_traits<std::chrono::sys_time<D>>
+    {
+        static constexpr data_type type_id = detail::temporal_type_id<D>(
+            data_type::TIMESTAMP_SECONDS,
+            data_type::TIMESTAMP_MILLISECONDS,
+            data_type::TIMESTAMP_MICROSECONDS,
+            data_type::TIMESTAMP_NANOSECONDS
+        );
+    };
+
+    template <detail::time_unit D>
+    struct arrow_traits<D> : temporal_types_traits<D>
     {
-        static constexpr data_type type_id = data_type::TIMESTAMP;
-        // By default duration in milliseconds, but see
-        // https://arrow.apache.org/docs/dev/format/CDataInterface.html#data-type-description-format-strings
-        // for other possibilities
+        static constexpr data_type type_id = detail::temporal_type_id<D>(
+            data_type::DURATION_SECONDS,
+            data_type::DURATION_MILLISECONDS,
+            data_type::DURATION_MICROSECONDS,
+            data_type::DURATION_NANOSECONDS
+        );
     };
 
     template <>
@@ -85,6 +187,22 @@ namespace sparrow
         using value_type = struct_value;
         using const_reference = struct_value;
     };
+
+    template <>
+    struct arrow_traits<decimal128_t>
+    {
+        static constexpr data_type type_id = data_type::DECIMAL;
+        using value_type = decimal128_t;
+        using const_reference = decimal128_t;
+    };
+
+    template <>
+    struct arrow_traits<decimal256_t>
+    {
+        static constexpr data_type type_id = data_type::DECIMAL256;
+        using value_type = decimal256_t;
+        using const_reference = decimal256_t;
+    };
     
     namespace detail
     {
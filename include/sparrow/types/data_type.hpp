@@ -28,9 +28,11 @@ namespace date = std::chrono;
 #include <cstdint>
 #include <cstring>
 #include <concepts>
+#include <optional>
 #include <string>
 
 #include "sparrow/utils/contracts.hpp"
+#include "sparrow/utils/decimal.hpp"
 #include "sparrow/utils/mp_utils.hpp"
 
 
@@ -95,7 +97,43 @@ namespace sparrow
     // For now, we use HowardHinnant/date as a replacement if we are compiling with libc++.
     // TODO: use the following once libc++ has full support for P0355R7.
     // using timestamp = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
-    using timestamp = date::zoned_time<std::chrono::nanoseconds>;
+    // Former value type of the TIMESTAMP data type, which the temporal layouts
+    // replace; kept so that code naming it still compiles.
+    using timestamp [[deprecated("use timestamp_nanoseconds, the time zone is stored in the format")]] =
+        date::zoned_time<std::chrono::nanoseconds>;
+
+    /**
+     * Time elapsed since midnight, in unit D. It behaves as a D, and can be
+     * split into fields with std::chrono::hh_mm_ss.
+     */
+    template <class D>
+    class time_of_day : public D
+    {
+    public:
+
+        using D::D;
+
+        constexpr time_of_day() = default;
+
+        constexpr explicit time_of_day(const D& d)
+            : D(d)
+        {
+        }
+    };
+
+    // Values of the temporal layouts. Dates are calendar dates, not tied to a
+    // time zone; timestamps are instants, the time zone of an array of
+    // timestamps is stored once in its format.
+    using date_days = std::chrono::local_days;
+    using date_milliseconds = std::chrono::local_time<std::chrono::milliseconds>;
+    using time_seconds = time_of_day<std::chrono::seconds>;
+    using time_milliseconds = time_of_day<std::chrono::milliseconds>;
+    using time_microseconds = time_of_day<std::chrono::microseconds>;
+    using time_nanoseconds = time_of_day<std::chrono::nanoseconds>;
+    using timestamp_seconds = std::chrono::sys_time<std::chrono::seconds>;
+    using timestamp_milliseconds = std::chrono::sys_time<std::chrono::milliseconds>;
+    using timestamp_microseconds = std::chrono::sys_time<std::chrono::microseconds>;
+    using timestamp_nanoseconds = std::chrono::sys_time<std::chrono::nanoseconds>;
 
     // We need to be sure the current target platform is setup to support correctly these types.
     static_assert(sizeof(float16_t) == 2);
@@ -140,11 +178,6 @@ namespace sparrow
         STRING = 13,
         // Variable-length bytes (no guarantee of UTF8-ness)
         BINARY = 14,
-        // Fixed-size binary. Each value occupies the same number of bytes
-        FIXED_SIZE_BINARY = 15,
-        // Number of nanoseconds since the UNIX epoch with an optional timezone.
-        // See: https://arrow.apache.org/docs/python/timestamps.html#timestamps
-        TIMESTAMP = 18,
         LIST = 19,
         LARGE_LIST = 20,
         LIST_VIEW = 21,
@@ -155,10 +188,139 @@ namespace sparrow
         DENSE_UNION,
         SPARSE_UNION,
         RUN_ENCODED,
+        // 128-bit decimal
         DECIMAL,
-        FIXED_WIDTH_BINARY
+        // Fixed-size binary ("w:N"). Each value occupies the same number of bytes
+        FIXED_WIDTH_BINARY,
+        // UTF8 variable-length string with 64-bit offsets
+        LARGE_STRING,
+        // Variable-length bytes with 64-bit offsets
+        LARGE_BINARY,
+        // UTF8 variable-length string stored as 16-byte views
+        STRING_VIEW,
+        // Variable-length bytes stored as 16-byte views
+        BINARY_VIEW,
+        // 256-bit decimal
+        DECIMAL256,
+        // Days and milliseconds since the UNIX epoch
+        DATE_DAYS,
+        DATE_MILLISECONDS,
+        // Time elapsed since midnight
+        TIME_SECONDS,
+        TIME_MILLISECONDS,
+        TIME_MICROSECONDS,
+        TIME_NANOSECONDS,
+        // Time elapsed since the UNIX epoch, with an optional time zone stored
+        // in the format. See: https://arrow.apache.org/docs/python/timestamps.html#timestamps
+        TIMESTAMP_SECONDS,
+        TIMESTAMP_MILLISECONDS,
+        TIMESTAMP_MICROSECONDS,
+        TIMESTAMP_NANOSECONDS,
+        DURATION_SECONDS,
+        DURATION_MILLISECONDS,
+        DURATION_MICROSECONDS,
+        DURATION_NANOSECONDS,
+        // Former name of FIXED_WIDTH_BINARY
+        FIXED_SIZE_BINARY [[deprecated("use FIXED_WIDTH_BINARY")]] = FIXED_WIDTH_BINARY
+    };
+
+    /// Parameters of a decimal format string "d:precision,scale[,bitwidth]".
+    struct decimal_format
+    {
+        std::size_t precision = 0;
+        std::int32_t scale = 0;
+        std::size_t bit_width = 128;
     };
 
+    /// @returns The number of bytes of the values of the provided fixed-size binary
+    ///          format string "w:N", which may be 0, or an empty optional if it is
+    ///          not a valid one.
+    constexpr std::optional<std::size_t> parse_fixed_width_binary_format(std::string_view format)
+    {
+        if (!format.starts_with("w:") || format.size() == 2 || format.size() > 11)
+        {
+            return std::nullopt;
+        }
+        std::size_t width = 0;
+        for (const char c : format.substr(2))
+        {
+            if (c < '0' || c > '9')
+            {
+                return std::nullopt;
+            }
+            width = width * 10 + static_cast<std::size_t>(c - '0');
+        }
+        return width;
+    }
+
+    /// @returns The parameters of the provided decimal format string, or an empty
+    ///          optional if it is not a valid decimal format string.
+    constexpr std::optional<decimal_format> parse_decimal_format(std::string_view format)
+    {
+        if (!format.starts_with("d:"))
+        {
+            return std::nullopt;
+        }
+        format.remove_prefix(2);
+
+        // Parses the next comma separated integer, which is negative only if
+        // allow_sign is true.
+        const auto next_integer = [&format](bool allow_sign) -> std::optional<std::int64_t>
+        {
+            bool negative = false;
+            if (allow_sign && !format.empty() && format.front() == '-')
+            {
+                negative = true;
+                format.remove_prefix(1);
+            }
+            std::int64_t value = 0;
+            std::size_t digits = 0;
+            while (!format.empty() && format.front() >= '0' && format.front() <= '9')
+            {
+                value = value * 10 + (format.front() - '0');
+                format.remove_prefix(1);
+                if (++digits > 9)
+                {
+                    return std::nullopt;
+                }
+            }
+            if (digits == 0)
+            {
+                return std::nullopt;
+            }
+            if (!format.empty())
+            {
+                if (format.front() != ',' || format.size() == 1)
+                {
+                    return std::nullopt;
+                }
+                format.remove_prefix(1);
+            }
+            return negative ? -value : value;
+        };
+
+        const auto precision = next_integer(false);
+        const bool has_scale = !format.empty();
+        const auto scale = has_scale ? next_integer(true) : std::nullopt;
+        if (!precision.has_value() || !scale.has_value() || *precision == 0)
+        {
+            return std::nullopt;
+        }
+        decimal_format result;
+        result.precision = static_cast<std::size_t>(*precision);
+        result.scale = static_cast<std::int32_t>(*scale);
+        if (!format.empty())
+        {
+            const auto bit_width = next_integer(false);
+            if (!bit_width.has_value() || !format.empty())
+            {
+                return std::nullopt;
+            }
+            result.bit_width = static_cast<std::size_t>(*bit_width);
+        }
+        return result;
+    }
+
     /// @returns The data_type value matching the provided format string or `data_type::NA`
     ///          if we couldnt find a matching data_type.
     // TODO: consider returning an optional instead
@@ -197,27 +359,85 @@ namespace sparrow
                 case 'g':
                     return data_type::DOUBLE;
                 case 'u':
-                case 'U':  // large string
                     return data_type::STRING;
+                case 'U':  // large string
+                    return data_type::LARGE_STRING;
                 case 'z':  // binary
-                case 'Z':  // large binary
                     return data_type::BINARY;
+                case 'Z':  // large binary
+                    return data_type::LARGE_BINARY;
                 default:
                     return data_type::NA;
             }
         }
         else if (format == "vu")  // string view
         {
-            return data_type::STRING;
+            return data_type::STRING_VIEW;
         }
         else if (format == "vz")  // binary view
         {
-            return data_type::FIXED_SIZE_BINARY;
+            return data_type::BINARY_VIEW;
         }
-        // TODO: add propper timestamp support below
-        else if (format.starts_with("t"))
+        else if (format.size() == 3 && format.starts_with("td"))
         {
-            return data_type::TIMESTAMP;
+            switch (format[2])
+            {
+                case 'D':
+                    return data_type::DATE_DAYS;
+                case 'm':
+                    return data_type::DATE_MILLISECONDS;
+                default:
+                    return data_type::NA;
+            }
+        }
+        else if (format.size() == 3 && format.starts_with("tt"))
+        {
+            switch (format[2])
+            {
+                case 's':
+                    return data_type::TIME_SECONDS;
+                case 'm':
+                    return data_type::TIME_MILLISECONDS;
+                case 'u':
+                    return data_type::TIME_MICROSECONDS;
+                case 'n':
+                    return data_type::TIME_NANOSECONDS;
+                default:
+                    return data_type::NA;
+            }
+        }
+        // The time zone follows the colon, and may be empty.
+        else if (format.size() >= 4 && format.starts_with("ts") && format[3] == ':')
+        {
+            switch (format[2])
+            {
+                case 's':
+                    return data_type::TIMESTAMP_SECONDS;
+                case 'm':
+                    return data_type::TIMESTAMP_MILLISECONDS;
+                case 'u':
+                    return data_type::TIMESTAMP_MICROSECONDS;
+                case 'n':
+                    return data_type::TIMESTAMP_NANOSECONDS;
+                default:
+                    return data_type::NA;
+            }
+        }
+        else if (format.size() == 3 && format.starts_with("tD"))
+        {
+            switch (format[2])
+            {
+                case 's':
+                    return data_type::DURATION_SECONDS;
+                case 'm':
+                    return data_type::DURATION_MILLISECONDS;
+                case 'u':
+                    return data_type::DURATION_MICROSECONDS;
+                case 'n':
+                    return data_type::DURATION_NANOSECONDS;
+                default:
+                    return data_type::NA;
+            }
         }
         else if (format == "+l")
         {
@@ -261,11 +481,27 @@ namespace sparrow
         }
         else if (format.starts_with("d:"))
         {
-            return data_type::DECIMAL;
+            const auto decimal = parse_decimal_format(format);
+            if (!decimal.has_value())
+            {
+                return data_type::NA;
+            }
+            switch (decimal->bit_width)
+            {
+                case 128:
+                    return decimal->precision <= decimal128_t::max_precision ? data_type::DECIMAL
+                                                                             : data_type::NA;
+                case 256:
+                    return decimal->precision <= decimal256_t::max_precision ? data_type::DECIMAL256
+                                                                             : data_type::NA;
+                default:
+                    return data_type::NA;
+            }
         }
         else if (format.starts_with("w:"))
         {
-            return data_type::FIXED_WIDTH_BINARY;
+            return parse_fixed_width_binary_format(format).has_value() ? data_type::FIXED_WIDTH_BINARY
+                                                                       : data_type::NA;
         }
 
         return data_type::NA;
@@ -297,6 +533,21 @@ namespace sparrow
             case data_type::HALF_FLOAT:
             case data_type::FIXED_WIDTH_BINARY:
             case data_type::DECIMAL:
+            case data_type::DECIMAL256:
+            case data_type::DATE_DAYS:
+            case data_type::DATE_MILLISECONDS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+            case data_type::TIME_MICROSECONDS:
+            case data_type::TIME_NANOSECONDS:
+            case data_type::TIMESTAMP_SECONDS:
+            case data_type::TIMESTAMP_MILLISECONDS:
+            case data_type::TIMESTAMP_MICROSECONDS:
+            case data_type::TIMESTAMP_NANOSECONDS:
+            case data_type::DURATION_SECONDS:
+            case data_type::DURATION_MILLISECONDS:
+            case data_type::DURATION_MICROSECONDS:
+            case data_type::DURATION_NANOSECONDS:
             case data_type::LIST:
             case data_type::LARGE_LIST:
             case data_type::MAP:
@@ -305,8 +556,12 @@ namespace sparrow
                 return 2;
             case data_type::STRING:
             case data_type::BINARY:
-            case data_type::FIXED_SIZE_BINARY:
-            case data_type::TIMESTAMP:
+            case data_type::LARGE_STRING:
+            case data_type::LARGE_BINARY:
+            // View layouts have at least 3 buffers (validity, views and the sizes
+            // of the variadic data buffers), and any number of data buffers.
+            case data_type::STRING_VIEW:
+            case data_type::BINARY_VIEW:
             case data_type::LIST_VIEW:
             case data_type::LARGE_LIST_VIEW:
                 return 3;
@@ -408,12 +663,49 @@ namespace sparrow
                 return "u";
             case data_type::BINARY:
                 return "z";
-            case data_type::TIMESTAMP:
+            case data_type::LARGE_STRING:
+                return "U";
+            case data_type::LARGE_BINARY:
+                return "Z";
+            case data_type::STRING_VIEW:
+                return "vu";
+            case data_type::BINARY_VIEW:
+                return "vz";
+            case data_type::DATE_DAYS:
+                return "tdD";
+            case data_type::DATE_MILLISECONDS:
+                return "tdm";
+            case data_type::TIME_SECONDS:
+                return "tts";
+            case data_type::TIME_MILLISECONDS:
+                return "ttm";
+            case data_type::TIME_MICROSECONDS:
+                return "ttu";
+            case data_type::TIME_NANOSECONDS:
+                return "ttn";
+            // Timestamps without time zone
+            case data_type::TIMESTAMP_SECONDS:
+                return "tss:";
+            case data_type::TIMESTAMP_MILLISECONDS:
+                return "tsm:";
+            case data_type::TIMESTAMP_MICROSECONDS:
+                return "tsu:";
+            case data_type::TIMESTAMP_NANOSECONDS:
+                return "tsn:";
+            case data_type::DURATION_SECONDS:
+                return "tDs";
+            case data_type::DURATION_MILLISECONDS:
                 return "tDm";
+            case data_type::DURATION_MICROSECONDS:
+                return "tDu";
+            case data_type::DURATION_NANOSECONDS:
+                return "tDn";
             case data_type::LIST:
                 return "+l";
             case data_type::LARGE_LIST:
                 return "+L";
+            case data_type::MAP:
+                return "+m";
             default:
                 // TODO: add missing types
                 throw std::runtime_error("Unsupported data type");
@@ -462,6 +754,48 @@ namespace sparrow
         }
     }
 
+    /// @returns True if the provided data_type is a date, time, timestamp or duration
+    ///          type, false otherwise.
+    constexpr bool data_type_is_temporal(data_type dt)
+    {
+        switch (dt)
+        {
+            case data_type::DATE_DAYS:
+            case data_type::DATE_MILLISECONDS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+            case data_type::TIME_MICROSECONDS:
+            case data_type::TIME_NANOSECONDS:
+            case data_type::TIMESTAMP_SECONDS:
+            case data_type::TIMESTAMP_MILLISECONDS:
+            case data_type::TIMESTAMP_MICROSECONDS:
+            case data_type::TIMESTAMP_NANOSECONDS:
+            case data_type::DURATION_SECONDS:
+            case data_type::DURATION_MILLISECONDS:
+            case data_type::DURATION_MICROSECONDS:
+            case data_type::DURATION_NANOSECONDS:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /// @returns The number of bytes of a value of the provided temporal data type:
+    ///          date32 and time32 values are stored as int32, the other ones as int64.
+    constexpr std::size_t temporal_value_size(data_type dt)
+    {
+        SPARROW_ASSERT_TRUE(data_type_is_temporal(dt));
+        switch (dt)
+        {
+            case data_type::DATE_DAYS:
+            case data_type::TIME_SECONDS:
+            case data_type::TIME_MILLISECONDS:
+                return sizeof(std::int32_t);
+            default:
+                return sizeof(std::int64_t);
+        }
+    }
+
     /// @returns The number of bytes required to store the provided primitive data type.
     template<std::integral T>
     constexpr size_t primitive_bytes_count(data_type data_type, T size)
@@ -519,11 +853,26 @@ namespace sparrow
         float32_t,
         float64_t,
         std::string,
-        // std::vector<byte_t>,
-        sparrow::timestamp,
+        std::vector<byte_t>,
         // TODO: add missing fundamental types here
         list_value,
-        struct_value
+        struct_value,
+        decimal128_t,
+        decimal256_t,
+        date_days,
+        date_milliseconds,
+        time_seconds,
+        time_milliseconds,
+        time_microseconds,
+        time_nanoseconds,
+        timestamp_seconds,
+        timestamp_milliseconds,
+        timestamp_microseconds,
+        timestamp_nanoseconds,
+        std::chrono::seconds,
+        std::chrono::milliseconds,
+        std::chrono::microseconds,
+        std::chrono::nanoseconds
         >;
 
     /// Type list of every C++ representation types supported by default, in order matching `data_type`
@@ -18,6 +18,7 @@
 #include <array>
 #include <bit>
 #include <concepts>
+#include <cstdint>
 
 namespace sparrow
 {
@@ -49,4 +50,18 @@ namespace sparrow
             return value;
         }
     }
+
+    namespace detail
+    {
+        // Finalizer of MurmurHash3: spreads every bit of x over the whole result.
+        constexpr std::uint64_t mix_hash(std::uint64_t x) noexcept
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ULL;
+            x ^= x >> 33;
+            return x;
+        }
+    }
 }
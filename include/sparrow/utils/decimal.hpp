@@ -0,0 +1,516 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "sparrow/utils/wide_integer.hpp"
+
+namespace sparrow
+{
+    /**
+     * Exact decimal number: an integer, the unscaled value, and a scale, the
+     * number of digits after the decimal point. The number is
+     * value() * 10^-scale(); the scale can be negative.
+     *
+     * Decimals of a decimal array share the scale of the array, which is
+     * stored in its schema; only the unscaled values are stored in the
+     * buffers.
+     *
+     * @tparam I the integer type of the unscaled value, int128_t or int256_t.
+     */
+    template <class I>
+    class decimal
+    {
+    public:
+
+        using integer_type = I;
+
+        /// Maximum precision, i.e. number of significant digits.
+        static constexpr std::size_t max_precision = max_decimal_digits<I::word_count>();
+
+        constexpr decimal() noexcept = default;
+        constexpr decimal(const integer_type& value, std::int32_t scale) noexcept;
+
+        [[nodiscard]] constexpr const integer_type& value() const noexcept;
+        [[nodiscard]] constexpr std::int32_t scale() const noexcept;
+
+        /**
+         * The same number with the scale \c new_scale. Decreasing the scale
+         * rounds half away from zero.
+         *
+         * @throws std::overflow_error if the result cannot be represented.
+         */
+        [[nodiscard]] decimal rescale(std::int32_t new_scale) const;
+
+        /// Nearest double. The conversion is exact for values of up to 15
+        /// significant digits and scales of up to 22.
+        [[nodiscard]] explicit operator double() const noexcept;
+
+        [[nodiscard]] std::string to_string() const;
+
+        /**
+         * The decimal of scale \c scale nearest to \c value, rounding half
+         * away from zero. The binary value of \c value is converted exactly
+         * for non-negative scales.
+         *
+         * @throws std::invalid_argument if value is not finite.
+         * @throws std::overflow_error if the result cannot be represented.
+         */
+        [[nodiscard]] static decimal from_double(double value, std::int32_t scale);
+
+        /**
+         * Parses a decimal number, with an optional sign, an optional
+         * fractional part and an optional exponent, e.g. "-12.5e3", and
+         * rescales it to \c scale.
+         *
+         * @throws std::invalid_argument if str is not a decimal number.
+         * @throws std::overflow_error if the result cannot be represented.
+         */
+        [[nodiscard]] static decimal from_string(std::string_view str, std::int32_t scale);
+
+    private:
+
+        integer_type m_value = {};
+        std::int32_t m_scale = 0;
+    };
+
+    using decimal128_t = decimal<int128_t>;
+    using decimal256_t = decimal<int256_t>;
+
+    /// Decimals are compared by value, whatever their scale.
+    template <class I>
+    [[nodiscard]] bool operator==(const decimal<I>& lhs, const decimal<I>& rhs);
+
+    template <class I>
+    [[nodiscard]] std::strong_ordering operator<=>(const decimal<I>& lhs, const decimal<I>& rhs);
+
+    /**************************
+     * decimal implementation *
+     **************************/
+
+    namespace detail
+    {
+        // Divides the unsigned integer words by 10^exponent, in place.
+        template <std::size_t N>
+        constexpr void divide_words_pow10(std::array<std::uint64_t, N>& words, std::size_t exponent) noexcept
+        {
+            constexpr std::size_t chunk_digits = 9;
+            constexpr std::uint64_t chunk_divisor = 1000000000u;
+            for (; exponent >= chunk_digits; exponent -= chunk_digits)
+            {
+                divide_words(words, chunk_divisor);
+            }
+            std::uint64_t divisor = 1;
+            for (; exponent > 0; --exponent)
+            {
+                divisor *= 10;
+            }
+            divide_words(words, divisor);
+        }
+
+        // Sets result to value * 10^delta, rounding half away from zero if
+        // delta is negative. Returns true on overflow.
+        template <std::size_t N>
+        constexpr bool scale_overflow(const wide_integer<N>& value, std::int64_t delta, wide_integer<N>& result) noexcept
+        {
+            if (delta >= 0)
+            {
+                if (value.is_zero())
+                {
+                    result = value;
+                    return false;
+                }
+                wide_integer<N> factor;
+                if (pow10_overflow(static_cast<std::size_t>(delta), factor))
+                {
+                    return true;
+                }
+                return mul_overflow(value, factor, result);
+            }
+
+            const auto exponent = static_cast<std::size_t>(-delta);
+            if (exponent > max_decimal_digits<N>() + 1)
+            {
+                result = wide_integer<N>();
+                return false;
+            }
+            // Rounding half away from zero only depends on the first dropped
+            // digit.
+            auto words = magnitude(value);
+            divide_words_pow10(words, exponent - 1);
+            const std::uint64_t first_dropped = divide_words(words, 10);
+            if (first_dropped >= 5)
+            {
+                std::array<std::uint64_t, N> one = {};
+                one[0] = 1;
+                add_words(words, one, words);
+            }
+            return from_magnitude(words, value.is_negative(), result);
+        }
+
+        // Logical shifts of unsigned integer words.
+        template <std::size_t N>
+        constexpr void shift_right_words(std::array<std::uint64_t, N>& words, std::size_t shift) noexcept
+        {
+            const std::size_t word_shift = shift / 64;
+            const std::size_t bit_shift = shift % 64;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                const std::size_t src = i + word_shift;
+                const std::uint64_t low = src < N ? words[src] : 0;
+                const std::uint64_t high = src + 1 < N ? words[src + 1] : 0;
+                words[i] = bit_shift == 0 ? low : (low >> bit_shift) | (high << (64 - bit_shift));
+            }
+        }
+
+        template <std::size_t N>
+        constexpr void shift_left_words(std::array<std::uint64_t, N>& words, std::size_t shift) noexcept
+        {
+            const std::size_t word_shift = shift / 64;
+            const std::size_t bit_shift = shift % 64;
+            for (std::size_t i = N; i-- > 0;)
+            {
+                const std::uint64_t high = i >= word_shift ? words[i - word_shift] : 0;
+                const std::uint64_t low = i >= word_shift + 1 ? words[i - word_shift - 1] : 0;
+                words[i] = bit_shift == 0 ? high : (high << bit_shift) | (low >> (64 - bit_shift));
+            }
+        }
+
+        // Number of significant bits of unsigned integer words.
+        template <std::size_t N>
+        constexpr std::size_t bit_length(const std::array<std::uint64_t, N>& words) noexcept
+        {
+            for (std::size_t i = N; i-- > 0;)
+            {
+                if (words[i] != 0)
+                {
+                    std::size_t bits = 0;
+                    for (std::uint64_t w = words[i]; w != 0; w >>= 1)
+                    {
+                        ++bits;
+                    }
+                    return 64 * i + bits;
+                }
+            }
+            return 0;
+        }
+
+        inline double pow10_double(std::int64_t exponent)
+        {
+            // Powers of ten up to 10^22 are exact doubles.
+            constexpr std::array<double, 23> exact = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                      1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                      1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+            if (exponent >= 0 && exponent < static_cast<std::int64_t>(exact.size()))
+            {
+                return exact[static_cast<std::size_t>(exponent)];
+            }
+            return std::pow(10., static_cast<double>(exponent));
+        }
+    }
+
+    template <class I>
+    constexpr decimal<I>::decimal(const integer_type& value, std::int32_t scale) noexcept
+        : m_value(value)
+        , m_scale(scale)
+    {
+    }
+
+    template <class I>
+    constexpr auto decimal<I>::value() const noexcept -> const integer_type&
+    {
+        return m_value;
+    }
+
+    template <class I>
+    constexpr std::int32_t decimal<I>::scale() const noexcept
+    {
+        return m_scale;
+    }
+
+    template <class I>
+    decimal<I> decimal<I>::rescale(std::int32_t new_scale) const
+    {
+        integer_type result;
+        const std::int64_t delta = static_cast<std::int64_t>(new_scale) - m_scale;
+        if (detail::scale_overflow(m_value, delta, result))
+        {
+            throw std::overflow_error("decimal rescale overflow");
+        }
+        return decimal(result, new_scale);
+    }
+
+    template <class I>
+    decimal<I>::operator double() const noexcept
+    {
+        const auto value = static_cast<double>(m_value);
+        return m_scale >= 0 ? value / detail::pow10_double(m_scale) : value * detail::pow10_double(-m_scale);
+    }
+
+    template <class I>
+    std::string decimal<I>::to_string() const
+    {
+        std::string digits = sparrow::to_string(m_value);
+        const bool negative = m_value.is_negative();
+        if (negative)
+        {
+            digits.erase(0, 1);
+        }
+        if (m_scale < 0)
+        {
+            if (digits != "0")
+            {
+                digits.append(static_cast<std::size_t>(-m_scale), '0');
+            }
+        }
+        else if (m_scale > 0)
+        {
+            const auto scale = static_cast<std::size_t>(m_scale);
+            if (digits.size() <= scale)
+            {
+                digits.insert(0, scale + 1 - digits.size(), '0');
+            }
+            digits.insert(digits.size() - scale, 1, '.');
+        }
+        return negative ? "-" + digits : digits;
+    }
+
+    template <class I>
+    decimal<I> decimal<I>::from_double(double value, std::int32_t scale)
+    {
+        if (!std::isfinite(value))
+        {
+            throw std::invalid_argument("cannot convert a non finite double to a decimal");
+        }
+        if (scale < 0)
+        {
+            return decimal(from_double(value / detail::pow10_double(-scale), 0).value(), scale);
+        }
+
+        constexpr std::size_t N = I::word_count;
+        constexpr std::size_t mantissa_bits = 53;
+        int exponent = 0;
+        const double mantissa = std::frexp(std::fabs(value), &exponent);
+        const auto integer_mantissa = static_cast<std::uint64_t>(std::ldexp(mantissa, mantissa_bits));
+        if (integer_mantissa == 0)
+        {
+            return decimal(integer_type(), scale);
+        }
+        // |value| = integer_mantissa * 2^binary_exponent, exactly. The product
+        // by 10^scale is computed on twice as many words, so that it cannot
+        // overflow before the binary exponent is applied.
+        const std::int64_t binary_exponent = static_cast<std::int64_t>(exponent)
+                                             - static_cast<std::int64_t>(mantissa_bits);
+        using wide_type = wide_integer<2 * N>;
+        wide_type scaled;
+        if (pow10_overflow(static_cast<std::size_t>(scale), scaled)
+            || mul_overflow(scaled, wide_type(integer_mantissa), scaled))
+        {
+            throw std::overflow_error("decimal conversion overflow");
+        }
+        auto words = scaled.words();
+        if (binary_exponent >= 0)
+        {
+            const auto shift = static_cast<std::size_t>(binary_exponent);
+            if (detail::bit_length(words) + shift >= wide_type::bit_width)
+            {
+                throw std::overflow_error("decimal conversion overflow");
+            }
+            detail::shift_left_words(words, shift);
+        }
+        else
+        {
+            const auto shift = static_cast<std::size_t>(-binary_exponent);
+            if (shift > wide_type::bit_width)
+            {
+                return decimal(integer_type(), scale);
+            }
+            const std::size_t round_bit = shift - 1;
+            const bool round_up = ((words[round_bit / 64] >> (round_bit % 64)) & 1u) != 0;
+            detail::shift_right_words(words, shift);
+            if (round_up)
+            {
+                std::array<std::uint64_t, 2 * N> one = {};
+                one[0] = 1;
+                detail::add_words(words, one, words);
+            }
+        }
+
+        std::array<std::uint64_t, N> low = {};
+        std::uint64_t high = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            low[i] = words[i];
+            high |= words[i + N];
+        }
+        integer_type result;
+        if (detail::from_magnitude(low, value < 0, result) || high != 0)
+        {
+            throw std::overflow_error("decimal conversion overflow");
+        }
+        return decimal(result, scale);
+    }
+
+    template <class I>
+    decimal<I> decimal<I>::from_string(std::string_view str, std::int32_t scale)
+    {
+        std::size_t pos = 0;
+        bool negative = false;
+        if (pos < str.size() && (str[pos] == '-' || str[pos] == '+'))
+        {
+            negative = str[pos] == '-';
+            ++pos;
+        }
+
+        // Digits are accumulated in a 64-bit chunk, which is then added to
+        // the wide integer with a single multiplication. Negative values are
+        // accumulated with their sign so that the minimum value, whose
+        // magnitude does not fit in integer_type, is accepted.
+        constexpr std::size_t chunk_digits = 18;
+        integer_type value;
+        std::uint64_t chunk = 0;
+        std::size_t chunk_size = 0;
+        bool overflow = false;
+        const auto flush = [&]()
+        {
+            integer_type factor;
+            overflow = pow10_overflow(chunk_size, factor) || overflow;
+            overflow = mul_overflow(value, factor, value) || overflow;
+            overflow = (negative ? sub_overflow(value, integer_type(chunk), value)
+                                 : add_overflow(value, integer_type(chunk), value))
+                       || overflow;
+            chunk = 0;
+            chunk_size = 0;
+        };
+
+        std::size_t digit_count = 0;
+        std::int64_t fraction_digits = 0;
+        bool in_fraction = false;
+        for (; pos < str.size(); ++pos)
+        {
+            const char c = str[pos];
+            if (c >= '0' && c <= '9')
+            {
+                chunk = chunk * 10 + static_cast<std::uint64_t>(c - '0');
+                ++digit_count;
+                fraction_digits += in_fraction ? 1 : 0;
+                if (++chunk_size == chunk_digits)
+                {
+                    flush();
+                }
+            }
+            else if (c == '.' && !in_fraction)
+            {
+                in_fraction = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (digit_count == 0)
+        {
+            throw std::invalid_argument("invalid decimal string");
+        }
+        flush();
+
+        std::int64_t exponent = 0;
+        if (pos < str.size() && (str[pos] == 'e' || str[pos] == 'E'))
+        {
+            ++pos;
+            bool negative_exponent = false;
+            if (pos < str.size() && (str[pos] == '-' || str[pos] == '+'))
+            {
+                negative_exponent = str[pos] == '-';
+                ++pos;
+            }
+            if (pos == str.size())
+            {
+                throw std::invalid_argument("invalid decimal string");
+            }
+            for (; pos < str.size() && str[pos] >= '0' && str[pos] <= '9'; ++pos)
+            {
+                exponent = exponent * 10 + (str[pos] - '0');
+                if (exponent > 100000)
+                {
+                    throw std::overflow_error("decimal exponent overflow");
+                }
+            }
+            exponent = negative_exponent ? -exponent : exponent;
+        }
+        if (pos != str.size())
+        {
+            throw std::invalid_argument("invalid decimal string");
+        }
+        if (overflow)
+        {
+            throw std::overflow_error("decimal conversion overflow");
+        }
+
+        integer_type result;
+        const std::int64_t delta = static_cast<std::int64_t>(scale) - (fraction_digits - exponent);
+        if (detail::scale_overflow(value, delta, result))
+        {
+            throw std::overflow_error("decimal conversion overflow");
+        }
+        return decimal(result, scale);
+    }
+
+    template <class I>
+    bool operator==(const decimal<I>& lhs, const decimal<I>& rhs)
+    {
+        return (lhs <=> rhs) == std::strong_ordering::equal;
+    }
+
+    template <class I>
+    std::strong_ordering operator<=>(const decimal<I>& lhs, const decimal<I>& rhs)
+    {
+        if (lhs.scale() == rhs.scale())
+        {
+            return lhs.value() <=> rhs.value();
+        }
+        // The operand of smaller scale is rescaled up. If that overflows, its
+        // magnitude exceeds the one of any integer_type, so its sign decides.
+        const bool lhs_finer = lhs.scale() > rhs.scale();
+        const decimal<I>& coarse = lhs_finer ? rhs : lhs;
+        const decimal<I>& fine = lhs_finer ? lhs : rhs;
+        I rescaled;
+        const std::int64_t delta = static_cast<std::int64_t>(fine.scale()) - coarse.scale();
+        std::strong_ordering coarse_order = std::strong_ordering::equal;
+        if (detail::scale_overflow(coarse.value(), delta, rescaled))
+        {
+            coarse_order = coarse.value().is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        else
+        {
+            coarse_order = rescaled <=> fine.value();
+        }
+        if (!lhs_finer)
+        {
+            return coarse_order;
+        }
+        return coarse_order == std::strong_ordering::less      ? std::strong_ordering::greater
+               : coarse_order == std::strong_ordering::greater ? std::strong_ordering::less
+                                                               : std::strong_ordering::equal;
+    }
+}
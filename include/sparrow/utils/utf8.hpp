@@ -0,0 +1,135 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace sparrow
+{
+    namespace detail
+    {
+        // Returns true if the 8 bytes starting at p are all ASCII characters.
+        inline bool is_ascii_block(const std::uint8_t* p) noexcept
+        {
+            std::uint64_t block;
+            std::memcpy(&block, p, sizeof(block));
+            return (block & 0x8080808080808080ULL) == 0;
+        }
+    }
+
+    /**
+     * Returns the position of the first byte of the first invalid UTF-8
+     * sequence in [data, data + size), or \c size if the range is valid UTF-8.
+     *
+     * Overlong encodings, surrogates and code points above U+10FFFF are
+     * rejected. ASCII runs are skipped 8 bytes at a time.
+     */
+    inline std::size_t find_invalid_utf8(const std::uint8_t* data, std::size_t size) noexcept
+    {
+        std::size_t i = 0;
+        while (i < size)
+        {
+            if (size - i >= 8 && detail::is_ascii_block(data + i))
+            {
+                i += 8;
+                continue;
+            }
+            const std::uint8_t c = data[i];
+            if (c < 0x80)
+            {
+                ++i;
+                continue;
+            }
+
+            // Length of the sequence and range of its second byte, see table 3-7
+            // of the Unicode standard.
+            std::size_t length = 0;
+            std::uint8_t low = 0x80;
+            std::uint8_t high = 0xBF;
+            if (c >= 0xC2 && c <= 0xDF)
+            {
+                length = 2;
+            }
+            else if (c == 0xE0)
+            {
+                length = 3;
+                low = 0xA0;
+            }
+            else if ((c >= 0xE1 && c <= 0xEC) || c == 0xEE || c == 0xEF)
+            {
+                length = 3;
+            }
+            else if (c == 0xED)
+            {
+                length = 3;
+                high = 0x9F;
+            }
+            else if (c == 0xF0)
+            {
+                length = 4;
+                low = 0x90;
+            }
+            else if (c >= 0xF1 && c <= 0xF3)
+            {
+                length = 4;
+            }
+            else if (c == 0xF4)
+            {
+                length = 4;
+                high = 0x8F;
+            }
+            else
+            {
+                return i;
+            }
+
+            if (size - i < length || data[i + 1] < low || data[i + 1] > high)
+            {
+                return i;
+            }
+            for (std::size_t k = 2; k < length; ++k)
+            {
+                if ((data[i + k] & 0xC0) != 0x80)
+                {
+                    return i;
+                }
+            }
+            i += length;
+        }
+        return size;
+    }
+
+    /**
+     * Returns true if \c str is a valid UTF-8 string.
+     */
+    inline bool is_valid_utf8(std::string_view str) noexcept
+    {
+        const auto* data = reinterpret_cast<const std::uint8_t*>(str.data());
+        return find_invalid_utf8(data, str.size()) == str.size();
+    }
+
+    /**
+     * Returns true if \c c is a UTF-8 continuation byte, i.e. a byte that
+     * cannot start a character.
+     */
+    constexpr bool is_utf8_continuation_byte(std::uint8_t c) noexcept
+    {
+        return (c & 0xC0) == 0x80;
+    }
+}
@@ -0,0 +1,573 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace sparrow
+{
+    /**
+     * Signed integer of 64 * N bits, stored as N 64-bit words in two's
+     * complement, least significant word first. This is the memory layout
+     * of the values of Arrow decimal arrays on little endian platforms.
+     *
+     * Arithmetic operators wrap around; the *_overflow functions report
+     * overflows instead. Carries and borrows are propagated without
+     * branches, so that loops over arrays of wide integers can be
+     * vectorized.
+     *
+     * @tparam N the number of 64-bit words.
+     */
+    template <std::size_t N>
+    class wide_integer
+    {
+    public:
+
+        static_assert(N >= 2, "use the built-in integer types for 64 bits or less");
+
+        using word_type = std::uint64_t;
+        using words_type = std::array<word_type, N>;
+
+        static constexpr std::size_t word_count = N;
+        static constexpr std::size_t bit_width = 64 * N;
+
+        constexpr wide_integer() noexcept = default;
+
+        template <std::integral T>
+        constexpr wide_integer(T value) noexcept;
+
+        constexpr explicit wide_integer(const words_type& words) noexcept;
+
+        /// Sign-extends or truncates a wide integer of another width.
+        template <std::size_t M>
+            requires(M != N)
+        constexpr explicit wide_integer(const wide_integer<M>& other) noexcept;
+
+        [[nodiscard]] constexpr const words_type& words() const noexcept;
+        [[nodiscard]] constexpr bool is_negative() const noexcept;
+        [[nodiscard]] constexpr bool is_zero() const noexcept;
+
+        [[nodiscard]] static constexpr wide_integer max() noexcept;
+        [[nodiscard]] static constexpr wide_integer min() noexcept;
+
+        constexpr wide_integer operator-() const noexcept;
+
+        constexpr wide_integer& operator+=(const wide_integer& rhs) noexcept;
+        constexpr wide_integer& operator-=(const wide_integer& rhs) noexcept;
+        constexpr wide_integer& operator*=(const wide_integer& rhs) noexcept;
+
+        /// Nearest double, up to the rounding of the intermediate sums.
+        [[nodiscard]] explicit operator double() const noexcept;
+
+    private:
+
+        words_type m_words = {};
+    };
+
+    using int128_t = wide_integer<2>;
+    using int256_t = wide_integer<4>;
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr wide_integer<N> operator+(wide_integer<N> lhs, const wide_integer<N>& rhs) noexcept;
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr wide_integer<N> operator-(wide_integer<N> lhs, const wide_integer<N>& rhs) noexcept;
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr wide_integer<N> operator*(wide_integer<N> lhs, const wide_integer<N>& rhs) noexcept;
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr bool operator==(const wide_integer<N>& lhs, const wide_integer<N>& rhs) noexcept;
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::strong_ordering
+    operator<=>(const wide_integer<N>& lhs, const wide_integer<N>& rhs) noexcept;
+
+    /// Sets \c result to lhs + rhs. Returns true if the sum overflows.
+    template <std::size_t N>
+    constexpr bool add_overflow(const wide_integer<N>& lhs, const wide_integer<N>& rhs, wide_integer<N>& result) noexcept;
+
+    /// Sets \c result to lhs - rhs. Returns true if the difference overflows.
+    template <std::size_t N>
+    constexpr bool sub_overflow(const wide_integer<N>& lhs, const wide_integer<N>& rhs, wide_integer<N>& result) noexcept;
+
+    /// Sets \c result to lhs * rhs. Returns true if the product overflows.
+    template <std::size_t N>
+    constexpr bool mul_overflow(const wide_integer<N>& lhs, const wide_integer<N>& rhs, wide_integer<N>& result) noexcept;
+
+    /**
+     * Sets \c result to 10^exponent. Returns true if it cannot be represented
+     * by wide_integer<N>.
+     */
+    template <std::size_t N>
+    constexpr bool pow10_overflow(std::size_t exponent, wide_integer<N>& result) noexcept;
+
+    /// Largest number of decimal digits such that every integer of that many digits fits in wide_integer<N>.
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::size_t max_decimal_digits() noexcept;
+
+    /// Decimal representation of \c value.
+    template <std::size_t N>
+    [[nodiscard]] std::string to_string(const wide_integer<N>& value);
+
+    /*******************************
+     * wide_integer implementation *
+     *******************************/
+
+    namespace detail
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 uint128_word;
+#endif
+
+        // Sets hi and lo to the high and low words of a * b.
+        constexpr void mul_words(std::uint64_t a, std::uint64_t b, std::uint64_t& hi, std::uint64_t& lo) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            const uint128_word product = static_cast<uint128_word>(a) * b;
+            lo = static_cast<std::uint64_t>(product);
+            hi = static_cast<std::uint64_t>(product >> 64);
+#else
+            constexpr std::uint64_t mask = 0xFFFFFFFFu;
+            const std::uint64_t a_lo = a & mask;
+            const std::uint64_t a_hi = a >> 32;
+            const std::uint64_t b_lo = b & mask;
+            const std::uint64_t b_hi = b >> 32;
+            const std::uint64_t lo_lo = a_lo * b_lo;
+            const std::uint64_t hi_lo = a_hi * b_lo;
+            const std::uint64_t lo_hi = a_lo * b_hi;
+            const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & mask) + lo_hi;
+            lo = (cross << 32) | (lo_lo & mask);
+            hi = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+        }
+
+        // out = a + b, returns the carry out of the last word. out may alias
+        // a or b.
+        template <std::size_t N>
+        constexpr std::uint64_t add_words(
+            const std::array<std::uint64_t, N>& a,
+            const std::array<std::uint64_t, N>& b,
+            std::array<std::uint64_t, N>& out
+        ) noexcept
+        {
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                const std::uint64_t sum = a[i] + b[i];
+                const auto first_carry = static_cast<std::uint64_t>(sum < a[i]);
+                out[i] = sum + carry;
+                carry = first_carry | static_cast<std::uint64_t>(out[i] < sum);
+            }
+            return carry;
+        }
+
+        // out = a - b, returns the borrow out of the last word. out may alias
+        // a or b.
+        template <std::size_t N>
+        constexpr std::uint64_t sub_words(
+            const std::array<std::uint64_t, N>& a,
+            const std::array<std::uint64_t, N>& b,
+            std::array<std::uint64_t, N>& out
+        ) noexcept
+        {
+            std::uint64_t borrow = 0;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                const std::uint64_t diff = a[i] - b[i];
+                const auto first_borrow = static_cast<std::uint64_t>(a[i] < b[i]);
+                out[i] = diff - borrow;
+                borrow = first_borrow | static_cast<std::uint64_t>(diff < borrow);
+            }
+            return borrow;
+        }
+
+        template <std::size_t N>
+        constexpr void negate_words(std::array<std::uint64_t, N>& words) noexcept
+        {
+            std::uint64_t carry = 1;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                words[i] = ~words[i] + carry;
+                carry = static_cast<std::uint64_t>(carry != 0 && words[i] == 0);
+            }
+        }
+
+        // Product of two unsigned integers of N words, on 2 * N words.
+        template <std::size_t N>
+        constexpr std::array<std::uint64_t, 2 * N>
+        full_product(const std::array<std::uint64_t, N>& a, const std::array<std::uint64_t, N>& b) noexcept
+        {
+            std::array<std::uint64_t, 2 * N> result = {};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                std::uint64_t carry = 0;
+                for (std::size_t j = 0; j < N; ++j)
+                {
+                    std::uint64_t hi = 0;
+                    std::uint64_t lo = 0;
+                    mul_words(a[i], b[j], hi, lo);
+                    lo += carry;
+                    hi += static_cast<std::uint64_t>(lo < carry);
+                    lo += result[i + j];
+                    hi += static_cast<std::uint64_t>(lo < result[i + j]);
+                    result[i + j] = lo;
+                    carry = hi;
+                }
+                result[i + N] = carry;
+            }
+            return result;
+        }
+
+        // Divides the unsigned integer words by divisor, in place, and
+        // returns the remainder. The divisor must fit in 32 bits, so that
+        // the division works on 32-bit halves without 128-bit arithmetic.
+        template <std::size_t N>
+        constexpr std::uint64_t divide_words(std::array<std::uint64_t, N>& words, std::uint64_t divisor) noexcept
+        {
+            std::uint64_t remainder = 0;
+            for (std::size_t i = N; i-- > 0;)
+            {
+                const std::uint64_t high = (remainder << 32) | (words[i] >> 32);
+                const std::uint64_t high_quotient = high / divisor;
+                remainder = high % divisor;
+                const std::uint64_t low = (remainder << 32) | (words[i] & 0xFFFFFFFFu);
+                const std::uint64_t low_quotient = low / divisor;
+                remainder = low % divisor;
+                words[i] = (high_quotient << 32) | low_quotient;
+            }
+            return remainder;
+        }
+
+        template <std::size_t N>
+        constexpr bool is_zero_words(const std::array<std::uint64_t, N>& words) noexcept
+        {
+            std::uint64_t any = 0;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                any |= words[i];
+            }
+            return any == 0;
+        }
+
+        // Absolute value of value, as an unsigned integer.
+        template <std::size_t N>
+        constexpr std::array<std::uint64_t, N> magnitude(const wide_integer<N>& value) noexcept
+        {
+            std::array<std::uint64_t, N> words = value.words();
+            if (value.is_negative())
+            {
+                negate_words(words);
+            }
+            return words;
+        }
+
+        // Builds the integer of sign negative and absolute value magnitude.
+        // Returns true if it cannot be represented by wide_integer<N>.
+        template <std::size_t N>
+        constexpr bool from_magnitude(
+            const std::array<std::uint64_t, N>& words,
+            bool negative,
+            wide_integer<N>& result
+        ) noexcept
+        {
+            constexpr std::uint64_t sign_bit = std::uint64_t(1) << 63;
+            bool overflow = (words[N - 1] & sign_bit) != 0;
+            if (overflow && negative)
+            {
+                // The magnitude of the minimum value has only its sign bit set.
+                std::uint64_t rest = words[N - 1] & ~sign_bit;
+                for (std::size_t i = 0; i + 1 < N; ++i)
+                {
+                    rest |= words[i];
+                }
+                overflow = rest != 0;
+            }
+            std::array<std::uint64_t, N> signed_words = words;
+            if (negative)
+            {
+                negate_words(signed_words);
+            }
+            result = wide_integer<N>(signed_words);
+            return overflow;
+        }
+    }
+
+    template <std::size_t N>
+    template <std::integral T>
+    constexpr wide_integer<N>::wide_integer(T value) noexcept
+    {
+        m_words[0] = static_cast<word_type>(value);
+        if constexpr (std::is_signed_v<T>)
+        {
+            const word_type extension = value < 0 ? ~word_type(0) : word_type(0);
+            for (std::size_t i = 1; i < N; ++i)
+            {
+                m_words[i] = extension;
+            }
+        }
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N>::wide_integer(const words_type& words) noexcept
+        : m_words(words)
+    {
+    }
+
+    template <std::size_t N>
+    template <std::size_t M>
+        requires(M != N)
+    constexpr wide_integer<N>::wide_integer(const wide_integer<M>& other) noexcept
+    {
+        const word_type extension = other.is_negative() ? ~word_type(0) : word_type(0);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            m_words[i] = i < M ? other.words()[i] : extension;
+        }
+    }
+
+    template <std::size_t N>
+    constexpr auto wide_integer<N>::words() const noexcept -> const words_type&
+    {
+        return m_words;
+    }
+
+    template <std::size_t N>
+    constexpr bool wide_integer<N>::is_negative() const noexcept
+    {
+        return (m_words[N - 1] >> 63) != 0;
+    }
+
+    template <std::size_t N>
+    constexpr bool wide_integer<N>::is_zero() const noexcept
+    {
+        return detail::is_zero_words(m_words);
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N> wide_integer<N>::max() noexcept
+    {
+        words_type words;
+        words.fill(~word_type(0));
+        words[N - 1] >>= 1;
+        return wide_integer(words);
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N> wide_integer<N>::min() noexcept
+    {
+        words_type words = {};
+        words[N - 1] = word_type(1) << 63;
+        return wide_integer(words);
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N> wide_integer<N>::operator-() const noexcept
+    {
+        wide_integer result(*this);
+        detail::negate_words(result.m_words);
+        return result;
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N>& wide_integer<N>::operator+=(const wide_integer& rhs) noexcept
+    {
+        detail::add_words(m_words, rhs.m_words, m_words);
+        return *this;
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N>& wide_integer<N>::operator-=(const wide_integer& rhs) noexcept
+    {
+        detail::sub_words(m_words, rhs.m_words, m_words);
+        return *this;
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N>& wide_integer<N>::operator*=(const wide_integer& rhs) noexcept
+    {
+        // The low words of the product do not depend on the signs.
+        const auto product = detail::full_product(m_words, rhs.m_words);
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            m_words[i] = product[i];
+        }
+        return *this;
+    }
+
+    template <std::size_t N>
+    wide_integer<N>::operator double() const noexcept
+    {
+        constexpr double word_base = 18446744073709551616.0;  // 2^64
+        const auto words = detail::magnitude(*this);
+        double result = 0.;
+        for (std::size_t i = N; i-- > 0;)
+        {
+            result = result * word_base + static_cast<double>(words[i]);
+        }
+        return is_negative() ? -result : result;
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N> operator+(wide_integer<N> lhs, const wide_integer<N>& rhs) noexcept
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N> operator-(wide_integer<N> lhs, const wide_integer<N>& rhs) noexcept
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    template <std::size_t N>
+    constexpr wide_integer<N> operator*(wide_integer<N> lhs, const wide_integer<N>& rhs) noexcept
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    template <std::size_t N>
+    constexpr bool operator==(const wide_integer<N>& lhs, const wide_integer<N>& rhs) noexcept
+    {
+        return lhs.words() == rhs.words();
+    }
+
+    template <std::size_t N>
+    constexpr std::strong_ordering operator<=>(const wide_integer<N>& lhs, const wide_integer<N>& rhs) noexcept
+    {
+        const auto lhs_top = static_cast<std::int64_t>(lhs.words()[N - 1]);
+        const auto rhs_top = static_cast<std::int64_t>(rhs.words()[N - 1]);
+        if (lhs_top != rhs_top)
+        {
+            return lhs_top <=> rhs_top;
+        }
+        for (std::size_t i = N - 1; i-- > 0;)
+        {
+            if (lhs.words()[i] != rhs.words()[i])
+            {
+                return lhs.words()[i] <=> rhs.words()[i];
+            }
+        }
+        return std::strong_ordering::equal;
+    }
+
+    template <std::size_t N>
+    constexpr bool add_overflow(const wide_integer<N>& lhs, const wide_integer<N>& rhs, wide_integer<N>& result) noexcept
+    {
+        std::array<std::uint64_t, N> words = {};
+        detail::add_words(lhs.words(), rhs.words(), words);
+        const bool lhs_negative = lhs.is_negative();
+        const bool rhs_negative = rhs.is_negative();
+        result = wide_integer<N>(words);
+        return lhs_negative == rhs_negative && result.is_negative() != lhs_negative;
+    }
+
+    template <std::size_t N>
+    constexpr bool sub_overflow(const wide_integer<N>& lhs, const wide_integer<N>& rhs, wide_integer<N>& result) noexcept
+    {
+        std::array<std::uint64_t, N> words = {};
+        detail::sub_words(lhs.words(), rhs.words(), words);
+        const bool lhs_negative = lhs.is_negative();
+        const bool rhs_negative = rhs.is_negative();
+        result = wide_integer<N>(words);
+        return lhs_negative != rhs_negative && result.is_negative() != lhs_negative;
+    }
+
+    template <std::size_t N>
+    constexpr bool mul_overflow(const wide_integer<N>& lhs, const wide_integer<N>& rhs, wide_integer<N>& result) noexcept
+    {
+        const auto product = detail::full_product(detail::magnitude(lhs), detail::magnitude(rhs));
+        std::array<std::uint64_t, N> low = {};
+        std::uint64_t high = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            low[i] = product[i];
+            high |= product[i + N];
+        }
+        const bool overflow = detail::from_magnitude(low, lhs.is_negative() != rhs.is_negative(), result);
+        return overflow || high != 0;
+    }
+
+    template <std::size_t N>
+    constexpr bool pow10_overflow(std::size_t exponent, wide_integer<N>& result) noexcept
+    {
+        // 10^19 is the largest power of ten fitting in a word.
+        constexpr std::uint64_t word_pow10 = 10000000000000000000u;
+        wide_integer<N> value(1);
+        bool overflow = false;
+        for (; exponent >= 19; exponent -= 19)
+        {
+            overflow = mul_overflow(value, wide_integer<N>(word_pow10), value) || overflow;
+        }
+        std::uint64_t factor = 1;
+        for (; exponent > 0; --exponent)
+        {
+            factor *= 10;
+        }
+        overflow = mul_overflow(value, wide_integer<N>(factor), value) || overflow;
+        result = value;
+        return overflow;
+    }
+
+    template <std::size_t N>
+    constexpr std::size_t max_decimal_digits() noexcept
+    {
+        // 10^digits - 1 must fit, i.e. 10^digits must not exceed max() + 1.
+        std::size_t digits = 0;
+        wide_integer<N> value;
+        while (!pow10_overflow(digits + 1, value))
+        {
+            ++digits;
+        }
+        return digits;
+    }
+
+    template <std::size_t N>
+    std::string to_string(const wide_integer<N>& value)
+    {
+        constexpr std::uint64_t chunk_base = 1000000000u;
+        constexpr std::size_t chunk_digits = 9;
+        auto words = detail::magnitude(value);
+        std::string digits;
+        do
+        {
+            std::uint64_t chunk = detail::divide_words(words, chunk_base);
+            const bool last = detail::is_zero_words(words);
+            for (std::size_t i = 0; i < chunk_digits && (!last || chunk != 0); ++i)
+            {
+                digits.push_back(static_cast<char>('0' + chunk % 10));
+                chunk /= 10;
+            }
+        } while (!detail::is_zero_words(words));
+        if (digits.empty())
+        {
+            digits.push_back('0');
+        }
+        if (value.is_negative())
+        {
+            digits.push_back('-');
+        }
+        return std::string(digits.rbegin(), digits.rend());
+    }
+}
@@ -12,118 +12,46 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <array>
 #include <memory>
 
 #include "sparrow/array_factory.hpp"
-#include "sparrow/layout/list_layout/list_array.hpp"
-#include "sparrow/layout/struct_layout/struct_array.hpp"
-#include "sparrow/layout/dictionary_encoded_array.hpp"
-#include "sparrow/layout/primitive_array.hpp"
-#include "sparrow/layout/null_array.hpp"
-#include "sparrow/layout/variable_size_binary_array.hpp"
-#include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
-#include "sparrow/layout/union_array.hpp"
-
-
+#include "sparrow/layout/dispatch.hpp"
 
 namespace sparrow
 {
     namespace detail
     {
+        using factory_function_t = cloning_ptr<array_wrapper> (*)(arrow_proxy);
+
         template <class T>
         cloning_ptr<array_wrapper> make_wrapper_ptr(arrow_proxy proxy)
         {
             return cloning_ptr<array_wrapper>{new array_wrapper_impl<T>(T(std::move(proxy))) };
         }
+
+        template <class... T>
+        constexpr auto make_factory_table(mpl::typelist<T...>)
+        {
+            return std::array<factory_function_t, sizeof...(T)>{&make_wrapper_ptr<T>...};
+        }
+
+        constexpr auto factory_table = make_factory_table(dispatched_array_types{});
     }
 
     cloning_ptr<array_wrapper> array_factory(arrow_proxy proxy)
     {
         const auto dt = proxy.data_type();
-
-        if (proxy.dictionary())
+        const bool is_dictionary = proxy.dictionary() != nullptr;
+        const array_kind kind = get_array_kind(dt, is_dictionary);
+        if (kind == array_kind::UNSUPPORTED)
         {
-            switch(dt)
+            if (is_dictionary)
             {
-            case data_type::INT8:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::int8_t>>(std::move(proxy));
-            case data_type::UINT8:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::uint8_t>>(std::move(proxy));
-            case data_type::INT16:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::int16_t>>(std::move(proxy));
-            case data_type::UINT16:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::uint16_t>>(std::move(proxy));
-            case data_type::INT32:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::int32_t>>(std::move(proxy));
-            case data_type::UINT32:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::uint32_t>>(std::move(proxy));
-            case data_type::INT64:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::int64_t>>(std::move(proxy));
-            case data_type::UINT64:
-                return detail::make_wrapper_ptr<dictionary_encoded_array<std::uint64_t>>(std::move(proxy));
-            default:
                 throw std::runtime_error("data datype of dictionary encoded array must be an integer");
             }
+            throw std::runtime_error("not supported data type");
         }
-        else
-        {
-            switch(dt)
-            {
-            case data_type::NA:
-                return detail::make_wrapper_ptr<null_array>(std::move(proxy));
-            case data_type::BOOL:
-                return detail::make_wrapper_ptr<primitive_array<bool>>(std::move(proxy));
-            case data_type::INT8:
-                return detail::make_wrapper_ptr<primitive_array<std::int8_t>>(std::move(proxy));
-            case data_type::UINT8:
-                return detail::make_wrapper_ptr<primitive_array<std::uint8_t>>(std::move(proxy));
-            case data_type::INT16:
-                return detail::make_wrapper_ptr<primitive_array<std::int16_t>>(std::move(proxy));
-            case data_type::UINT16:
-                return detail::make_wrapper_ptr<primitive_array<std::uint16_t>>(std::move(proxy));
-            case data_type::INT32:
-                return detail::make_wrapper_ptr<primitive_array<std::int32_t>>(std::move(proxy));
-            case data_type::UINT32:
-                return detail::make_wrapper_ptr<primitive_array<std::uint32_t>>(std::move(proxy));
-            case data_type::INT64:
-                return detail::make_wrapper_ptr<primitive_array<std::int64_t>>(std::move(proxy));
-            case data_type::UINT64:
-                return detail::make_wrapper_ptr<primitive_array<std::uint64_t>>(std::move(proxy));
-            case data_type::HALF_FLOAT:
-                return detail::make_wrapper_ptr<primitive_array<float16_t>>(std::move(proxy));
-            case data_type::FLOAT:
-                return detail::make_wrapper_ptr<primitive_array<float>>(std::move(proxy));
-            case data_type::DOUBLE:
-                return detail::make_wrapper_ptr<primitive_array<double>>(std::move(proxy));
-            case data_type::LIST:
-                return detail::make_wrapper_ptr<list_array>(std::move(proxy));
-            case data_type::LARGE_LIST:
-                return detail::make_wrapper_ptr<big_list_array>(std::move(proxy));
-            case data_type::LIST_VIEW:
-                return detail::make_wrapper_ptr<list_view_array>(std::move(proxy));
-            case data_type::LARGE_LIST_VIEW:
-                return detail::make_wrapper_ptr<big_list_view_array>(std::move(proxy));
-            case data_type::FIXED_SIZED_LIST:
-                return detail::make_wrapper_ptr<fixed_sized_list_array>(std::move(proxy));
-            case data_type::STRUCT:
-                return detail::make_wrapper_ptr<struct_array>(std::move(proxy));
-            case data_type::STRING:
-                return detail::make_wrapper_ptr<variable_size_binary_array<std::string, std::string_view>>(std::move(proxy));
-            case data_type::RUN_ENCODED:
-                return detail::make_wrapper_ptr<run_end_encoded_array>(std::move(proxy));
-            case data_type::DENSE_UNION:
-                return detail::make_wrapper_ptr<dense_union_array>(std::move(proxy));
-            case data_type::SPARSE_UNION:
-                return detail::make_wrapper_ptr<sparse_union_array>(std::move(proxy));
-            case data_type::FIXED_SIZE_BINARY:
-            case data_type::TIMESTAMP:
-            case data_type::MAP:
-            case data_type::DECIMAL:
-            case data_type::FIXED_WIDTH_BINARY:
-                throw std::runtime_error("not yet supported data type");
-            default:
-                throw std::runtime_error("not supported data type");
-            }
-        }
+        return detail::factory_table[static_cast<std::size_t>(kind)](std::move(proxy));
     }
 }
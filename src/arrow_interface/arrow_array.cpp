@@ -42,8 +42,9 @@ namespace sparrow
         buffers.reserve(buffer_count);
         const enum data_type data_type = format_to_data_type(schema.format);
         const auto buffers_type = get_buffer_types_from_data_type(data_type);
-        SPARROW_ASSERT_TRUE(buffers_type.size() == buffer_count);
-        for (std::size_t i = 0; i < buffer_count; ++i)
+        const bool variadic = has_variadic_buffers(data_type);
+        SPARROW_ASSERT_TRUE(variadic ? buffers_type.size() < buffer_count : buffers_type.size() == buffer_count);
+        for (std::size_t i = 0; i < buffers_type.size(); ++i)
         {
             const auto buffer_type = buffers_type[i];
             auto buffer = array.buffers[i];
@@ -53,11 +54,25 @@ namespace sparrow
                 static_cast<size_t>(array.offset),
                 data_type,
                 buffers,
-                i == 0 ? buffer_type : buffers_type[i - 1]
+                i == 0 ? buffer_type : buffers_type[i - 1],
+                schema.format
             );
             auto* ptr = static_cast<uint8_t*>(const_cast<void*>(buffer));
             buffers.emplace_back(ptr, buffer_size);
         }
+        if (variadic)
+        {
+            // The last buffer holds the sizes of the data buffers preceding it.
+            const std::size_t sizes_index = buffer_count - 1;
+            const auto* sizes = static_cast<const std::int64_t*>(array.buffers[sizes_index]);
+            for (std::size_t i = buffers_type.size(); i < sizes_index; ++i)
+            {
+                auto* ptr = static_cast<uint8_t*>(const_cast<void*>(array.buffers[i]));
+                buffers.emplace_back(ptr, static_cast<std::size_t>(sizes[i - buffers_type.size()]));
+            }
+            auto* ptr = static_cast<uint8_t*>(const_cast<void*>(array.buffers[sizes_index]));
+            buffers.emplace_back(ptr, (sizes_index - buffers_type.size()) * sizeof(std::int64_t));
+        }
         return buffers;
     }
 
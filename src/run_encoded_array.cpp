@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
 #include "sparrow/layout/array_helper.hpp"
 #include "sparrow/layout/dispatch.hpp"
@@ -10,7 +14,10 @@ namespace sparrow
              mpl::is_type_instance_of_v<T, primitive_array> && (
              std::same_as<typename T::inner_value_type, std::uint16_t> ||
              std::same_as<typename T::inner_value_type, std::uint32_t> ||
-             std::same_as<typename T::inner_value_type, std::uint64_t>);
+             std::same_as<typename T::inner_value_type, std::uint64_t> ||
+             std::same_as<typename T::inner_value_type, std::int16_t> ||
+             std::same_as<typename T::inner_value_type, std::int32_t> ||
+             std::same_as<typename T::inner_value_type, std::int64_t>);
     
     auto run_end_encoded_array::get_acc_lengths_ptr(const array_wrapper& ar) -> acc_length_ptr_variant_type
     {
@@ -34,19 +41,129 @@ namespace sparrow
 
     auto run_end_encoded_array::operator[](std::uint64_t i) const -> array_traits::const_reference
     {
-        return visit(
-            [i, this](const auto& acc_lengths_ptr) -> array_traits::const_reference
+        return array_element(*p_encoded_values_array, find_run(i));
+    }
+
+    namespace
+    {
+        // Index of the first run in [first, last) ending after i, last if none.
+        template <class R>
+        std::size_t upper_bound_run(const R* run_ends, std::size_t first, std::size_t last, std::uint64_t i)
+        {
+            const auto it = std::upper_bound(
+                run_ends + first,
+                run_ends + last,
+                i,
+                [](std::uint64_t value, R run_end)
+                {
+                    return value < static_cast<std::uint64_t>(run_end);
+                }
+            );
+            return static_cast<std::size_t>(std::distance(run_ends, it));
+        }
+    }
+
+    auto run_end_encoded_array::find_run(std::uint64_t i) const -> size_type
+    {
+        const size_type count = run_count();
+        const std::vector<std::uint64_t>* samples = count >= skip_index_min_runs ? &get_skip_index() : nullptr;
+        return std::visit(
+            [&](const auto* run_ends) -> size_type
+            {
+                size_type first = 0;
+                size_type last = count;
+                if (samples != nullptr)
+                {
+                    // samples[k] is the end of the last run of block k, so the
+                    // run holding i is in the first block whose sample is > i.
+                    const auto block = static_cast<size_type>(std::distance(
+                        samples->begin(),
+                        std::upper_bound(samples->begin(), samples->end(), i)
+                    ));
+                    first = block * skip_index_stride;
+                    last = std::min(first + skip_index_stride, count);
+                }
+                return upper_bound_run(run_ends, first, last, i);
+            },
+            m_acc_lengths
+        );
+    }
+
+    auto run_end_encoded_array::find_run(std::uint64_t i, size_type hint) const -> size_type
+    {
+        const size_type count = run_count();
+        if (count == 0)
+        {
+            return 0;
+        }
+        hint = std::min(hint, count - 1);
+        return std::visit(
+            [&](const auto* run_ends) -> size_type
             {
-                const auto it = std::upper_bound(
-                    acc_lengths_ptr,
-                    acc_lengths_ptr + this->m_encoded_length,
-                    i
-                );
-                // std::lower_bound returns an iterator, so we need to convert it to an index
-                const auto index = static_cast<std::size_t>(std::distance(acc_lengths_ptr, it));
-                return array_element(*p_encoded_values_array, static_cast<std::size_t>(index));
+                const auto end_of = [run_ends](size_type r)
+                {
+                    return static_cast<std::uint64_t>(run_ends[r]);
+                };
+                if (i >= end_of(hint))
+                {
+                    // Gallop forward; invariant: the result is >= lo.
+                    size_type lo = hint + 1;
+                    size_type step = 1;
+                    while (lo + step - 1 < count && end_of(lo + step - 1) <= i)
+                    {
+                        lo += step;
+                        step *= 2;
+                    }
+                    return upper_bound_run(run_ends, lo, std::min(lo + step - 1, count), i);
+                }
+                if (hint > 0 && i < end_of(hint - 1))
+                {
+                    // Gallop backward; invariant: the result is <= hi.
+                    size_type hi = hint - 1;
+                    size_type step = 1;
+                    while (hi >= step && end_of(hi - step) > i)
+                    {
+                        hi -= step;
+                        step *= 2;
+                    }
+                    const size_type lo = hi >= step ? hi - step + 1 : 0;
+                    return upper_bound_run(run_ends, lo, hi, i);
+                }
+                return hint;
             },
             m_acc_lengths
         );
     }
+
+    auto run_end_encoded_array::get_skip_index() const -> const std::vector<std::uint64_t>&
+    {
+        std::call_once(
+            p_skip_index->built,
+            [this]()
+            {
+                std::vector<std::uint64_t>& samples = p_skip_index->samples;
+                const size_type count = run_count();
+                samples.reserve(count / skip_index_stride);
+                for (size_type r = skip_index_stride - 1; r < count; r += skip_index_stride)
+                {
+                    samples.push_back(get_run_end(r));
+                }
+            }
+        );
+        return p_skip_index->samples;
+    }
+
+    void run_end_encoded_array::update_run_hint(std::uint64_t i, detail::ree_run_hint& hint) const
+    {
+        if (i >= size())
+        {
+            hint.run = run_count();
+            hint.begin = size();
+            hint.end = size();
+            return;
+        }
+        hint.run = find_run(i, static_cast<size_type>(hint.run));
+        hint.begin = hint.run == 0 ? 0 : get_run_end(hint.run - 1);
+        hint.end = get_run_end(hint.run);
+    }
 }
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include "sparrow/layout/nested_value_types.hpp"
 #include "sparrow/layout/array_helper.hpp"
 
@@ -33,15 +35,28 @@ namespace sparrow
         return array_element(*(((*p_children)[i]).get()), m_index);
     }
 
+    auto struct_value::begin() const -> const_iterator
+    {
+        return cbegin();
+    }
+
+    auto struct_value::end() const -> const_iterator
+    {
+        return cend();
+    }
+
+    auto struct_value::cbegin() const -> const_iterator
+    {
+        return const_iterator(functor_type(this), 0u);
+    }
+
+    auto struct_value::cend() const -> const_iterator
+    {
+        return const_iterator(functor_type(this), size());
+    }
+
     bool operator==(const struct_value& lhs, const struct_value& rhs)
     {
-        bool res = lhs.size() == rhs.size();
-        for (std::size_t i = 0; res && i < lhs.size(); ++i)
-        {
-            res = lhs[i] == rhs[i];
-        }
-        return res;
-        // TODO: refactor with the following when struct_value is a range
-        // return std::ranges::equal(lhs, rhs);
+        return std::ranges::equal(lhs, rhs);
     }
 }
@@ -238,6 +238,56 @@ namespace sparrow
             CHECK_EQ(res, size);
         }
         TEST_CASE_TEMPLATE_APPLY(visit_id, testing_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("as", AR, as_id)
+        {
+            constexpr size_t size = 10;
+            using scalar_value_type = typename AR::inner_value_type;
+            array arr = test::make_array<scalar_value_type>(size);
+            auto pa = primitive_array<scalar_value_type>(test::make_arrow_proxy<scalar_value_type>(size));
+
+            SUBCASE("const")
+            {
+                const array& carr = arr;
+                const AR& typed = carr.as<AR>();
+                CHECK_EQ(typed, pa);
+                CHECK_THROWS_AS(carr.as<null_array>(), std::runtime_error);
+            }
+
+            SUBCASE("mutable")
+            {
+                AR& typed = arr.as<AR>();
+                CHECK_EQ(typed, pa);
+                CHECK_THROWS_AS(arr.as<null_array>(), std::runtime_error);
+            }
+        }
+        TEST_CASE_TEMPLATE_APPLY(as_id, testing_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("try_as", AR, try_as_id)
+        {
+            constexpr size_t size = 10;
+            using scalar_value_type = typename AR::inner_value_type;
+            array arr = test::make_array<scalar_value_type>(size);
+
+            SUBCASE("const")
+            {
+                const array& carr = arr;
+                const AR* typed = carr.try_as<AR>();
+                REQUIRE_NE(typed, nullptr);
+                CHECK_EQ(typed->size(), size);
+                CHECK_EQ(carr.try_as<null_array>(), nullptr);
+                CHECK_EQ(carr.try_as<primitive_array<bool>>(), nullptr);
+            }
+
+            SUBCASE("mutable")
+            {
+                AR* typed = arr.try_as<AR>();
+                REQUIRE_NE(typed, nullptr);
+                CHECK_EQ(typed->size(), size);
+                CHECK_EQ(arr.try_as<null_array>(), nullptr);
+            }
+        }
+        TEST_CASE_TEMPLATE_APPLY(try_as_id, testing_types);
     }
 }
 
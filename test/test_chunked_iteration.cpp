@@ -0,0 +1,179 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sparrow/layout/chunked_iteration.hpp"
+
+#include "../test/external_array_data_creation.hpp"
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        template <class T>
+        arrow_proxy make_proxy(std::size_t size, std::size_t offset, const std::vector<std::size_t>& false_bitmap)
+        {
+            ArrowSchema sc{};
+            ArrowArray ar{};
+            test::fill_schema_and_array<T>(sc, ar, size, offset, false_bitmap);
+            return arrow_proxy(std::move(ar), std::move(sc));
+        }
+
+        // Encodes [1, 1, 1, 2, 3, 3, ..., 3] where the last run has 2000 elements
+        arrow_proxy make_ree_proxy()
+        {
+            ArrowSchema acc_schema;
+            ArrowArray acc_array;
+            test::fill_schema_and_array<std::uint32_t>(acc_schema, acc_array, 3, 0, {});
+            auto* acc_ptr = reinterpret_cast<std::uint32_t*>(const_cast<void*>(acc_array.buffers[1]));
+            acc_ptr[0] = 3;
+            acc_ptr[1] = 4;
+            acc_ptr[2] = 2004;
+
+            ArrowSchema values_schema;
+            ArrowArray values_array;
+            test::fill_schema_and_array<std::int32_t>(values_schema, values_array, 3, 0, {});
+
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            test::fill_schema_and_array_for_run_end_encoded(
+                schema,
+                arr,
+                std::move(acc_schema),
+                std::move(acc_array),
+                std::move(values_schema),
+                std::move(values_array),
+                2004
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+    }
+
+    TEST_SUITE("chunked_iteration")
+    {
+        TEST_CASE("read_bitmap_word")
+        {
+            const std::uint8_t bits[] = {0xF0, 0x0F, 0xFF, 0x00, 0xAA, 0x55, 0x01, 0x80, 0x03};
+            CHECK_EQ(detail::read_bitmap_word(bits, 0, 8), 0xF0u);
+            CHECK_EQ(detail::read_bitmap_word(bits, 4, 8), 0xFFu);
+            CHECK_EQ(detail::read_bitmap_word(bits, 4, 3), 0x7u);
+            CHECK_EQ(detail::read_bitmap_word(bits, 0, 64), 0x800155AA00FF0FF0u);
+            CHECK_EQ(detail::read_bitmap_word(bits, 4, 64), 0x3800155AA00FF0FFu);
+        }
+
+        TEST_CASE("primitive_array")
+        {
+            constexpr std::size_t size = 2600;
+            constexpr std::size_t offset = 5;
+            const std::vector<std::size_t> false_bitmap = {6, 100, 1500, 1501, 2599};
+            primitive_array<std::int32_t> ar(make_proxy<std::int32_t>(size, offset, false_bitmap));
+            REQUIRE_EQ(ar.size(), size - offset);
+
+            std::vector<std::size_t> chunk_sizes;
+            std::vector<bool> all_valid;
+            std::size_t row_count = 0;
+            for_each_chunk(
+                ar,
+                [&](const primitive_chunk<std::int32_t>& chunk)
+                {
+                    CHECK_EQ(chunk.first, row_count);
+                    chunk_sizes.push_back(chunk.size);
+                    all_valid.push_back(chunk.validity.all_valid);
+                    for (std::size_t i = 0; i < chunk.size; ++i)
+                    {
+                        const auto elem = ar[chunk.first + i];
+                        CHECK_EQ(chunk.validity[i], elem.has_value());
+                        CHECK_EQ(chunk.values[i], elem.get());
+                    }
+                    for (std::size_t i = chunk.size; i < chunk_size; ++i)
+                    {
+                        CHECK_FALSE(chunk.validity[i]);
+                    }
+                    row_count += chunk.size;
+                }
+            );
+            CHECK_EQ(row_count, ar.size());
+            CHECK_EQ(chunk_sizes, std::vector<std::size_t>{1024, 1024, 547});
+            CHECK_EQ(all_valid, std::vector<bool>{false, false, false});
+        }
+
+        TEST_CASE("primitive_array all valid")
+        {
+            primitive_array<std::int32_t> ar(make_proxy<std::int32_t>(100, 0, {}));
+            std::size_t chunk_count = 0;
+            for_each_chunk(
+                ar,
+                [&](const primitive_chunk<std::int32_t>& chunk)
+                {
+                    ++chunk_count;
+                    CHECK(chunk.validity.all_valid);
+                    CHECK_EQ(chunk.validity.words[0], ~std::uint64_t(0));
+                    CHECK_EQ(chunk.validity.words[1], (std::uint64_t(1) << 36) - 1);
+                    CHECK_EQ(chunk.validity.words[2], 0u);
+                }
+            );
+            CHECK_EQ(chunk_count, 1);
+        }
+
+        TEST_CASE("variable_size_binary_array")
+        {
+            using layout_type = variable_size_binary_array<std::string, std::string_view>;
+            layout_type ar(make_proxy<std::string>(16, 3, {5, 12}));
+            std::size_t row_count = 0;
+            for_each_chunk(
+                ar,
+                [&](const auto& chunk)
+                {
+                    for (std::size_t i = 0; i < chunk.size; ++i)
+                    {
+                        const auto elem = ar[chunk.first + i];
+                        CHECK_EQ(chunk.validity[i], elem.has_value());
+                        CHECK_EQ(chunk.value(i), elem.get());
+                    }
+                    row_count += chunk.size;
+                }
+            );
+            CHECK_EQ(row_count, ar.size());
+        }
+
+        TEST_CASE("run_end_encoded_array")
+        {
+            run_end_encoded_array ar(make_ree_proxy());
+            std::size_t chunk_count = 0;
+            for_each_chunk(
+                ar,
+                [&](const auto& chunk)
+                {
+                    ++chunk_count;
+                    REQUIRE_EQ(chunk.size, 3);
+                    CHECK_EQ(chunk.first, 0);
+                    CHECK_EQ(chunk.first_row, 0);
+                    CHECK_EQ(chunk.run_begin(0), 0);
+                    CHECK_EQ(chunk.run_length(0), 3);
+                    CHECK_EQ(chunk.run_begin(1), 3);
+                    CHECK_EQ(chunk.run_length(1), 1);
+                    CHECK_EQ(chunk.run_begin(2), 4);
+                    CHECK_EQ(chunk.run_length(2), 2000);
+                    CHECK_EQ(chunk.values, &ar.encoded_values());
+                }
+            );
+            CHECK_EQ(chunk_count, 1);
+        }
+    }
+}
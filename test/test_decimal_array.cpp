@@ -0,0 +1,301 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/decimal_array.hpp"
+#include "sparrow/layout/decimal_kernels.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/utils/decimal.hpp"
+#include "sparrow/utils/wide_integer.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        decimal128_t d128(std::string_view str, std::int32_t scale)
+        {
+            return decimal128_t::from_string(str, scale);
+        }
+
+        // 1.25, null, -3.50, 100.00
+        decimal128_array make_array()
+        {
+            return decimal128_array(
+                u8_buffer<int128_t>(std::vector<int128_t>{125, 0, -350, 10000}),
+                10u,
+                2,
+                std::vector<std::size_t>{1}
+            );
+        }
+
+        std::vector<std::string> to_strings(const decimal128_array& ar)
+        {
+            const string_array strings = decimal_to_string(ar);
+            std::vector<std::string> res;
+            for (std::size_t i = 0; i < strings.size(); ++i)
+            {
+                res.push_back(strings[i].has_value() ? std::string(strings[i].value()) : std::string("null"));
+            }
+            return res;
+        }
+
+        std::vector<bool> to_bools(const validity_bitmap& bitmap)
+        {
+            std::vector<bool> res;
+            for (std::size_t i = 0; i < bitmap.size(); ++i)
+            {
+                res.push_back(bitmap.test(i));
+            }
+            return res;
+        }
+    }
+
+    TEST_SUITE("wide_integer")
+    {
+        TEST_CASE("arithmetic")
+        {
+            const int128_t a = std::numeric_limits<std::int64_t>::max();
+            const int128_t b = a * a;
+            CHECK_EQ(to_string(b), "85070591730234615847396907784232501249");
+            CHECK_EQ(to_string(-b), "-85070591730234615847396907784232501249");
+            CHECK_EQ(b - b, int128_t(0));
+            CHECK_EQ(int128_t(-5) + int128_t(3), int128_t(-2));
+            CHECK_LT(int128_t(-5), int128_t(3));
+            CHECK_GT(b, a);
+            CHECK_EQ(int256_t(int128_t(-7)), int256_t(-7));
+        }
+
+        TEST_CASE("overflow")
+        {
+            int128_t result;
+            CHECK(add_overflow(int128_t::max(), int128_t(1), result));
+            CHECK_EQ(result, int128_t::min());
+            CHECK_FALSE(sub_overflow(int128_t(0), int128_t::max(), result));
+            CHECK(sub_overflow(int128_t::min(), int128_t(1), result));
+            CHECK(mul_overflow(int128_t::max(), int128_t(2), result));
+            CHECK_FALSE(mul_overflow(int128_t(-3), int128_t(4), result));
+            CHECK_EQ(result, int128_t(-12));
+            CHECK_FALSE(pow10_overflow(38, result));
+            CHECK(pow10_overflow(39, result));
+            CHECK_EQ(max_decimal_digits<2>(), 38);
+            CHECK_EQ(max_decimal_digits<4>(), 76);
+        }
+    }
+
+    TEST_SUITE("decimal")
+    {
+        TEST_CASE("from_string and to_string")
+        {
+            CHECK_EQ(d128("12.5", 2).to_string(), "12.50");
+            CHECK_EQ(d128("-0.005", 2).to_string(), "-0.01");
+            CHECK_EQ(d128("0.004", 2).to_string(), "0.00");
+            CHECK_EQ(d128("+1.5e2", 0).to_string(), "150");
+            CHECK_EQ(d128("1234", -2).to_string(), "1200");
+            CHECK_EQ(d128("12345678901234567890.123456789", 9).value(), d128("12345678901234567890123456789", 0).value());
+            CHECK_THROWS_AS(std::ignore = d128("", 2), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = d128("1.2.3", 2), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = d128("1e", 2), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = d128("1e40", 0), std::overflow_error);
+        }
+
+        TEST_CASE("from_string limits")
+        {
+            const decimal128_t min128(int128_t::min(), 2);
+            CHECK_EQ(min128.to_string(), "-1701411834604692317316873037158841057.28");
+            CHECK_EQ(d128(min128.to_string(), 2).value(), int128_t::min());
+            CHECK_EQ(d128("-17014118346046923173168730371588410.5728e2", 2).value(), int128_t::min());
+            CHECK_THROWS_AS(std::ignore = d128("-1701411834604692317316873037158841057.29", 2), std::overflow_error);
+            CHECK_THROWS_AS(std::ignore = d128("1701411834604692317316873037158841057.28", 2), std::overflow_error);
+            CHECK_EQ(d128("1701411834604692317316873037158841057.27", 2).value(), int128_t::max());
+
+            const decimal256_t min256(int256_t::min(), 0);
+            CHECK_EQ(decimal256_t::from_string(min256.to_string(), 0).value(), int256_t::min());
+            const decimal256_t max256(int256_t::max(), 0);
+            CHECK_EQ(decimal256_t::from_string(max256.to_string(), 0).value(), int256_t::max());
+        }
+
+        TEST_CASE("rescale and compare")
+        {
+            const decimal128_t a = d128("1.25", 2);
+            CHECK_EQ(a.rescale(1).to_string(), "1.3");
+            CHECK_EQ(a.rescale(4).to_string(), "1.2500");
+            CHECK_EQ(a, a.rescale(5));
+            CHECK_LT(a, d128("1.3", 1));
+            CHECK_GT(d128("-1", 0), d128("-1.5", 1));
+            CHECK_THROWS_AS(std::ignore = a.rescale(40), std::overflow_error);
+        }
+
+        TEST_CASE("doubles")
+        {
+            CHECK_EQ(decimal128_t::from_double(1.25, 2).to_string(), "1.25");
+            CHECK_EQ(decimal128_t::from_double(-2.675, 2).to_string(), "-2.67");
+            CHECK_EQ(decimal128_t::from_double(0.5, 0).to_string(), "1");
+            CHECK_EQ(decimal128_t::from_double(1e20, 0).to_string(), "100000000000000000000");
+            // Binary values are converted exactly.
+            CHECK_EQ(decimal256_t::from_double(std::ldexp(1., 100), 0).to_string(), "1267650600228229401496703205376");
+            CHECK_EQ(decimal128_t::from_double(std::ldexp(1., -3), 3).to_string(), "0.125");
+            CHECK_EQ(static_cast<double>(d128("-3.5", 1)), -3.5);
+            CHECK_THROWS_AS(std::ignore = decimal128_t::from_double(1e40, 0), std::overflow_error);
+        }
+    }
+
+    TEST_SUITE("decimal_array")
+    {
+        TEST_CASE("constructor")
+        {
+            const decimal128_array ar = make_array();
+            REQUIRE_EQ(ar.size(), 4);
+            CHECK_EQ(ar.precision(), 10);
+            CHECK_EQ(ar.scale(), 2);
+            CHECK_EQ(ar.get_arrow_proxy().format(), "d:10,2");
+            CHECK_EQ(ar.get_arrow_proxy().data_type(), data_type::DECIMAL);
+            CHECK_EQ(ar[0].value(), d128("1.25", 2));
+            CHECK_FALSE(ar[1].has_value());
+            CHECK_EQ(ar[2].value().to_string(), "-3.50");
+
+            const decimal256_array wide(std::vector<decimal256_t>{decimal256_t(int256_t(15), 1)}, 40u, 3);
+            CHECK_EQ(wide.get_arrow_proxy().format(), "d:40,3,256");
+            CHECK_EQ(wide.get_arrow_proxy().data_type(), data_type::DECIMAL256);
+            CHECK_EQ(wide[0].value().to_string(), "1.500");
+
+            using values = std::vector<decimal128_t>;
+            CHECK_THROWS_AS(decimal128_array(values{d128("1000", 0)}, 3u, 0), std::overflow_error);
+        }
+
+        TEST_CASE("format")
+        {
+            CHECK_EQ(format_to_data_type("d:38,10"), data_type::DECIMAL);
+            CHECK_EQ(format_to_data_type("d:38,-2,128"), data_type::DECIMAL);
+            CHECK_EQ(format_to_data_type("d:76,10,256"), data_type::DECIMAL256);
+            CHECK_EQ(format_to_data_type("d:39,10"), data_type::NA);
+            CHECK_EQ(format_to_data_type("d:10,2,64"), data_type::NA);
+            CHECK_EQ(format_to_data_type("d:10"), data_type::NA);
+            CHECK_EQ(format_to_data_type("d:10,2,"), data_type::NA);
+            const auto format = parse_decimal_format("d:12,-3");
+            REQUIRE(format.has_value());
+            CHECK_EQ(format->precision, 12);
+            CHECK_EQ(format->scale, -3);
+            CHECK_EQ(format->bit_width, 128);
+        }
+
+        TEST_CASE("array and dispatch")
+        {
+            array generic(make_array());
+            CHECK_EQ(generic.size(), 4);
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            std::move(generic).extract_arrow_array(arr).extract_arrow_schema(schema);
+            const array roundtrip(std::move(arr), std::move(schema));
+            const decimal128_array& typed = roundtrip.as<decimal128_array>();
+            CHECK_EQ(typed.scale(), 2);
+            CHECK_EQ(typed[3].value().to_string(), "100.00");
+            CHECK_FALSE(typed[1].has_value());
+        }
+
+        TEST_CASE("add and subtract")
+        {
+            const decimal128_array lhs = make_array();
+            const decimal128_array rhs(
+                std::vector<decimal128_t>{d128("0.1", 1), d128("1", 1), d128("0.5", 1), d128("-0.1", 1)},
+                5u,
+                1
+            );
+            const decimal128_array sum = decimal_add(lhs, rhs);
+            CHECK_EQ(sum.scale(), 2);
+            CHECK_EQ(sum.precision(), 11);
+            CHECK_EQ(to_strings(sum), std::vector<std::string>{"1.35", "null", "-3.00", "99.90"});
+            const decimal128_array difference = decimal_subtract(lhs, rhs);
+            CHECK_EQ(to_strings(difference), std::vector<std::string>{"1.15", "null", "-4.00", "100.10"});
+
+            const decimal128_array big(std::vector<decimal128_t>{d128("9e37", 0)}, 38u, 0);
+            CHECK_THROWS_AS(std::ignore = decimal_add(big, big), std::overflow_error);
+            CHECK_THROWS_AS(std::ignore = decimal_add(lhs, big), std::invalid_argument);
+        }
+
+        TEST_CASE("multiply")
+        {
+            const decimal128_array lhs = make_array();
+            const decimal128_array rhs(
+                std::vector<decimal128_t>{d128("0.5", 1), d128("1", 1), d128("-0.3", 1), d128("0.1", 1)},
+                5u,
+                1
+            );
+            const decimal128_array product = decimal_multiply(lhs, rhs);
+            CHECK_EQ(product.scale(), 3);
+            CHECK_EQ(to_strings(product), std::vector<std::string>{"0.625", "null", "1.050", "10.000"});
+            const decimal128_array rounded = decimal_multiply(lhs, rhs, 2);
+            CHECK_EQ(to_strings(rounded), std::vector<std::string>{"0.63", "null", "1.05", "10.00"});
+        }
+
+        TEST_CASE("compare")
+        {
+            const decimal128_array ar = make_array();
+            const decimal128_array other(
+                std::vector<decimal128_t>{d128("1.25", 3), d128("0", 3), d128("0", 3), d128("100", 3)},
+                10u,
+                3
+            );
+            CHECK_EQ(to_bools(decimal_equal(ar, other)), std::vector<bool>{true, false, false, true});
+            CHECK_EQ(to_bools(decimal_less(ar, other)), std::vector<bool>{false, false, true, false});
+            CHECK_EQ(to_bools(decimal_equal(ar, d128("100", 0))), std::vector<bool>{false, false, false, true});
+            CHECK_EQ(to_bools(decimal_less(ar, d128("1.251", 3))), std::vector<bool>{true, false, true, false});
+            CHECK_EQ(to_bools(decimal_greater(ar, d128("0", 0))), std::vector<bool>{true, false, false, true});
+        }
+
+        TEST_CASE("sum")
+        {
+            CHECK_EQ(decimal_sum(make_array()).to_string(), "97.75");
+            const decimal128_array wraps(
+                u8_buffer<int128_t>(std::vector<int128_t>{int128_t::max(), int128_t(1), int128_t(-2)}),
+                38u,
+                0
+            );
+            // The intermediate sum wraps around, the final one does not.
+            CHECK_EQ(decimal_sum(wraps).value(), int128_t::max() - int128_t(1));
+            const decimal128_array overflows(
+                u8_buffer<int128_t>(std::vector<int128_t>{int128_t::max(), int128_t(1)}),
+                38u,
+                0
+            );
+            CHECK_THROWS_AS(std::ignore = decimal_sum(overflows), std::overflow_error);
+        }
+
+        TEST_CASE("conversions")
+        {
+            const primitive_array<double> doubles = decimal_to_double(make_array());
+            REQUIRE_EQ(doubles.size(), 4);
+            CHECK_EQ(doubles[0].value(), 1.25);
+            CHECK_FALSE(doubles[1].has_value());
+            CHECK_EQ(doubles[2].value(), -3.5);
+
+            const decimal128_array from_doubles = decimal_from_double<decimal128_t>(doubles, 6, 1);
+            CHECK_EQ(to_strings(from_doubles), std::vector<std::string>{"1.3", "null", "-3.5", "100.0"});
+            CHECK_THROWS_AS(std::ignore = decimal_from_double<decimal128_t>(doubles, 3, 1), std::overflow_error);
+
+            const string_array strings = decimal_to_string(make_array());
+            const decimal128_array from_strings = decimal_from_string<decimal128_t>(strings, 10, 2);
+            CHECK_EQ(to_strings(from_strings), to_strings(make_array()));
+        }
+    }
+}
@@ -0,0 +1,136 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/layout/dictionary_encode.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        string_array make_string_array()
+        {
+            string_array_builder builder;
+            builder.push_back("red");
+            builder.push_back("green");
+            builder.push_back(nullval);
+            builder.push_back("red");
+            builder.push_back("blue");
+            builder.push_back("green");
+            builder.push_back("red");
+            return builder.finish();
+        }
+    }
+
+    TEST_SUITE("dictionary_encode")
+    {
+        TEST_CASE("string array")
+        {
+            const string_array ar = make_string_array();
+            arrow_proxy proxy = dictionary_encode(ar);
+            CHECK_EQ(proxy.data_type(), data_type::INT8);
+            REQUIRE(proxy.dictionary());
+            CHECK_EQ(proxy.dictionary()->length(), 3);
+            CHECK_EQ(proxy.null_count(), 1);
+
+            const dictionary_encoded_array<std::int8_t> encoded(std::move(proxy));
+            REQUIRE_EQ(encoded.size(), ar.size());
+            const std::vector<std::int8_t> expected_keys{0, 1, 0, 0, 2, 1, 0};
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(encoded.keys()[i].has_value(), ar[i].has_value());
+                if (ar[i].has_value())
+                {
+                    CHECK_EQ(encoded.keys()[i].value(), expected_keys[i]);
+                    CHECK_EQ(std::get<nullable<std::string_view>>(encoded[i]).value(), ar[i].value());
+                }
+            }
+
+            const string_array decoded = decode<string_array>(encoded);
+            CHECK_EQ(decoded, ar);
+        }
+
+        TEST_CASE("primitive array")
+        {
+            const std::vector<nullable<double>> values{1.5, 2.5, nullable<double>(), 1.5, -0.0, 0.0, 2.5};
+            const primitive_array<double> ar(values);
+            const dictionary_encoded_array<std::int8_t> encoded(dictionary_encode(ar));
+            REQUIRE(encoded.dictionary_proxy().length() == 4);
+            CHECK_EQ(encoded.keys()[3].value(), 0);
+            CHECK_EQ(encoded.keys()[4].value(), 2);
+            CHECK_EQ(encoded.keys()[5].value(), 3);
+            CHECK_FALSE(encoded.keys()[2].has_value());
+
+            const primitive_array<double> decoded = decode<primitive_array<double>>(encoded);
+            CHECK_EQ(decoded, ar);
+        }
+
+        TEST_CASE("array offset")
+        {
+            arrow_proxy source = detail::array_access::extract_arrow_proxy(make_string_array());
+            source.set_offset(1);
+            source.set_length(6);
+            const string_array ar(std::move(source));
+            const dictionary_encoded_array<std::int8_t> encoded(dictionary_encode(ar));
+            CHECK_EQ(encoded.dictionary_proxy().length(), 3);
+            CHECK_EQ(decode<string_array>(encoded), ar);
+        }
+
+        TEST_CASE("index type")
+        {
+            std::vector<std::int32_t> values(300);
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = static_cast<std::int32_t>(i % 200) * 7;
+            }
+            const primitive_array<std::int32_t> ar(values);
+
+            arrow_proxy proxy = dictionary_encode(ar);
+            CHECK_EQ(proxy.data_type(), data_type::INT16);
+            const dictionary_encoded_array<std::int16_t> encoded(std::move(proxy));
+            CHECK_EQ(encoded.dictionary_proxy().length(), 200);
+            CHECK_EQ(decode<primitive_array<std::int32_t>>(encoded), ar);
+
+            arrow_proxy wide = dictionary_encode(ar, data_type::UINT32);
+            CHECK_EQ(wide.data_type(), data_type::UINT32);
+            const dictionary_encoded_array<std::uint32_t> wide_encoded(std::move(wide));
+            CHECK_EQ(decode<primitive_array<std::int32_t>>(wide_encoded), ar);
+
+            CHECK_THROWS_AS(dictionary_encode(ar, data_type::INT8), std::length_error);
+            CHECK_THROWS_AS(dictionary_encode(ar, data_type::FLOAT), std::invalid_argument);
+        }
+
+        TEST_CASE("empty array")
+        {
+            const primitive_array<std::int64_t> ar(std::vector<std::int64_t>{});
+            const dictionary_encoded_array<std::int8_t> encoded(dictionary_encode(ar));
+            CHECK_EQ(encoded.size(), 0);
+            CHECK_EQ(decode<primitive_array<std::int64_t>>(encoded).size(), 0);
+        }
+
+        TEST_CASE("array factory")
+        {
+            const string_array ar = make_string_array();
+            const cloning_ptr<array_wrapper> wrapper = array_factory(dictionary_encode(ar));
+            CHECK(wrapper->is_dictionary());
+            CHECK_EQ(wrapper->get_arrow_proxy().length(), ar.size());
+        }
+    }
+}
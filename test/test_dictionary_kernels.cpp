@@ -0,0 +1,137 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/arrow_interface/arrow_array_schema_factory.hpp"
+#include "sparrow/layout/dictionary_encode.hpp"
+#include "sparrow/layout/dictionary_kernels.hpp"
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        static const std::array<std::string, 7> words{{"hello", "you", "are", "not", "prepared", "!", "?"}};
+
+        // Elements: null, null, not, prepared, null, not, ?, you, null, not;
+        // elements 0 and 4 have null keys, 1 and 8 refer to a null value.
+        dictionary_encoded_array<std::uint32_t> make_dictionary_array()
+        {
+            constexpr std::array<size_t, 2> keys_nulls{1ULL, 5ULL};
+            const std::vector<std::uint32_t> keys{0, 0, 1, 2, 3, 4, 2, 5, 0, 1, 2};
+            constexpr std::array<size_t, 1> value_nulls{2ULL};
+
+            return dictionary_encoded_array<std::uint32_t>(arrow_proxy{
+                make_dictionary_encoded_arrow_array(keys, keys_nulls, 1, words, value_nulls, 1),
+                make_dictionary_encoded_arrow_schema(data_type::STRING, data_type::UINT32)
+            });
+        }
+
+        std::vector<std::size_t> set_bits(const validity_bitmap& bitmap)
+        {
+            std::vector<std::size_t> res;
+            for (std::size_t i = 0; i < bitmap.size(); ++i)
+            {
+                if (bitmap.test(i))
+                {
+                    res.push_back(i);
+                }
+            }
+            return res;
+        }
+    }
+
+    TEST_SUITE("dictionary_kernels")
+    {
+        TEST_CASE("dictionary_equal")
+        {
+            const auto ar = make_dictionary_array();
+            const validity_bitmap res = dictionary_equal<string_array>(ar, std::string_view("not"));
+            CHECK_EQ(res.size(), ar.size());
+            CHECK_EQ(set_bits(res), std::vector<std::size_t>{2, 5, 9});
+            // "are" is a null dictionary entry.
+            CHECK(set_bits(dictionary_equal<string_array>(ar, std::string_view("are"))).empty());
+        }
+
+        TEST_CASE("dictionary_is_in")
+        {
+            const auto ar = make_dictionary_array();
+            const std::vector<std::string_view> values{"you", "?", "hello"};
+            CHECK_EQ(set_bits(dictionary_is_in<string_array>(ar, values)), std::vector<std::size_t>{6, 7});
+
+            // Single pass range
+            std::istringstream stream("you ? hello");
+            CHECK_EQ(
+                set_bits(dictionary_is_in<string_array>(ar, std::views::istream<std::string>(stream))),
+                std::vector<std::size_t>{6, 7}
+            );
+        }
+
+        TEST_CASE("key out of range")
+        {
+            // The last key refers to an entry past the end of the dictionary.
+            const std::vector<std::uint32_t> keys{0, 1, 3, 7};
+            const dictionary_encoded_array<std::uint32_t> ar(arrow_proxy{
+                make_dictionary_encoded_arrow_array(keys, std::array<size_t, 0>{}, 0, words, std::array<size_t, 0>{}, 0),
+                make_dictionary_encoded_arrow_schema(data_type::STRING, data_type::UINT32)
+            });
+            CHECK_THROWS_AS(
+                std::ignore = dictionary_equal<string_array>(ar, std::string_view("hello")),
+                std::out_of_range
+            );
+        }
+
+        TEST_CASE("dictionary_match")
+        {
+            const auto ar = make_dictionary_array();
+            const auto res = dictionary_match<string_array>(
+                ar,
+                [](std::string_view value)
+                {
+                    return value.size() > 2;
+                }
+            );
+            CHECK_EQ(set_bits(res), std::vector<std::size_t>{2, 3, 5, 7, 9});
+        }
+
+        TEST_CASE("gather_matches")
+        {
+            const auto ar = make_dictionary_array();
+            const typed_dictionary_view<std::uint32_t, string_array> view(ar);
+            const validity_bitmap entry_matches = starts_with(view.dictionary(), "pre");
+            CHECK_EQ(set_bits(gather_matches(ar, entry_matches)), std::vector<std::size_t>{3});
+        }
+
+        TEST_CASE("primitive dictionary")
+        {
+            const std::vector<nullable<std::int32_t>> values{3, 5, nullable<std::int32_t>(), 3, 7, 5, 3};
+            const dictionary_encoded_array<std::int8_t> ar(dictionary_encode(primitive_array<std::int32_t>(values)));
+            CHECK_EQ(set_bits(dictionary_equal<primitive_array<std::int32_t>>(ar, 3)), std::vector<std::size_t>{0, 3, 6});
+            const std::vector<std::int32_t> in{5, 7, 11};
+            CHECK_EQ(
+                set_bits(dictionary_is_in<primitive_array<std::int32_t>>(ar, in)),
+                std::vector<std::size_t>{1, 4, 5}
+            );
+        }
+    }
+}
@@ -0,0 +1,157 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/layout/dictionary_unifier.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        string_array make_strings(const std::vector<std::string>& values)
+        {
+            string_array_builder builder;
+            for (const auto& v : values)
+            {
+                if (v.empty())
+                {
+                    builder.push_back(nullval);
+                }
+                else
+                {
+                    builder.push_back(v);
+                }
+            }
+            return builder.finish();
+        }
+
+        dictionary_encoded_array<std::int32_t> encode(const std::vector<std::string>& values)
+        {
+            return dictionary_encoded_array<std::int32_t>(
+                dictionary_encode(make_strings(values), data_type::INT32)
+            );
+        }
+    }
+
+    TEST_SUITE("dictionary_unifier")
+    {
+        using unifier_type = dictionary_unifier<std::int32_t, string_array>;
+
+        TEST_CASE("remap tables")
+        {
+            unifier_type unifier;
+            const auto batch1 = encode({"a", "b", "a", "c"});
+            const auto batch2 = encode({"d", "c", "", "a", "d"});
+
+            const auto remap1 = unifier.unify(batch1);
+            CHECK_EQ(remap1, std::vector<std::int32_t>{0, 1, 2});
+            CHECK_EQ(unifier.size(), 3);
+
+            const auto remap2 = unifier.unify(batch2);
+            // batch2 dictionary: d, c, a
+            CHECK_EQ(remap2, std::vector<std::int32_t>{3, 2, 0});
+            CHECK_EQ(unifier.size(), 4);
+
+            const string_array dictionary = unifier.dictionary();
+            REQUIRE_EQ(dictionary.size(), 4);
+            CHECK_EQ(dictionary[0].value(), "a");
+            CHECK_EQ(dictionary[3].value(), "d");
+
+            const primitive_array<std::int32_t> keys = unifier_type::transpose(batch2, remap2);
+            REQUIRE_EQ(keys.size(), 5);
+            CHECK_EQ(keys[0].value(), 3);
+            CHECK_EQ(keys[1].value(), 2);
+            CHECK_FALSE(keys[2].has_value());
+            CHECK_EQ(keys[3].value(), 0);
+            CHECK_EQ(keys[4].value(), 3);
+        }
+
+        TEST_CASE("unify_batch")
+        {
+            unifier_type unifier;
+            const auto batch1 = encode({"x", "y"});
+            const auto batch2 = encode({"z", "", "x"});
+            const dictionary_encoded_array<std::int32_t> out1(unifier.unify_batch(batch1));
+            const dictionary_encoded_array<std::int32_t> out2(unifier.unify_batch(batch2));
+
+            CHECK_EQ(decode<string_array>(out1), decode<string_array>(batch1));
+            CHECK_EQ(decode<string_array>(out2), decode<string_array>(batch2));
+            CHECK_EQ(out2.dictionary_proxy().length(), 3);
+
+            // The batches share the buffers of the master dictionary.
+            const auto batch3 = encode({"y", "z"});
+            const dictionary_encoded_array<std::int32_t> out3(unifier.unify_batch(batch3));
+            CHECK_EQ(decode<string_array>(out3), decode<string_array>(batch3));
+            CHECK_EQ(
+                out3.dictionary_proxy().buffers()[2].data(),
+                out2.dictionary_proxy().buffers()[2].data()
+            );
+
+            // Earlier batches stay valid when the master dictionary grows
+            // beyond the capacity of its buffers.
+            std::vector<std::string> values(100);
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = "value" + std::to_string(i);
+            }
+            const auto batch4 = encode(values);
+            const dictionary_encoded_array<std::int32_t> out4(unifier.unify_batch(batch4));
+            CHECK_EQ(unifier.size(), 103);
+            CHECK_EQ(decode<string_array>(out4), decode<string_array>(batch4));
+            CHECK_EQ(decode<string_array>(out1), decode<string_array>(batch1));
+            CHECK_EQ(decode<string_array>(out2), decode<string_array>(batch2));
+        }
+
+        TEST_CASE("null dictionary entries")
+        {
+            dictionary_unifier<std::int8_t, primitive_array<std::int64_t>> unifier;
+            const std::vector<nullable<std::int64_t>> values1{7, nullable<std::int64_t>(), 9};
+            const std::vector<nullable<std::int64_t>> values2{nullable<std::int64_t>(), 9, 11};
+            const auto remap1 = unifier.unify(primitive_array<std::int64_t>(values1));
+            const auto remap2 = unifier.unify(primitive_array<std::int64_t>(values2));
+            CHECK_EQ(remap1, std::vector<std::int8_t>{0, 1, 2});
+            CHECK_EQ(remap2, std::vector<std::int8_t>{1, 2, 3});
+
+            const auto dictionary = unifier.dictionary();
+            REQUIRE_EQ(dictionary.size(), 4);
+            CHECK_FALSE(dictionary[1].has_value());
+            CHECK_EQ(dictionary[3].value(), 11);
+        }
+
+        TEST_CASE("capacity")
+        {
+            dictionary_unifier<std::int8_t, primitive_array<std::int32_t>> unifier;
+            std::vector<std::int32_t> values(128);
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] = static_cast<std::int32_t>(i);
+            }
+            CHECK_NOTHROW(unifier.unify(primitive_array<std::int32_t>(values)));
+            CHECK_EQ(unifier.size(), 128);
+            // Values already in the dictionary can still be unified.
+            CHECK_NOTHROW(unifier.unify(primitive_array<std::int32_t>(std::vector<std::int32_t>{3, 4})));
+            CHECK_THROWS_AS(
+                unifier.unify(primitive_array<std::int32_t>(std::vector<std::int32_t>{1000})),
+                std::length_error
+            );
+            CHECK_EQ(unifier.size(), 128);
+        }
+    }
+}
@@ -71,5 +71,92 @@ namespace sparrow
         }
 
         TEST_CASE_TEMPLATE_APPLY(array_element_id, testing_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("kind", AR, kind_id)
+        {
+            using array_type = AR;
+            using wrapper_type = array_wrapper_impl<AR>;
+            array_type ar(make_arrow_proxy<typename AR::inner_value_type>());
+            wrapper_type w(&ar);
+            CHECK_EQ(w.kind(), get_array_kind(w.data_type(), false));
+            CHECK_NE(w.kind(), array_kind::UNSUPPORTED);
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(kind_id, testing_types);
+
+        TEST_CASE("get_array_kind")
+        {
+            CHECK_EQ(get_array_kind(data_type::INT32, false), array_kind::INT32);
+            CHECK_EQ(get_array_kind(data_type::INT32, true), array_kind::DICTIONARY_INT32);
+            CHECK_EQ(get_array_kind(data_type::STRING, false), array_kind::STRING);
+            CHECK_EQ(get_array_kind(data_type::STRING, true), array_kind::UNSUPPORTED);
+            CHECK_EQ(get_array_kind(data_type::MAP, false), array_kind::MAP);
+            CHECK_EQ(get_array_kind(data_type::DECIMAL, false), array_kind::DECIMAL);
+            CHECK_EQ(get_array_kind(data_type::DECIMAL256, false), array_kind::DECIMAL256);
+            CHECK_EQ(get_array_kind(data_type::FIXED_WIDTH_BINARY, false), array_kind::FIXED_WIDTH_BINARY);
+            CHECK_EQ(get_array_kind(data_type::BINARY, false), array_kind::BINARY);
+            CHECK_EQ(get_array_kind(data_type::LARGE_BINARY, false), array_kind::LARGE_BINARY);
+            CHECK_EQ(get_array_kind(data_type::BINARY_VIEW, false), array_kind::BINARY_VIEW);
+        }
+
+        TEST_CASE_TEMPLATE_DEFINE("visit", AR, visit_id)
+        {
+            using array_type = AR;
+            using wrapper_type = array_wrapper_impl<AR>;
+            array_type ar(make_arrow_proxy<typename AR::inner_value_type>());
+            wrapper_type w(&ar);
+            const bool same_type = visit(
+                [](const auto& typed_ar)
+                {
+                    return std::same_as<std::decay_t<decltype(typed_ar)>, array_type>;
+                },
+                w
+            );
+            CHECK(same_type);
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(visit_id, testing_types);
+
+        TEST_CASE_TEMPLATE_DEFINE("visit_batches", AR, visit_batches_id)
+        {
+            using array_type = AR;
+            using wrapper_type = array_wrapper_impl<AR>;
+            array_type ar(make_arrow_proxy<typename AR::inner_value_type>());
+            wrapper_type w(&ar);
+
+            std::size_t batch_count = 0;
+            std::size_t element_count = 0;
+            std::size_t valid_count = 0;
+            visit_batches(
+                [&](const auto& range)
+                {
+                    ++batch_count;
+                    for (const auto& elem : range)
+                    {
+                        ++element_count;
+                        if (elem.has_value())
+                        {
+                            ++valid_count;
+                        }
+                    }
+                },
+                w,
+                3
+            );
+
+            std::size_t expected_valid_count = 0;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                if (ar[i].has_value())
+                {
+                    ++expected_valid_count;
+                }
+            }
+            CHECK_EQ(batch_count, (ar.size() + 2) / 3);
+            CHECK_EQ(element_count, ar.size());
+            CHECK_EQ(valid_count, expected_valid_count);
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(visit_batches_id, testing_types);
     }
 }
@@ -0,0 +1,203 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/fixed_size_binary_array.hpp"
+#include "sparrow/layout/fixed_size_binary_kernels.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // N bytes, all equal to fill except the last one, equal to last.
+        template <std::size_t N>
+        std::array<byte_t, N> make_value(std::uint8_t fill, std::uint8_t last)
+        {
+            std::array<byte_t, N> res;
+            res.fill(byte_t{fill});
+            res.back() = byte_t{last};
+            return res;
+        }
+
+        // {1, ..., 1}, null, {1, ..., 2}, {0, ..., 9}
+        template <std::size_t N>
+        fixed_size_binary_array make_array()
+        {
+            return fixed_size_binary_array(
+                std::vector<std::array<byte_t, N>>{
+                    make_value<N>(1, 1),
+                    make_value<N>(1, 1),
+                    make_value<N>(1, 2),
+                    make_value<N>(0, 9)
+                },
+                std::vector<std::size_t>{1}
+            );
+        }
+
+        std::vector<bool> to_bools(const validity_bitmap& bitmap)
+        {
+            std::vector<bool> res;
+            for (std::size_t i = 0; i < bitmap.size(); ++i)
+            {
+                res.push_back(bitmap.test(i));
+            }
+            return res;
+        }
+    }
+
+    TEST_SUITE("fixed_size_binary_array")
+    {
+        TEST_CASE("format")
+        {
+            CHECK_EQ(format_to_data_type("w:16"), data_type::FIXED_WIDTH_BINARY);
+            CHECK_EQ(parse_fixed_width_binary_format("w:32"), 32);
+            CHECK_EQ(format_to_data_type("w:"), data_type::NA);
+            CHECK_EQ(format_to_data_type("w:0"), data_type::FIXED_WIDTH_BINARY);
+            CHECK_EQ(parse_fixed_width_binary_format("w:0"), 0);
+            CHECK_EQ(format_to_data_type("w:1a"), data_type::NA);
+        }
+
+        TEST_CASE("constructor")
+        {
+            const fixed_size_binary_array ar = make_array<16>();
+            REQUIRE_EQ(ar.size(), 4);
+            CHECK_EQ(ar.width(), 16);
+            CHECK_EQ(ar.get_arrow_proxy().format(), "w:16");
+            CHECK_EQ(ar.get_arrow_proxy().buffers()[1].size(), 4 * 16);
+            CHECK_FALSE(ar[1].has_value());
+            const auto expected = make_value<16>(1, 2);
+            CHECK(std::ranges::equal(ar[2].value(), expected));
+
+            const std::span<const byte_t, 16> typed = ar.value_as<16>(3);
+            CHECK_EQ(typed[15], byte_t{9});
+            CHECK_EQ(typed[0], byte_t{0});
+
+            const std::vector<byte_t> bytes{byte_t{1}, byte_t{2}, byte_t{3}, byte_t{4}, byte_t{5}, byte_t{6}};
+            const fixed_size_binary_array raw(u8_buffer<byte_t>(bytes), 3u);
+            CHECK_EQ(raw.size(), 2);
+            CHECK_EQ(raw.get_arrow_proxy().format(), "w:3");
+            CHECK_EQ(raw[1].value()[0], byte_t{4});
+        }
+
+        TEST_CASE("invalid values")
+        {
+            using values_type = std::vector<std::vector<byte_t>>;
+            CHECK_THROWS_AS(std::ignore = fixed_size_binary_array(values_type{}), std::invalid_argument);
+            CHECK_THROWS_AS(
+                std::ignore = fixed_size_binary_array(values_type{{byte_t{1}}, {byte_t{1}, byte_t{2}}}),
+                std::invalid_argument
+            );
+
+            // The width of std::array values is known even without values.
+            const fixed_size_binary_array empty(std::vector<std::array<byte_t, 32>>{});
+            CHECK_EQ(empty.size(), 0);
+            CHECK_EQ(empty.width(), 32);
+        }
+
+        TEST_CASE("zero width")
+        {
+            const fixed_size_binary_array ar(std::vector<std::vector<byte_t>>(3), std::vector<std::size_t>{1});
+            REQUIRE_EQ(ar.size(), 3);
+            CHECK_EQ(ar.width(), 0);
+            CHECK_EQ(ar.get_arrow_proxy().format(), "w:0");
+            CHECK(ar[0].value().empty());
+            CHECK_FALSE(ar[1].has_value());
+
+            const fixed_size_binary_array typed(std::vector<std::array<byte_t, 0>>(2));
+            CHECK_EQ(typed.size(), 2);
+            CHECK_EQ(typed.width(), 0);
+
+            // Copies go through the buffer sizes computed from the format.
+            const fixed_size_binary_array copy(ar);
+            CHECK_EQ(copy.size(), 3);
+            CHECK_EQ(copy.width(), 0);
+
+            CHECK_EQ(to_bools(fixed_size_binary_equal(ar, ar)), std::vector<bool>{true, false, true});
+            CHECK_EQ(to_bools(fixed_size_binary_less(ar, ar)), std::vector<bool>{false, false, false});
+            const std::array<byte_t, 0> empty{};
+            CHECK_EQ(to_bools(fixed_size_binary_equal(ar, empty)), std::vector<bool>{true, false, true});
+            const primitive_array<std::uint64_t> hashes = fixed_size_binary_hash(ar);
+            CHECK_EQ(hashes[0].value(), hashes[2].value());
+        }
+
+        TEST_CASE("array and dispatch")
+        {
+            array generic(make_array<32>());
+            CHECK_EQ(generic.size(), 4);
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            std::move(generic).extract_arrow_array(arr).extract_arrow_schema(schema);
+            const array roundtrip(std::move(arr), std::move(schema));
+            const auto& typed = roundtrip.as<fixed_size_binary_array>();
+            CHECK_EQ(typed.width(), 32);
+            CHECK_EQ(typed.value_as<32>(2)[31], byte_t{2});
+            CHECK_FALSE(typed[1].has_value());
+        }
+
+        TEST_CASE_TEMPLATE("compare", W, std::integral_constant<std::size_t, 16>, std::integral_constant<std::size_t, 32>, std::integral_constant<std::size_t, 5>)
+        {
+            constexpr std::size_t N = W::value;
+            const fixed_size_binary_array lhs = make_array<N>();
+            const fixed_size_binary_array rhs(
+                std::vector<std::array<byte_t, N>>{
+                    make_value<N>(1, 1),
+                    make_value<N>(1, 1),
+                    make_value<N>(1, 1),
+                    make_value<N>(0, 9)
+                }
+            );
+            CHECK_EQ(to_bools(fixed_size_binary_equal(lhs, rhs)), std::vector<bool>{true, false, false, true});
+            CHECK_EQ(to_bools(fixed_size_binary_less(rhs, lhs)), std::vector<bool>{false, false, true, false});
+
+            const auto value = make_value<N>(1, 1);
+            CHECK_EQ(to_bools(fixed_size_binary_equal(lhs, value)), std::vector<bool>{true, false, false, false});
+            CHECK_EQ(to_bools(fixed_size_binary_less(lhs, value)), std::vector<bool>{false, false, false, true});
+
+            const fixed_size_binary_array other_width(std::vector<std::array<byte_t, N + 1>>(4));
+            CHECK_THROWS_AS(std::ignore = fixed_size_binary_equal(lhs, other_width), std::invalid_argument);
+            const std::array<byte_t, N + 1> other_value{};
+            CHECK_THROWS_AS(std::ignore = fixed_size_binary_less(lhs, other_value), std::invalid_argument);
+        }
+
+        TEST_CASE_TEMPLATE("hash", W, std::integral_constant<std::size_t, 16>, std::integral_constant<std::size_t, 32>, std::integral_constant<std::size_t, 5>)
+        {
+            constexpr std::size_t N = W::value;
+            const fixed_size_binary_array ar(
+                std::vector<std::array<byte_t, N>>{make_value<N>(1, 1), make_value<N>(1, 2), make_value<N>(1, 1), make_value<N>(1, 1)},
+                std::vector<std::size_t>{3}
+            );
+            const primitive_array<std::uint64_t> hashes = fixed_size_binary_hash(ar);
+            REQUIRE_EQ(hashes.size(), 4);
+            CHECK_EQ(hashes[0].value(), hashes[2].value());
+            CHECK_NE(hashes[0].value(), hashes[1].value());
+            CHECK_FALSE(hashes[3].has_value());
+
+            const primitive_array<std::uint64_t> seeded = fixed_size_binary_hash(ar, 42);
+            CHECK_NE(seeded[0].value(), hashes[0].value());
+            CHECK_EQ(seeded[0].value(), seeded[2].value());
+        }
+    }
+}
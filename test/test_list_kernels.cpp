@@ -0,0 +1,275 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/layout/list_layout/list_kernels.hpp"
+
+#include "../test/external_array_data_creation.hpp"
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        template <class T>
+        arrow_proxy make_list_proxy(
+            std::size_t n_flat,
+            const std::vector<std::size_t>& sizes,
+            const std::vector<std::size_t>& nulls,
+            const std::vector<std::size_t>& flat_nulls = {}
+        )
+        {
+            ArrowArray flat_arr{};
+            ArrowSchema flat_schema{};
+            test::fill_schema_and_array<T>(flat_schema, flat_arr, n_flat, 0, flat_nulls);
+
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            test::fill_schema_and_array_for_list_layout(
+                schema,
+                arr,
+                std::move(flat_schema),
+                std::move(flat_arr),
+                sizes,
+                nulls,
+                false
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+
+        // List view array over [0, n_flat) with arbitrary offsets and sizes.
+        arrow_proxy make_list_view_proxy(
+            std::size_t n_flat,
+            const std::vector<std::uint32_t>& offsets,
+            const std::vector<std::uint32_t>& sizes,
+            const std::vector<std::size_t>& nulls
+        )
+        {
+            ArrowArray flat_arr{};
+            ArrowSchema flat_schema{};
+            test::fill_schema_and_array<std::int32_t>(flat_schema, flat_arr, n_flat, 0, {});
+
+            buffer<std::uint8_t> offset_buffer(offsets.size() * sizeof(std::uint32_t));
+            std::ranges::copy(offsets, offset_buffer.data<std::uint32_t>());
+            buffer<std::uint8_t> size_buffer(sizes.size() * sizeof(std::uint32_t));
+            std::ranges::copy(sizes, size_buffer.data<std::uint32_t>());
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(make_bitmap_buffer(offsets.size(), nulls));
+            buffers.push_back(std::move(offset_buffer));
+            buffers.push_back(std::move(size_buffer));
+
+            ArrowSchema schema = make_arrow_schema(
+                std::string("+vl"),
+                std::nullopt,
+                std::nullopt,
+                std::nullopt,
+                1,
+                new ArrowSchema*[1]{new ArrowSchema(std::move(flat_schema))},
+                nullptr
+            );
+            ArrowArray arr = make_arrow_array(
+                static_cast<std::int64_t>(offsets.size()),
+                static_cast<std::int64_t>(nulls.size()),
+                0,
+                std::move(buffers),
+                1,
+                new ArrowArray*[1]{new ArrowArray(std::move(flat_arr))},
+                nullptr
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+
+        template <class T>
+        std::vector<std::optional<T>> values_of(const array& ar)
+        {
+            const typed_view<T> view(ar);
+            std::vector<std::optional<T>> res;
+            for (std::size_t i = 0; i < view.size(); ++i)
+            {
+                res.push_back(view.has_value(i) ? std::optional<T>(view.value(i)) : std::nullopt);
+            }
+            return res;
+        }
+
+        template <class D>
+        std::vector<std::size_t> sizes_of(const list_array_crtp_base<D>& ar)
+        {
+            std::vector<std::size_t> res;
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const auto [first, last] = ar.value_range(i);
+                res.push_back(last - first);
+            }
+            return res;
+        }
+
+        using opt = std::optional<std::int32_t>;
+    }
+
+    TEST_SUITE("list_kernels")
+    {
+        TEST_CASE("list_value_lengths")
+        {
+            const list_array ar(make_list_proxy<std::int32_t>(6, {1, 2, 0, 3}, {1}));
+            const auto lengths = list_value_lengths(ar);
+            REQUIRE_EQ(lengths.size(), 4);
+            CHECK_EQ(lengths[0].value(), 1u);
+            CHECK_FALSE(lengths[1].has_value());
+            CHECK_EQ(lengths[2].value(), 0u);
+            CHECK_EQ(lengths[3].value(), 3u);
+        }
+
+        TEST_CASE("flatten")
+        {
+            SUBCASE("list")
+            {
+                const list_array ar(make_list_proxy<std::int32_t>(6, {1, 2, 0, 3}, {1}, {4}));
+                const array flat = flatten(ar);
+                CHECK_EQ(values_of<std::int32_t>(flat), std::vector<opt>{0, 3, std::nullopt, 5});
+                CHECK_EQ(parent_indices(ar), std::vector<std::size_t>{0, 3, 3, 3});
+            }
+
+            SUBCASE("offset")
+            {
+                arrow_proxy proxy = make_list_proxy<std::int32_t>(6, {1, 2, 0, 3}, {1});
+                proxy.set_offset(1);
+                proxy.set_length(3);
+                const list_array ar(std::move(proxy));
+                CHECK_EQ(sizes_of(ar), std::vector<std::size_t>{2, 0, 3});
+                CHECK_FALSE(ar[0].has_value());
+                CHECK_EQ(values_of<std::int32_t>(flatten(ar)), std::vector<opt>{3, 4, 5});
+                CHECK_EQ(parent_indices(ar), std::vector<std::size_t>{2, 2, 2});
+            }
+
+            SUBCASE("strings")
+            {
+                const list_array ar(make_list_proxy<std::string>(5, {2, 1, 2}, {1}));
+                const array flat = flatten(ar);
+                const auto& strings = flat.as<string_array>();
+                REQUIRE_EQ(strings.size(), 4);
+                const std::vector<std::string> words = test::make_testing_words(5);
+                CHECK_EQ(std::string_view(strings[0].value()), words[0]);
+                CHECK_EQ(std::string_view(strings[1].value()), words[1]);
+                CHECK_EQ(std::string_view(strings[2].value()), words[3]);
+                CHECK_EQ(std::string_view(strings[3].value()), words[4]);
+            }
+
+            SUBCASE("fixed sized list")
+            {
+                ArrowArray flat_arr{};
+                ArrowSchema flat_schema{};
+                test::fill_schema_and_array<std::int32_t>(flat_schema, flat_arr, 6, 0, {});
+                ArrowArray arr{};
+                ArrowSchema schema{};
+                test::fill_schema_and_array_for_fixed_size_list_layout(
+                    schema,
+                    arr,
+                    std::move(flat_schema),
+                    std::move(flat_arr),
+                    {1},
+                    2
+                );
+                const fixed_sized_list_array ar(arrow_proxy(std::move(arr), std::move(schema)));
+                CHECK_EQ(values_of<std::int32_t>(flatten(ar)), std::vector<opt>{0, 1, 4, 5});
+                CHECK_EQ(parent_indices(ar), std::vector<std::size_t>{0, 0, 2, 2});
+                const auto lengths = list_value_lengths(ar);
+                CHECK_EQ(lengths[0].value(), 2u);
+                CHECK_FALSE(lengths[1].has_value());
+
+                const list_array converted = fixed_sized_list_to_list(ar);
+                CHECK_EQ(converted.size(), 3);
+                CHECK_EQ(sizes_of(converted), std::vector<std::size_t>{2, 2, 2});
+                CHECK_FALSE(converted[1].has_value());
+                CHECK_EQ(values_of<std::int32_t>(flatten(converted)), std::vector<opt>{0, 1, 4, 5});
+
+                const big_list_array big_converted = fixed_sized_list_to_list<true>(ar);
+                CHECK_EQ(sizes_of(big_converted), std::vector<std::size_t>{2, 2, 2});
+
+                std::optional<list_array> owning;
+                {
+                    fixed_sized_list_array source(ar);
+                    owning.emplace(fixed_sized_list_to_list(std::move(source)));
+                }
+                CHECK_EQ(sizes_of(*owning), std::vector<std::size_t>{2, 2, 2});
+                CHECK_EQ(values_of<std::int32_t>(flatten(*owning)), std::vector<opt>{0, 1, 4, 5});
+            }
+        }
+
+        TEST_CASE("list_to_list_view")
+        {
+            const list_array ar(make_list_proxy<std::int32_t>(6, {1, 2, 0, 3}, {2}));
+            const list_view_array view = list_to_list_view(ar);
+            REQUIRE_EQ(view.size(), ar.size());
+            CHECK_EQ(sizes_of(view), sizes_of(ar));
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(view.value_range(i), ar.value_range(i));
+                CHECK_EQ(view[i].has_value(), ar[i].has_value());
+            }
+            CHECK(view[3].value() == ar[3].value());
+
+            SUBCASE("copy")
+            {
+                const list_view_array copy(view);
+                CHECK_EQ(sizes_of(copy), sizes_of(ar));
+                CHECK(copy[1].value() == ar[1].value());
+            }
+
+            SUBCASE("offset")
+            {
+                arrow_proxy proxy = make_list_proxy<std::int32_t>(6, {1, 2, 0, 3}, {2});
+                proxy.set_offset(1);
+                proxy.set_length(3);
+                const list_array sliced(std::move(proxy));
+                const list_view_array sliced_view = list_to_list_view(sliced);
+                CHECK_EQ(sizes_of(sliced_view), std::vector<std::size_t>{2, 0, 3});
+                CHECK_FALSE(sliced_view[1].has_value());
+            }
+
+            SUBCASE("source destroyed")
+            {
+                std::optional<list_view_array> moved_view;
+                {
+                    list_array source(make_list_proxy<std::int32_t>(6, {1, 2, 0, 3}, {2}));
+                    moved_view.emplace(list_to_list_view(std::move(source)));
+                }
+                CHECK_EQ(sizes_of(*moved_view), sizes_of(ar));
+                CHECK((*moved_view)[3].value() == ar[3].value());
+            }
+        }
+
+        TEST_CASE("list_view_to_list")
+        {
+            // Overlapping and out of order lists.
+            const list_view_array ar(make_list_view_proxy(5, {2, 0, 4, 1}, {3, 2, 1, 2}, {2}));
+            const list_array compacted = list_view_to_list(ar);
+            REQUIRE_EQ(compacted.size(), 4);
+            CHECK_EQ(sizes_of(compacted), std::vector<std::size_t>{3, 2, 0, 2});
+            CHECK_FALSE(compacted[2].has_value());
+            CHECK_EQ(values_of<std::int32_t>(flatten(compacted)), std::vector<opt>{2, 3, 4, 0, 1, 1, 2});
+            CHECK_EQ(values_of<std::int32_t>(flatten(ar)), std::vector<opt>{2, 3, 4, 0, 1, 1, 2});
+            CHECK_EQ(parent_indices(ar), std::vector<std::size_t>{0, 0, 0, 1, 1, 3, 3});
+
+            const list_array round_trip = list_view_to_list(list_to_list_view(compacted));
+            CHECK_EQ(sizes_of(round_trip), sizes_of(compacted));
+            CHECK_EQ(values_of<std::int32_t>(flatten(round_trip)), values_of<std::int32_t>(flatten(compacted)));
+        }
+    }
+}
@@ -0,0 +1,237 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/dictionary_encode.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/map_layout/map_array.hpp"
+#include "sparrow/layout/map_layout/map_kernels.hpp"
+#include "sparrow/layout/typed_view.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        string_array make_keys()
+        {
+            string_array_builder builder;
+            for (const char* key : {"a", "b", "b", "c", "a", "c"})
+            {
+                builder.push_back(key);
+            }
+            return builder.finish();
+        }
+
+        primitive_array<std::int32_t> make_items()
+        {
+            return primitive_array<std::int32_t>(
+                std::vector<std::int32_t>{1, 2, 3, 4, 5, 6},
+                std::vector<std::size_t>{5}
+            );
+        }
+
+        u8_buffer<std::uint32_t> make_offsets()
+        {
+            return u8_buffer<std::uint32_t>(std::vector<std::uint32_t>{0, 2, 2, 5, 6});
+        }
+
+        // Maps: {a: 1, b: 2}, null, {b: 3, c: 4, a: 5}, {c: null}.
+        map_array make_map_array()
+        {
+            return map_array(array(make_keys()), array(make_items()), make_offsets(), std::vector<std::size_t>{1});
+        }
+
+        std::vector<nullable<std::int32_t>> to_vector(const array& ar)
+        {
+            const typed_view<std::int32_t> view(ar);
+            std::vector<nullable<std::int32_t>> res;
+            for (std::size_t i = 0; i < view.size(); ++i)
+            {
+                res.push_back(view.has_value(i) ? nullable<std::int32_t>(view.value(i)) : nullable<std::int32_t>(nullval));
+            }
+            return res;
+        }
+    }
+
+    TEST_SUITE("map_array")
+    {
+        TEST_CASE("constructor")
+        {
+            const map_array ar = make_map_array();
+            REQUIRE_EQ(ar.size(), 4);
+            CHECK(ar[0].has_value());
+            CHECK_FALSE(ar[1].has_value());
+            CHECK_EQ(ar[0].value().size(), 2);
+            CHECK_EQ(ar[2].value().size(), 3);
+            CHECK_EQ(ar[3].value().size(), 1);
+            CHECK_EQ(ar.get_arrow_proxy().data_type(), data_type::MAP);
+            CHECK_EQ(ar.get_arrow_proxy().format(), "+m");
+
+            const struct_array& entries = ar.entries();
+            CHECK_EQ(entries.size(), 6);
+            CHECK_EQ(ar.raw_flat_array()->get_arrow_proxy().name(), "entries");
+            REQUIRE_EQ(entries.children_count(), 2);
+            CHECK_EQ(ar.raw_keys()->get_arrow_proxy().name(), "key");
+            CHECK_EQ(ar.raw_items()->get_arrow_proxy().name(), "value");
+            CHECK_EQ(ar.raw_keys()->get_arrow_proxy().data_type(), data_type::STRING);
+            CHECK_EQ(ar.raw_items()->get_arrow_proxy().data_type(), data_type::INT32);
+        }
+
+        TEST_CASE("copy and move")
+        {
+            const map_array ar = make_map_array();
+            map_array copy(ar);
+            CHECK_EQ(copy.size(), ar.size());
+            CHECK_EQ(copy[2].value().size(), 3);
+
+            map_array moved(std::move(copy));
+            CHECK_EQ(moved[2].value().size(), 3);
+        }
+
+        TEST_CASE("array and dispatch")
+        {
+            array generic(make_map_array());
+            CHECK_EQ(generic.size(), 4);
+            CHECK(generic.try_as<map_array>() != nullptr);
+
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            std::move(generic).extract_arrow_array(arr).extract_arrow_schema(schema);
+            const array roundtrip(std::move(arr), std::move(schema));
+            REQUIRE_EQ(roundtrip.size(), 4);
+            const map_array& typed = roundtrip.as<map_array>();
+            CHECK_FALSE(typed[1].has_value());
+            CHECK_EQ(typed[2].value().size(), 3);
+
+            const auto wrapper = array_factory(typed.get_arrow_proxy().view());
+            CHECK_EQ(wrapper->get_arrow_proxy().data_type(), data_type::MAP);
+            const std::size_t size = visit(
+                [](const auto& layout)
+                {
+                    return layout.size();
+                },
+                *wrapper
+            );
+            CHECK_EQ(size, 4);
+        }
+
+        TEST_CASE("map_lookup")
+        {
+            const map_array ar = make_map_array();
+
+            SUBCASE("string keys")
+            {
+                const std::vector<nullable<std::int32_t>> a = {1, nullval, 5, nullval};
+                CHECK_EQ(to_vector(map_lookup(ar, "a")), a);
+                const std::vector<nullable<std::int32_t>> b = {2, nullval, 3, nullval};
+                CHECK_EQ(to_vector(map_lookup(ar, std::string("b"))), b);
+                // The value of c in the last map is null.
+                const std::vector<nullable<std::int32_t>> c = {nullval, nullval, 4, nullval};
+                CHECK_EQ(to_vector(map_lookup(ar, "c")), c);
+                const std::vector<nullable<std::int32_t>> missing(4, nullval);
+                CHECK_EQ(to_vector(map_lookup(ar, "z")), missing);
+            }
+
+            SUBCASE("dictionary encoded keys")
+            {
+                arrow_proxy keys = dictionary_encode(make_keys());
+                const map_array encoded(
+                    array(keys.extract_array(), keys.extract_schema()),
+                    array(make_items()),
+                    make_offsets(),
+                    std::vector<std::size_t>{1}
+                );
+                const std::vector<nullable<std::int32_t>> b = {2, nullval, 3, nullval};
+                CHECK_EQ(to_vector(map_lookup(encoded, "b")), b);
+                const std::vector<nullable<std::int32_t>> missing(4, nullval);
+                CHECK_EQ(to_vector(map_lookup(encoded, "z")), missing);
+                CHECK_THROWS_AS(std::ignore = map_lookup(encoded, 1), std::invalid_argument);
+            }
+
+            SUBCASE("integer keys and string values")
+            {
+                string_array_builder builder;
+                builder.push_back("x");
+                builder.push_back("y");
+                builder.push_back("z");
+                // Maps: {1: x, 2: y}, {1: z}.
+                const map_array numbers(
+                    array(primitive_array<std::int64_t>(std::vector<std::int64_t>{1, 2, 1})),
+                    array(builder.finish()),
+                    u8_buffer<std::uint32_t>(std::vector<std::uint32_t>{0, 2, 3})
+                );
+
+                const array ones = map_lookup(numbers, 1);
+                const string_array& typed_ones = ones.as<string_array>();
+                REQUIRE_EQ(typed_ones.size(), 2);
+                CHECK_EQ(typed_ones[0].value(), "x");
+                CHECK_EQ(typed_ones[1].value(), "z");
+
+                const array twos = map_lookup(numbers, std::uint8_t(2));
+                const string_array& typed_twos = twos.as<string_array>();
+                CHECK_EQ(typed_twos[0].value(), "y");
+                CHECK_FALSE(typed_twos[1].has_value());
+
+                const array fractional = map_lookup(numbers, 1.5);
+                CHECK_EQ(fractional.size(), 2);
+                CHECK_EQ(fractional.as<string_array>().get_arrow_proxy().null_count(), 2);
+
+                CHECK_THROWS_AS(std::ignore = map_lookup(numbers, "1"), std::invalid_argument);
+
+                // Keys out of the range of the map keys do not match.
+                CHECK_EQ(map_lookup(numbers, 1e300).as<string_array>().get_arrow_proxy().null_count(), 2);
+                CHECK_EQ(map_lookup(numbers, -1e19).as<string_array>().get_arrow_proxy().null_count(), 2);
+                CHECK_EQ(
+                    map_lookup(numbers, std::numeric_limits<double>::quiet_NaN()).as<string_array>().get_arrow_proxy().null_count(),
+                    2
+                );
+                CHECK_EQ(
+                    map_lookup(numbers, std::numeric_limits<double>::infinity()).as<string_array>().get_arrow_proxy().null_count(),
+                    2
+                );
+            }
+
+            SUBCASE("floating point keys")
+            {
+                // Maps: {1.5: 10, 2: 20}, {1e30: 30}.
+                const map_array numbers(
+                    array(primitive_array<float>(std::vector<float>{1.5f, 2.f, 1e30f})),
+                    array(primitive_array<std::int32_t>(std::vector<std::int32_t>{10, 20, 30})),
+                    u8_buffer<std::uint32_t>(std::vector<std::uint32_t>{0, 2, 3})
+                );
+                const std::vector<nullable<std::int32_t>> two = {20, nullval};
+                CHECK_EQ(to_vector(map_lookup(numbers, std::int64_t(2))), two);
+                const std::vector<nullable<std::int32_t>> one_and_half = {10, nullval};
+                CHECK_EQ(to_vector(map_lookup(numbers, 1.5)), one_and_half);
+
+                const std::vector<nullable<std::int32_t>> none(2, nullval);
+                // INT64_MAX rounds to 2^63 as a float, which an int64 cannot hold.
+                CHECK_EQ(to_vector(map_lookup(numbers, std::numeric_limits<std::int64_t>::max())), none);
+                CHECK_EQ(to_vector(map_lookup(numbers, 1e300)), none);
+                CHECK_EQ(to_vector(map_lookup(numbers, std::numeric_limits<double>::quiet_NaN())), none);
+                // 1e30 is not exactly representable as a float.
+                CHECK_EQ(to_vector(map_lookup(numbers, 1e30)), none);
+            }
+        }
+    }
+}
@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <ranges>
+#include <vector>
 
 #include "sparrow/arrow_array_schema_proxy_factory.hpp"
 #include "sparrow/layout/primitive_array.hpp"
@@ -679,5 +680,52 @@ namespace sparrow
             CHECK_EQ(arr[2].value(), std::size_t(2));
             CHECK_EQ(arr[4].value(), std::size_t(4));
         }
+
+        TEST_CASE("insert and erase on a sliced array")
+        {
+            const primitive_array<std::int32_t> source(
+                std::ranges::iota_view{std::int32_t(0), std::int32_t(16)},
+                std::vector<std::size_t>{2, 9, 12}
+            );
+            arrow_proxy proxy(source.get_arrow_proxy());
+            // The slice starts in the middle of the second byte of the bitmap.
+            proxy.set_offset(9);
+            proxy.set_length(5);
+            // Elements: null, 10, 11, null, 13
+            primitive_array<std::int32_t> ar(std::move(proxy));
+
+            const auto check_elements = [&ar](const std::vector<nullable<std::int32_t>>& expected)
+            {
+                REQUIRE_EQ(ar.size(), expected.size());
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                {
+                    REQUIRE_EQ(ar[i].has_value(), expected[i].has_value());
+                    if (expected[i].has_value())
+                    {
+                        CHECK_EQ(ar[i].value(), expected[i].value());
+                    }
+                }
+            };
+
+            SUBCASE("insert")
+            {
+                const auto iter = ar.insert(sparrow::next(ar.cbegin(), 1), make_nullable<std::int32_t>(99));
+                CHECK_EQ(iter, sparrow::next(ar.begin(), 1));
+                check_elements({nullval, 99, 10, 11, nullval, 13});
+
+                ar.insert(ar.cend(), make_nullable<std::int32_t>(7, false), 2);
+                check_elements({nullval, 99, 10, 11, nullval, 13, nullval, nullval});
+            }
+
+            SUBCASE("erase")
+            {
+                const auto iter = ar.erase(sparrow::next(ar.cbegin(), 1));
+                CHECK_EQ(iter, sparrow::next(ar.begin(), 1));
+                check_elements({nullval, 11, nullval, 13});
+
+                ar.erase(ar.cbegin(), sparrow::next(ar.cbegin(), 2));
+                check_elements({nullval, 13});
+            }
+        }
     }
 }
@@ -0,0 +1,183 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "sparrow/layout/run_end_encoded_layout/run_end_encode.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Value of element ref of a type-erased array, std::nullopt if null.
+        template <class T>
+        std::optional<T> get_value(const array_traits::const_reference& ref)
+        {
+            return std::visit(
+                [](const auto& element) -> std::optional<T>
+                {
+                    using value_type = std::remove_cvref_t<decltype(element.get())>;
+                    if constexpr (std::is_same_v<value_type, T>)
+                    {
+                        if (element.has_value())
+                        {
+                            return element.get();
+                        }
+                    }
+                    else
+                    {
+                        throw std::runtime_error("unexpected element type");
+                    }
+                    return std::nullopt;
+                },
+                ref
+            );
+        }
+    }
+
+    TEST_SUITE("run_end_encode")
+    {
+        TEST_CASE("primitive array")
+        {
+            // [1, null, null, 42, 42, 42, null, 9]
+            const std::vector<nullable<std::int32_t>> input{
+                1,
+                nullable<std::int32_t>(),
+                nullable<std::int32_t>(7, false),
+                42,
+                42,
+                42,
+                nullable<std::int32_t>(),
+                9
+            };
+            const primitive_array<std::int32_t> ar(input);
+
+            const run_end_encoded_array ree = run_end_encode(ar);
+            CHECK_EQ(ree.size(), 8);
+            CHECK_EQ(ree.run_count(), 5);
+            REQUIRE(std::holds_alternative<const std::int16_t*>(ree.run_ends()));
+            const auto* run_ends = std::get<const std::int16_t*>(ree.run_ends());
+            CHECK_EQ(std::vector<std::int16_t>(run_ends, run_ends + 5), std::vector<std::int16_t>{1, 3, 6, 7, 8});
+
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const auto v = get_value<std::int32_t>(ree[i]);
+                REQUIRE_EQ(v.has_value(), ar[i].has_value());
+                if (v.has_value())
+                {
+                    CHECK_EQ(v.value(), ar[i].value());
+                }
+            }
+        }
+
+        TEST_CASE("run end type")
+        {
+            const primitive_array<double> ar(std::vector<double>{1.5, 1.5, 2.5});
+            const run_end_encoded_array ree = run_end_encode(ar, data_type::INT64);
+            CHECK(std::holds_alternative<const std::int64_t*>(ree.run_ends()));
+            CHECK_EQ(ree.run_count(), 2);
+
+            CHECK_THROWS_AS(run_end_encode(ar, data_type::FLOAT), std::invalid_argument);
+            CHECK_THROWS_AS(run_end_encode(ar, data_type::UINT32), std::invalid_argument);
+            const primitive_array<std::int8_t> big(std::vector<std::int8_t>(40000, 3));
+            CHECK_THROWS_AS(run_end_encode(big, data_type::INT16), std::length_error);
+            const run_end_encoded_array big_ree = run_end_encode(big);
+            CHECK(std::holds_alternative<const std::int32_t*>(big_ree.run_ends()));
+            CHECK_EQ(big_ree.run_count(), 1);
+        }
+
+        TEST_CASE("string array")
+        {
+            string_array_builder sb;
+            for (const char* s : {"a", "a", "bb", "bb", "bb", "a"})
+            {
+                sb.push_back(s);
+            }
+            sb.push_back(nullval);
+            sb.push_back(nullval);
+            const string_array ar = sb.finish();
+
+            const run_end_encoded_array ree = run_end_encode(ar);
+            CHECK_EQ(ree.size(), 8);
+            CHECK_EQ(ree.run_count(), 4);
+            CHECK_EQ(get_value<std::string_view>(ree[3]).value(), "bb");
+            CHECK_EQ(get_value<std::string_view>(ree[5]).value(), "a");
+            CHECK_FALSE(get_value<std::string_view>(ree[7]).has_value());
+        }
+
+        TEST_CASE("ree_builder")
+        {
+            ree_builder<primitive_array<std::int64_t>> builder;
+            builder.push_back(5);
+            builder.push_back(5, 3);
+            builder.push_back(nullval, 2);
+            builder.push_back(nullval);
+            builder.push_back(6);
+            builder.push_back(6, 0);
+            CHECK_EQ(builder.size(), 8);
+            CHECK_EQ(builder.run_count(), 3);
+
+            const run_end_encoded_array ree = builder.finish();
+            CHECK_EQ(builder.size(), 0);
+            CHECK_EQ(ree.size(), 8);
+            CHECK_EQ(ree.run_count(), 3);
+            CHECK_EQ(get_value<std::int64_t>(ree[3]).value(), 5);
+            CHECK_FALSE(get_value<std::int64_t>(ree[4]).has_value());
+            CHECK_EQ(get_value<std::int64_t>(ree[7]).value(), 6);
+
+            ree_builder<string_array> string_builder;
+            string_builder.push_back("x", 1000);
+            string_builder.push_back("y");
+            const run_end_encoded_array string_ree = string_builder.finish();
+            CHECK_EQ(string_ree.size(), 1001);
+            CHECK_EQ(string_ree.run_count(), 2);
+            CHECK_EQ(get_value<std::string_view>(string_ree[999]).value(), "x");
+        }
+
+        TEST_CASE("ree_builder failed finish")
+        {
+            // A failed finish leaves the builder unchanged.
+            ree_builder<string_array> builder;
+            builder.push_back("x", 40000);
+            builder.push_back(nullval);
+            builder.push_back("y");
+            CHECK_THROWS_AS(std::ignore = builder.finish(data_type::INT16), std::length_error);
+            CHECK_THROWS_AS(std::ignore = builder.finish(data_type::UINT32), std::invalid_argument);
+            CHECK_EQ(builder.size(), 40002);
+            CHECK_EQ(builder.run_count(), 3);
+
+            const run_end_encoded_array ree = builder.finish();
+            CHECK_EQ(builder.size(), 0);
+            REQUIRE_EQ(ree.size(), 40002);
+            CHECK_EQ(get_value<std::string_view>(ree[0]).value(), "x");
+            CHECK_FALSE(get_value<std::string_view>(ree[40000]).has_value());
+            CHECK_EQ(get_value<std::string_view>(ree[40001]).value(), "y");
+
+            ree_builder<primitive_array<std::int32_t>> primitive_builder;
+            primitive_builder.push_back(1, 40000);
+            CHECK_THROWS_AS(std::ignore = primitive_builder.finish(data_type::INT16), std::length_error);
+            CHECK_EQ(primitive_builder.finish().size(), 40000);
+        }
+    }
+}
@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 #include "sparrow/layout/primitive_array.hpp"
 #include "sparrow/utils/nullable.hpp"
 #include "sparrow/layout/dispatch.hpp"
@@ -20,6 +24,7 @@
 #include "test_utils.hpp"
 #include "../test/external_array_data_creation.hpp"
 
+#include "sparrow/layout/run_end_encoded_layout/run_end_encode.hpp"
 #include "sparrow/layout/run_end_encoded_layout/run_end_encoded_array.hpp"
 
 namespace sparrow
@@ -182,11 +187,80 @@ namespace sparrow
                     ++iter;
                 }
             }
+            SUBCASE("random access iterator"){
+                static_assert(std::random_access_iterator<run_end_encoded_array::const_iterator>);
+                const auto& const_array = rle_array;
+                auto iter = const_array.end();
+                for(std::size_t i=n; i>0; --i){
+                    --iter;
+                    CHECK(iter->has_value() == bool(expected_bitmap[i - 1]));
+                }
+                CHECK(iter == const_array.begin());
+                CHECK_EQ(*(iter + 4), rle_array[4]);
+                CHECK_EQ(iter[7], rle_array[7]);
+                iter += 5;
+                CHECK_EQ(*iter, rle_array[5]);
+                iter -= 3;
+                CHECK_EQ(*iter, rle_array[2]);
+                CHECK_EQ(const_array.end() - iter, 6);
+                CHECK(iter < const_array.end());
+            }
+            SUBCASE("cursor"){
+                run_end_encoded_cursor cursor(rle_array);
+                const std::vector<std::size_t> expected_runs{0, 1, 1, 2, 2, 2, 3, 4};
+                for(std::size_t i : {0u, 3u, 4u, 7u, 2u, 6u, 1u, 5u}){
+                    CHECK_EQ(cursor[i], rle_array[i]);
+                    CHECK_EQ(cursor.run(), expected_runs[i]);
+                    CHECK(cursor.run_begin() <= i);
+                    CHECK(i < cursor.run_end());
+                }
+                CHECK_EQ(cursor.seek(n), rle_array.run_count());
+            }
             SUBCASE("consitency")
             {   
                 test::generic_consistency_test(rle_array);
             }
         }
+
+        TEST_CASE("find_run")
+        {
+            // Runs of length 1, 2, 3, 1, 2, 3, ... so that run ends are irregular,
+            // enough of them to build the skip index.
+            const std::size_t run_count = run_end_encoded_array::skip_index_min_runs + 100;
+            ree_builder<primitive_array<std::uint32_t>> builder;
+            std::vector<std::uint64_t> run_ends;
+            std::uint64_t length = 0;
+            for(std::size_t r = 0; r < run_count; ++r){
+                builder.push_back(static_cast<std::uint32_t>(r), r % 3 + 1);
+                length += r % 3 + 1;
+                run_ends.push_back(length);
+            }
+            const run_end_encoded_array rle_array = builder.finish();
+            REQUIRE_EQ(rle_array.run_count(), run_count);
+
+            const auto expected_run = [&](std::uint64_t i){
+                return static_cast<std::size_t>(std::distance(
+                    run_ends.begin(),
+                    std::upper_bound(run_ends.begin(), run_ends.end(), i)
+                ));
+            };
+
+            for(std::uint64_t i : {std::uint64_t(0), std::uint64_t(1), std::uint64_t(1000), length / 2, length - 1, length}){
+                CHECK_EQ(rle_array.find_run(i), expected_run(i));
+                for(std::size_t hint : {std::size_t(0), std::size_t(5), run_count / 3, run_count - 1, run_count + 7}){
+                    CHECK_EQ(rle_array.find_run(i, hint), expected_run(i));
+                }
+            }
+
+            // Near-sequential access through the iterator and the cursor.
+            run_end_encoded_cursor cursor(rle_array);
+            auto iter = rle_array.cbegin();
+            for(std::uint64_t i = 0; i < length; i += 7){
+                const std::size_t run = expected_run(i);
+                CHECK_EQ(cursor.seek(i), run);
+                CHECK_EQ(*(iter + static_cast<std::ptrdiff_t>(i)), array_element(rle_array.encoded_values(), run));
+            }
+        }
     }
 }
 
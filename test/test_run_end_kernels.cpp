@@ -0,0 +1,254 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sparrow/layout/run_end_encoded_layout/run_end_kernels.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // [3 x4, null x2, -1 x1, 3 x3, 10 x1000]
+        run_end_encoded_array make_int_array()
+        {
+            ree_builder<primitive_array<std::int32_t>> builder;
+            builder.push_back(3, 4);
+            builder.push_back(nullval, 2);
+            builder.push_back(-1);
+            builder.push_back(3, 3);
+            builder.push_back(10, 1000);
+            return builder.finish();
+        }
+
+        // ["ab" x2, null x1, "c" x3, "ab" x1]
+        run_end_encoded_array make_string_array()
+        {
+            ree_builder<string_array> builder;
+            builder.push_back("ab", 2);
+            builder.push_back(nullval);
+            builder.push_back("c", 3);
+            builder.push_back("ab");
+            return builder.finish();
+        }
+    }
+
+    TEST_SUITE("run_end_kernels")
+    {
+        TEST_CASE("typed_run_view")
+        {
+            const run_end_encoded_array ar = make_int_array();
+            const typed_run_view<primitive_array<std::int32_t>> view(ar);
+            CHECK_EQ(view.size(), 1010);
+            REQUIRE_EQ(view.run_count(), 5);
+            CHECK_EQ(view.run_end(1), 6);
+            CHECK_EQ(view.run_length(0), 4);
+            CHECK_EQ(view.run_length(4), 1000);
+            CHECK_FALSE(view.has_value(1));
+            CHECK_EQ(view.value(1), 0);
+            CHECK_EQ(view.value(2), -1);
+
+            std::vector<std::pair<std::int32_t, std::size_t>> runs;
+            std::size_t null_runs = 0;
+            view.for_each_run(
+                [&](const nullable<std::int32_t>& value, std::size_t length)
+                {
+                    if (value.has_value())
+                    {
+                        runs.emplace_back(value.get(), length);
+                    }
+                    else
+                    {
+                        ++null_runs;
+                    }
+                }
+            );
+            const std::vector<std::pair<std::int32_t, std::size_t>> expected{{3, 4}, {-1, 1}, {3, 3}, {10, 1000}};
+            CHECK_EQ(runs, expected);
+            CHECK_EQ(null_runs, 1);
+
+            CHECK_THROWS_AS(typed_run_view<primitive_array<double>>(ar), std::runtime_error);
+        }
+
+        TEST_CASE("aggregation")
+        {
+            const run_end_encoded_array ar = make_int_array();
+            CHECK_EQ(ree_null_count(ar), 2);
+            CHECK_EQ(ree_sum<std::int32_t>(ar), 3 * 4 - 1 + 3 * 3 + 10 * 1000);
+            const auto mean = ree_mean<std::int32_t>(ar);
+            REQUIRE(mean.has_value());
+            CHECK_EQ(*mean, doctest::Approx(10020. / 1008.));
+            CHECK_EQ(ree_min<primitive_array<std::int32_t>>(ar), std::optional<std::int32_t>(-1));
+            CHECK_EQ(ree_max<primitive_array<std::int32_t>>(ar), std::optional<std::int32_t>(10));
+
+            const primitive_array<double> values(std::vector<double>{0.5, 0.5, 0.5, 2.});
+            const run_end_encoded_array doubles = run_end_encode(values);
+            CHECK_EQ(ree_sum<double>(doubles), doctest::Approx(3.5));
+
+            ree_builder<primitive_array<std::uint8_t>> builder;
+            builder.push_back(nullval, 3);
+            const run_end_encoded_array all_null = builder.finish();
+            CHECK_EQ(ree_null_count(all_null), 3);
+            CHECK_EQ(ree_sum<std::uint8_t>(all_null), 0u);
+            CHECK_FALSE(ree_mean<std::uint8_t>(all_null).has_value());
+            CHECK_FALSE(ree_min<primitive_array<std::uint8_t>>(all_null).has_value());
+        }
+
+        TEST_CASE("count and match")
+        {
+            const run_end_encoded_array ar = make_int_array();
+            using A = primitive_array<std::int32_t>;
+            CHECK_EQ(
+                ree_count_if<A>(
+                    ar,
+                    [](std::int32_t v)
+                    {
+                        return v < 5;
+                    }
+                ),
+                8
+            );
+
+            const validity_bitmap matches = ree_equal<A>(ar, 3);
+            REQUIRE_EQ(matches.size(), ar.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const bool expected = i < 4 || (i >= 7 && i < 10);
+                CHECK_EQ(matches.test(i), expected);
+            }
+
+            const run_end_encoded_array strings = make_string_array();
+            const validity_bitmap string_matches = ree_equal<string_array>(strings, std::string_view("ab"));
+            CHECK_EQ(string_matches.size(), 7);
+            CHECK_EQ(string_matches.null_count(), 4);
+            CHECK(string_matches.test(6));
+            CHECK_EQ(ree_min<string_array>(strings), std::optional<std::string_view>("ab"));
+            CHECK_EQ(ree_max<string_array>(strings), std::optional<std::string_view>("c"));
+        }
+
+        TEST_CASE("filter")
+        {
+            const run_end_encoded_array ar = make_int_array();
+            using A = primitive_array<std::int32_t>;
+            const run_end_encoded_array filtered = ree_filter<A>(
+                ar,
+                [](std::int32_t v)
+                {
+                    return v != -1;
+                }
+            );
+            // The runs of 3 on both sides of the dropped run are merged.
+            CHECK_EQ(filtered.size(), 1007);
+            CHECK_EQ(filtered.run_count(), 2);
+            CHECK_EQ(ree_sum<std::int32_t>(filtered), 3 * 7 + 10 * 1000);
+
+            const run_end_encoded_array strings = make_string_array();
+            const run_end_encoded_array filtered_strings = ree_filter<string_array>(
+                strings,
+                [](std::string_view v)
+                {
+                    return v == "c";
+                }
+            );
+            CHECK_EQ(filtered_strings.size(), 3);
+            CHECK_EQ(filtered_strings.run_count(), 1);
+        }
+
+        TEST_CASE("decode primitive")
+        {
+            // Runs straddling byte boundaries of the validity bitmap.
+            ree_builder<primitive_array<std::int16_t>> builder;
+            builder.push_back(7, 3);
+            builder.push_back(nullval, 10);
+            builder.push_back(-2, 1);
+            builder.push_back(nullval, 1);
+            builder.push_back(5, 20);
+            builder.push_back(nullval, 16);
+            const run_end_encoded_array ar = builder.finish(data_type::INT32);
+            REQUIRE(std::holds_alternative<const std::int32_t*>(ar.run_ends()));
+
+            const primitive_array<std::int16_t> decoded = decode_run_end_encoded<primitive_array<std::int16_t>>(ar);
+            REQUIRE_EQ(decoded.size(), ar.size());
+            CHECK_EQ(decoded.get_arrow_proxy().null_count(), 27);
+            std::size_t null_count = 0;
+            for (std::size_t i = 0; i < decoded.size(); ++i)
+            {
+                const bool expected_valid = i < 3 || i == 13 || (i >= 15 && i < 35);
+                REQUIRE_EQ(decoded[i].has_value(), expected_valid);
+                null_count += expected_valid ? 0 : 1;
+                if (expected_valid)
+                {
+                    CHECK_EQ(decoded[i].get(), i < 3 ? 7 : (i == 13 ? -2 : 5));
+                }
+            }
+            CHECK_EQ(null_count, 27);
+
+            const array erased = decode_run_end_encoded(ar);
+            REQUIRE_EQ(erased.size(), ar.size());
+            const typed_view<std::int16_t> view(erased);
+            CHECK_EQ(view.value(20), 5);
+            CHECK_FALSE(view.has_value(40));
+
+            CHECK_THROWS_AS(decode_run_end_encoded<primitive_array<double>>(ar), std::runtime_error);
+        }
+
+        TEST_CASE("decode string")
+        {
+            ree_builder<string_array> builder;
+            builder.push_back("abc", 5);
+            builder.push_back(nullval, 2);
+            builder.push_back("", 3);
+            builder.push_back("z");
+            const run_end_encoded_array ar = builder.finish(data_type::INT64);
+
+            const string_array decoded = decode_run_end_encoded<string_array>(ar);
+            REQUIRE_EQ(decoded.size(), 11);
+            for (std::size_t i = 0; i < 5; ++i)
+            {
+                CHECK_EQ(decoded[i].get(), "abc");
+            }
+            CHECK_FALSE(decoded[5].has_value());
+            CHECK_FALSE(decoded[6].has_value());
+            CHECK(decoded[8].has_value());
+            CHECK_EQ(decoded[8].get(), "");
+            CHECK_EQ(decoded[10].get(), "z");
+
+            const array erased = decode_run_end_encoded(ar);
+            CHECK_EQ(erased.size(), 11);
+            CHECK_EQ(erased.as<string_array>()[4].get(), "abc");
+        }
+
+        TEST_CASE("signed run ends")
+        {
+            const primitive_array<std::uint8_t> values(std::vector<std::uint8_t>{1, 1, 2, 2, 2, 3});
+            for (data_type dt : {data_type::INT16, data_type::INT32, data_type::INT64})
+            {
+                const run_end_encoded_array ar = run_end_encode(values, dt);
+                CHECK_EQ(ar.run_count(), 3);
+                CHECK_EQ(ar.find_run(4), 1);
+                CHECK_EQ(ree_sum<std::uint8_t>(ar), 11u);
+                const auto decoded = decode_run_end_encoded<primitive_array<std::uint8_t>>(ar);
+                CHECK(std::ranges::equal(decoded, values));
+            }
+        }
+    }
+}
@@ -14,6 +14,8 @@
 
 #include "sparrow/layout/primitive_array.hpp"
 #include "sparrow/layout/struct_layout/struct_array.hpp"
+#include "sparrow/layout/struct_layout/struct_rows.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
 #include "sparrow/utils/nullable.hpp"
 
 #include "doctest/doctest.h"
@@ -152,6 +154,153 @@ namespace sparrow
             {   
                 test::generic_consistency_test(struct_arr);
             }  
+
+            SUBCASE("struct_value iteration")
+            {
+                const auto value = struct_arr[1].value();
+                CHECK_EQ(std::distance(value.begin(), value.end()), 2);
+                CHECK_EQ(value.cbegin(), value.begin());
+                std::size_t k = 0;
+                for (const auto& child : value)
+                {
+                    CHECK(child == value[k]);
+                    ++k;
+                }
+                CHECK_EQ(k, value.size());
+            }
+
+            SUBCASE("child")
+            {
+                CHECK_EQ(struct_arr.children_count(), 2);
+                const auto& first = struct_arr.template child<primitive_array<inner_scalar_type>>(0);
+                const auto& second = struct_arr.template child<primitive_array<std::uint8_t>>(1);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    CHECK_EQ(first[i].value(), static_cast<inner_scalar_type>(i));
+                    CHECK_EQ(second[i].value(), static_cast<std::uint8_t>(i));
+                }
+                CHECK_THROWS_AS(std::ignore = struct_arr.template child<string_array>(1), std::runtime_error);
+            }
+
+            SUBCASE("project")
+            {
+                const struct_projection projected = struct_arr.project({1, 0});
+                REQUIRE_EQ(projected.size(), n);
+                REQUIRE_EQ(projected.children_count(), 2);
+                CHECK(projected.raw_child(0)->get_arrow_proxy().data_type() == data_type::UINT8);
+                const auto& second = projected.template child<primitive_array<std::uint8_t>>(0);
+                const auto& first = projected.template child<primitive_array<inner_scalar_type>>(1);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    CHECK_EQ(first[i].value(), static_cast<inner_scalar_type>(i));
+                    CHECK_EQ(second[i].value(), static_cast<std::uint8_t>(i));
+                }
+
+                const struct_projection single = struct_arr.project({0});
+                CHECK_EQ(single.children_count(), 1);
+                CHECK_EQ(single[2].value().size(), 1);
+                static_assert(std::is_const_v<std::remove_reference_t<
+                                  decltype(single.template child<primitive_array<inner_scalar_type>>(0))>>);
+                CHECK_THROWS_AS(std::ignore = struct_arr.project({2}), std::out_of_range);
+            }
+        }
+
+        namespace
+        {
+            struct row
+            {
+                std::int32_t id;
+                std::string name;
+            };
+
+            struct optional_row
+            {
+                std::optional<std::int32_t> id;
+                std::optional<std::string> name;
+            };
+        }
+
+        TEST_CASE("materialize_rows")
+        {
+            const std::size_t n = 5;
+            struct_array struct_arr(test::make_struct_proxy<std::int32_t, std::string>(n));
+            const std::vector<std::string> words = test::make_testing_words(n);
+
+            SUBCASE("all rows")
+            {
+                const std::vector<row> rows = materialize_rows<row, &row::id, &row::name>(struct_arr);
+                REQUIRE_EQ(rows.size(), n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    CHECK_EQ(rows[i].id, static_cast<std::int32_t>(i));
+                    CHECK_EQ(rows[i].name, words[i]);
+                }
+            }
+
+            SUBCASE("range appended")
+            {
+                std::vector<optional_row> rows(1);
+                materialize_rows<optional_row, &optional_row::id, &optional_row::name>(struct_arr, 2, 3, rows);
+                REQUIRE_EQ(rows.size(), 4);
+                CHECK_FALSE(rows[0].id.has_value());
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    REQUIRE(rows[i + 1].id.has_value());
+                    CHECK_EQ(*rows[i + 1].id, static_cast<std::int32_t>(i + 2));
+                    REQUIRE(rows[i + 1].name.has_value());
+                    CHECK_EQ(*rows[i + 1].name, words[i + 2]);
+                }
+            }
+
+            SUBCASE("nulls")
+            {
+                ArrowArray arr{};
+                ArrowSchema schema{};
+                std::vector<ArrowArray> children_arrays(2);
+                std::vector<ArrowSchema> children_schemas(2);
+                test::fill_schema_and_array<std::int32_t>(children_schemas[0], children_arrays[0], n, 0, {1, 3});
+                test::fill_schema_and_array<std::string>(children_schemas[1], children_arrays[1], n, 0, {3});
+                test::fill_schema_and_array_for_struct_layout(
+                    schema,
+                    arr,
+                    std::move(children_schemas),
+                    std::move(children_arrays),
+                    {}
+                );
+                struct_array with_nulls(arrow_proxy(std::move(arr), std::move(schema)));
+
+                const auto optional_rows = materialize_rows<optional_row, &optional_row::id, &optional_row::name>(
+                    with_nulls
+                );
+                CHECK_FALSE(optional_rows[1].id.has_value());
+                CHECK(optional_rows[1].name.has_value());
+                CHECK_FALSE(optional_rows[3].id.has_value());
+                CHECK_FALSE(optional_rows[3].name.has_value());
+                CHECK_EQ(*optional_rows[4].id, 4);
+
+                const auto rows = materialize_rows<row, &row::id, &row::name>(with_nulls);
+                CHECK_EQ(rows[1].id, 0);
+                CHECK_EQ(rows[3].name, "");
+                CHECK_EQ(rows[2].id, 2);
+            }
+
+            SUBCASE("errors")
+            {
+                struct triple
+                {
+                    std::int32_t a;
+                    std::int32_t b;
+                    std::int32_t c;
+                };
+                CHECK_THROWS_AS(
+                    (std::ignore = materialize_rows<triple, &triple::a, &triple::b, &triple::c>(struct_arr)),
+                    std::invalid_argument
+                );
+                CHECK_THROWS_AS(
+                    (std::ignore = materialize_rows<row, &row::id, &row::id>(struct_arr)),
+                    std::runtime_error
+                );
+            }
         }
     }
 
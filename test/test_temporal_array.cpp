@@ -0,0 +1,183 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/dispatch.hpp"
+#include "sparrow/layout/temporal_array.hpp"
+#include "sparrow/layout/temporal_kernels.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        // 2024-03-10T12:34:56.789Z, null, 1969-12-31T23:59:59.500Z
+        timestamp_milliseconds_array make_timestamps()
+        {
+            return timestamp_milliseconds_array(
+                u8_buffer<std::int64_t>(std::vector<std::int64_t>{1710074096789, 0, -500}),
+                std::vector<std::size_t>{1},
+                "Europe/Paris"
+            );
+        }
+
+        template <class T>
+        std::vector<typename temporal_array<T>::storage_type> raw(const temporal_array<T>& ar)
+        {
+            return {ar.data(), ar.data() + ar.size()};
+        }
+    }
+
+    TEST_SUITE("temporal_array")
+    {
+        TEST_CASE("timestamps")
+        {
+            const timestamp_milliseconds_array ar = make_timestamps();
+            REQUIRE_EQ(ar.size(), 3);
+            CHECK_EQ(ar.timezone(), "Europe/Paris");
+            CHECK_EQ(ar.get_arrow_proxy().format(), "tsm:Europe/Paris");
+            CHECK_EQ(ar.get_arrow_proxy().data_type(), data_type::TIMESTAMP_MILLISECONDS);
+            CHECK_EQ(ar[0].value().time_since_epoch(), 1710074096789ms);
+            CHECK_FALSE(ar[1].has_value());
+            CHECK_EQ(ar[2].value(), timestamp_milliseconds(-500ms));
+
+            const timestamp_seconds_array no_tz(std::vector<timestamp_seconds>{timestamp_seconds(42s)});
+            CHECK_EQ(no_tz.get_arrow_proxy().format(), "tss:");
+            CHECK(no_tz.timezone().empty());
+            CHECK_EQ(no_tz[0].value().time_since_epoch(), 42s);
+        }
+
+        TEST_CASE("dates, times and durations")
+        {
+            const date_days d(std::chrono::year_month_day(std::chrono::year(2024), std::chrono::March, std::chrono::day(10)));
+            const date_days_array dates(std::vector<date_days>{d, date_days(-1 * std::chrono::days(1))});
+            CHECK_EQ(dates.get_arrow_proxy().format(), "tdD");
+            CHECK_EQ(dates.get_arrow_proxy().buffers()[1].size(), 2 * sizeof(std::int32_t));
+            CHECK_EQ(std::chrono::year_month_day(dates[0].value()).day(), std::chrono::day(10));
+            CHECK_EQ(raw(dates), std::vector<std::int32_t>{19792, -1});
+
+            const time_milliseconds_array times(
+                std::vector<time_milliseconds>{time_milliseconds(12h + 34min + 56s + 789ms)}
+            );
+            CHECK_EQ(times.get_arrow_proxy().format(), "ttm");
+            const std::chrono::hh_mm_ss<std::chrono::milliseconds> fields(times[0].value());
+            CHECK_EQ(fields.hours(), 12h);
+            CHECK_EQ(fields.subseconds(), 789ms);
+
+            const duration_microseconds_array durations(
+                std::vector<std::chrono::microseconds>{-3us, 1500us},
+                std::vector<std::size_t>{0}
+            );
+            CHECK_EQ(durations.get_arrow_proxy().format(), "tDu");
+            CHECK_FALSE(durations[0].has_value());
+            CHECK_EQ(durations[1].value(), 1500us);
+        }
+
+        TEST_CASE("array and dispatch")
+        {
+            array generic(make_timestamps());
+            CHECK_EQ(generic.size(), 3);
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            std::move(generic).extract_arrow_array(arr).extract_arrow_schema(schema);
+            const array roundtrip(std::move(arr), std::move(schema));
+            const auto& typed = roundtrip.as<timestamp_milliseconds_array>();
+            CHECK_EQ(typed.timezone(), "Europe/Paris");
+            CHECK_EQ(typed[0].value().time_since_epoch(), 1710074096789ms);
+            CHECK_FALSE(typed[1].has_value());
+        }
+
+        TEST_CASE("temporal_cast")
+        {
+            SUBCASE("to a finer unit")
+            {
+                const auto res = temporal_cast<timestamp_microseconds>(make_timestamps());
+                CHECK_EQ(res.timezone(), "Europe/Paris");
+                CHECK_EQ(res[0].value().time_since_epoch(), 1710074096789000us);
+                CHECK_FALSE(res[1].has_value());
+                CHECK_EQ(res[2].value().time_since_epoch(), -500000us);
+
+                const date_days_array dates(std::vector<date_days>{date_days(std::chrono::days(2))});
+                const auto ms = temporal_cast<date_milliseconds>(dates);
+                CHECK_EQ(raw(ms), std::vector<std::int64_t>{172800000});
+            }
+
+            SUBCASE("to a coarser unit")
+            {
+                const auto res = temporal_cast<timestamp_seconds>(make_timestamps());
+                CHECK_EQ(raw(res)[0], 1710074096);
+                CHECK_EQ(raw(res)[2], -1);
+
+                const duration_milliseconds_array durations(std::vector<std::chrono::milliseconds>{-1500ms, 1500ms});
+                CHECK_EQ(raw(temporal_cast<std::chrono::seconds>(durations)), std::vector<std::int64_t>{-1, 1});
+
+                const time_nanoseconds_array times(std::vector<time_nanoseconds>{time_nanoseconds(3723999999999ns)});
+                const auto secs = temporal_cast<time_seconds>(times);
+                CHECK_EQ(raw(secs), std::vector<std::int32_t>{3723});
+            }
+
+            SUBCASE("overflow")
+            {
+                const timestamp_seconds_array big(
+                    u8_buffer<std::int64_t>(std::vector<std::int64_t>{1, std::int64_t(1) << 40})
+                );
+                CHECK_THROWS_AS(std::ignore = temporal_cast<timestamp_nanoseconds>(big), std::overflow_error);
+
+                // Out of range null values are ignored.
+                const timestamp_seconds_array null_big(
+                    u8_buffer<std::int64_t>(std::vector<std::int64_t>{1, std::int64_t(1) << 40}),
+                    std::vector<std::size_t>{1}
+                );
+                const auto res = temporal_cast<timestamp_nanoseconds>(null_big);
+                CHECK_EQ(res[0].value().time_since_epoch(), 1s);
+                CHECK_FALSE(res[1].has_value());
+            }
+        }
+
+        TEST_CASE("floor_to")
+        {
+            const auto minutes = floor_to(make_timestamps(), 1min);
+            CHECK_EQ(minutes.timezone(), "Europe/Paris");
+            CHECK_EQ(minutes[0].value().time_since_epoch(), 1710074040000ms);
+            CHECK_FALSE(minutes[1].has_value());
+            CHECK_EQ(minutes[2].value().time_since_epoch(), -60000ms);
+
+            const auto hours = floor_to(make_timestamps(), 1h);
+            CHECK_EQ(hours[0].value().time_since_epoch(), 1710072000000ms);
+
+            const auto days = floor_to(make_timestamps(), std::chrono::days(1));
+            CHECK_EQ(
+                std::chrono::floor<std::chrono::days>(days[0].value()),
+                std::chrono::sys_days(std::chrono::year_month_day(std::chrono::year(2024), std::chrono::March, std::chrono::day(10)))
+            );
+            CHECK_EQ(days[0].value().time_since_epoch() % std::chrono::days(1), 0ms);
+            CHECK_EQ(days[2].value().time_since_epoch(), -std::chrono::days(1));
+
+            const timestamp_seconds_array secs(std::vector<timestamp_seconds>{timestamp_seconds(42s)});
+            CHECK_THROWS_AS(std::ignore = floor_to(secs, 1500ms), std::invalid_argument);
+            CHECK_THROWS_AS(std::ignore = floor_to(secs, 0s), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,159 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "sparrow/layout/list_layout/tensor_kernels.hpp"
+#include "sparrow/layout/list_layout/tensor_view.hpp"
+
+#include "../test/external_array_data_creation.hpp"
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        // Fixed size list array of rows * list_size elements of the flat
+        // array holding 0, 1, 2, ...
+        template <class T>
+        arrow_proxy make_fixed_sized_list_proxy(std::size_t rows, std::size_t list_size, const std::vector<std::size_t>& nulls)
+        {
+            ArrowArray flat_arr{};
+            ArrowSchema flat_schema{};
+            test::fill_schema_and_array<T>(flat_schema, flat_arr, rows * list_size, 0, {});
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            test::fill_schema_and_array_for_fixed_size_list_layout(
+                schema,
+                arr,
+                std::move(flat_schema),
+                std::move(flat_arr),
+                nulls,
+                list_size
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+    }
+
+    TEST_SUITE("tensor_view")
+    {
+        TEST_CASE("view")
+        {
+            const fixed_sized_list_array ar(make_fixed_sized_list_proxy<float>(4, 3, {2}));
+            const tensor_view<float> view(ar);
+            REQUIRE_EQ(view.rows(), 4);
+            REQUIRE_EQ(view.cols(), 3);
+            CHECK_FALSE(view.empty());
+            CHECK_EQ(view.values().size(), 12);
+            CHECK_EQ(view.row(1)[0], 3.f);
+            CHECK_EQ(view.row(1)[2], 5.f);
+            CHECK_EQ(view(3, 2), 11.f);
+            CHECK(view.has_value(1));
+            CHECK_FALSE(view.has_value(2));
+
+            SUBCASE("offset")
+            {
+                arrow_proxy proxy = make_fixed_sized_list_proxy<float>(4, 3, {2});
+                proxy.set_offset(1);
+                proxy.set_length(3);
+                const fixed_sized_list_array sliced(std::move(proxy));
+                const tensor_view<float> sliced_view(sliced);
+                REQUIRE_EQ(sliced_view.rows(), 3);
+                CHECK_EQ(sliced_view(0, 0), 3.f);
+                CHECK_EQ(sliced_view(2, 2), 11.f);
+                CHECK_FALSE(sliced_view.has_value(1));
+            }
+
+            SUBCASE("wrong type")
+            {
+                const fixed_sized_list_array ints(make_fixed_sized_list_proxy<std::int32_t>(2, 2, {}));
+                CHECK_THROWS_AS(tensor_view<float>{ints}, std::runtime_error);
+                CHECK_EQ(tensor_view<std::int32_t>(ints)(1, 1), 3);
+            }
+        }
+
+        TEST_CASE("kernels")
+        {
+            const fixed_sized_list_array ar(make_fixed_sized_list_proxy<double>(4, 3, {2}));
+            const tensor_view<double> view(ar);
+
+            SUBCASE("dot")
+            {
+                const std::vector<double> query = {1., 0., 0.};
+                const auto dot = tensor_dot(view, query);
+                REQUIRE_EQ(dot.size(), 4);
+                CHECK_EQ(dot[0].value(), 0.);
+                CHECK_EQ(dot[1].value(), 3.);
+                CHECK_FALSE(dot[2].has_value());
+                CHECK_EQ(dot[3].value(), 9.);
+            }
+
+            SUBCASE("l2")
+            {
+                const std::vector<double> query = {3., 4., 5.};
+                const auto distance = tensor_l2_distance(view, query);
+                CHECK_EQ(distance[0].value(), doctest::Approx(std::sqrt(27.)));
+                CHECK_EQ(distance[1].value(), 0.);
+                CHECK_FALSE(distance[2].has_value());
+                CHECK_EQ(distance[3].value(), doctest::Approx(std::sqrt(108.)));
+            }
+
+            SUBCASE("cosine")
+            {
+                const std::vector<double> query = {6., 8., 10.};
+                const auto distance = tensor_cosine_distance(view, query);
+                CHECK_EQ(distance[0].value(), doctest::Approx(1. - 28. / (std::sqrt(5.) * std::sqrt(200.))));
+                CHECK_EQ(distance[1].value(), doctest::Approx(0.));
+                CHECK_FALSE(distance[2].has_value());
+
+                const std::vector<double> zero = {0., 0., 0.};
+                CHECK_EQ(tensor_cosine_distance(view, zero)[1].value(), 1.);
+            }
+
+            SUBCASE("top_k")
+            {
+                const std::vector<double> unit = {1., 0., 0.};
+                CHECK_EQ(tensor_top_k(view, unit, 2, tensor_metric::dot), std::vector<std::size_t>{3, 1});
+                const std::vector<double> query = {3., 4., 5.};
+                CHECK_EQ(tensor_top_k(view, query, 10, tensor_metric::l2), std::vector<std::size_t>{1, 0, 3});
+                CHECK_EQ(tensor_top_k(view, query, 1, tensor_metric::cosine), std::vector<std::size_t>{1});
+                CHECK(tensor_top_k(view, query, 0, tensor_metric::l2).empty());
+            }
+
+            SUBCASE("wide rows")
+            {
+                // More columns than accumulators, to go through the tail loops.
+                const fixed_sized_list_array wide(make_fixed_sized_list_proxy<float>(3, 9, {}));
+                const tensor_view<float> wide_view(wide);
+                const std::vector<float> ones(9, 1.f);
+                const auto dot = tensor_dot(wide_view, ones);
+                CHECK_EQ(dot[0].value(), 36.f);
+                CHECK_EQ(dot[1].value(), 117.f);
+                CHECK_EQ(dot[2].value(), 198.f);
+                CHECK_EQ(tensor_l2_distance(wide_view, ones)[0].value(), doctest::Approx(std::sqrt(141.)));
+            }
+
+            SUBCASE("query size")
+            {
+                const std::vector<double> query = {1., 0.};
+                CHECK_THROWS_AS(std::ignore = tensor_dot(view, query), std::invalid_argument);
+                CHECK_THROWS_AS(std::ignore = tensor_top_k(view, query, 1, tensor_metric::dot), std::invalid_argument);
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/arrow_interface/arrow_array_schema_factory.hpp"
+#include "sparrow/layout/dictionary_encode.hpp"
+#include "sparrow/layout/typed_dictionary_view.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        static const std::array<std::string, 7> words{{"hello", "you", "are", "not", "prepared", "!", "?"}};
+
+        // Same array as in test_dictionary_encoded_array.cpp: both keys and
+        // dictionary have an offset and nulls.
+        // Elements: null, null, not, prepared, null, not, ?, you, null, not;
+        // elements 0 and 4 have null keys, 1 and 8 refer to a null value.
+        dictionary_encoded_array<std::uint32_t> make_dictionary_array()
+        {
+            constexpr std::array<size_t, 2> keys_nulls{1ULL, 5ULL};
+            const std::vector<std::uint32_t> keys{0, 0, 1, 2, 3, 4, 2, 5, 0, 1, 2};
+            constexpr std::array<size_t, 1> value_nulls{2ULL};
+
+            return dictionary_encoded_array<std::uint32_t>(arrow_proxy{
+                make_dictionary_encoded_arrow_array(keys, keys_nulls, 1, words, value_nulls, 1),
+                make_dictionary_encoded_arrow_schema(data_type::STRING, data_type::UINT32)
+            });
+        }
+    }
+
+    TEST_SUITE("typed_dictionary_view")
+    {
+        TEST_CASE("string dictionary")
+        {
+            const auto ar = make_dictionary_array();
+            const typed_dictionary_view<std::uint32_t, string_array> view(ar);
+            REQUIRE_EQ(view.size(), ar.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const auto expected = std::get<nullable<std::string_view>>(ar[i]);
+                REQUIRE_EQ(view.has_value(i), expected.has_value());
+                if (expected.has_value())
+                {
+                    CHECK_EQ(view[i], expected.value());
+                }
+                else if (!view.keys().has_value(i))
+                {
+                    CHECK(view[i].empty());
+                }
+            }
+
+            std::size_t count = 0;
+            for (std::string_view value : view)
+            {
+                CHECK_EQ(value, view.value(count));
+                ++count;
+            }
+            CHECK_EQ(count, view.size());
+        }
+
+        TEST_CASE("decode strings")
+        {
+            const auto ar = make_dictionary_array();
+            const string_array decoded = typed_dictionary_view<std::uint32_t, string_array>(ar).decode();
+            REQUIRE_EQ(decoded.size(), ar.size());
+            CHECK_EQ(decoded.get_arrow_proxy().null_count(), 4);
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                const auto expected = std::get<nullable<std::string_view>>(ar[i]);
+                REQUIRE_EQ(decoded[i].has_value(), expected.has_value());
+                if (expected.has_value())
+                {
+                    CHECK_EQ(decoded[i].value(), expected.value());
+                }
+            }
+        }
+
+        TEST_CASE("primitive dictionary")
+        {
+            const std::vector<nullable<std::int64_t>> values{4, 8, nullable<std::int64_t>(), 15, 4, 8, 16, 23, 42};
+            const primitive_array<std::int64_t> ar(values);
+            const dictionary_encoded_array<std::int8_t> encoded(dictionary_encode(ar));
+
+            const typed_dictionary_view<std::int8_t, primitive_array<std::int64_t>> view(encoded);
+            CHECK_EQ(view.dictionary().size(), 6);
+            CHECK_EQ(view.keys().size(), ar.size());
+            CHECK_EQ(view[3], 15);
+            CHECK_FALSE(view.has_value(2));
+            CHECK_EQ(view[2], 0);
+
+            CHECK_EQ(view.decode(), ar);
+        }
+
+        TEST_CASE("dictionary type mismatch")
+        {
+            const auto ar = make_dictionary_array();
+            using view_type = typed_dictionary_view<std::uint32_t, primitive_array<std::int32_t>>;
+            CHECK_THROWS_AS(view_type{ar}, std::runtime_error);
+        }
+    }
+}
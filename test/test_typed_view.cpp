@@ -0,0 +1,109 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/layout/primitive_array.hpp"
+#include "sparrow/layout/typed_view.hpp"
+
+#include "../test/external_array_data_creation.hpp"
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    TEST_SUITE("typed_view")
+    {
+        TEST_CASE("validity_view")
+        {
+            const std::uint8_t bits[] = {0b10110101, 0b00000011};
+
+            SUBCASE("no offset")
+            {
+                validity_view v(bits, 0, 10, 4);
+                CHECK_EQ(v.size(), 10);
+                CHECK_FALSE(v.all_valid());
+                const std::vector<bool> expected = {true, false, true, false, true, true, false, true, true, true};
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                {
+                    CHECK_EQ(v[i], expected[i]);
+                }
+            }
+
+            SUBCASE("with offset")
+            {
+                validity_view v(bits, 3, 7, 2);
+                const std::vector<bool> expected = {false, true, true, false, true, true, true};
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                {
+                    CHECK_EQ(v[i], expected[i]);
+                }
+            }
+
+            SUBCASE("without bitmap")
+            {
+                validity_view v(nullptr, 0, 5, 3);
+                CHECK(v.all_valid());
+                CHECK_EQ(v.null_count(), 0);
+                for (std::size_t i = 0; i < v.size(); ++i)
+                {
+                    CHECK(v[i]);
+                }
+            }
+        }
+
+        TEST_CASE("from primitive_array")
+        {
+            std::vector<std::int32_t> values = {1, 2, 3, 4, 5};
+            primitive_array<std::int32_t> ar(values, std::vector<std::size_t>{1, 3});
+            typed_view<std::int32_t> view(ar);
+
+            REQUIRE_EQ(view.size(), ar.size());
+            CHECK_FALSE(view.empty());
+            CHECK_EQ(view.data(), ar.data());
+            CHECK_FALSE(view.validity().all_valid());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(view.has_value(i), ar[i].has_value());
+                CHECK_EQ(view.value(i), values[i]);
+                CHECK_EQ(view.values()[i], values[i]);
+            }
+        }
+
+        TEST_CASE("from array")
+        {
+            constexpr std::size_t size = 10;
+            constexpr std::size_t offset = 2;
+            ArrowSchema sc{};
+            ArrowArray ar{};
+            test::fill_schema_and_array<std::int64_t>(sc, ar, size, offset, {3, 7});
+            array arr(std::move(ar), std::move(sc));
+            const auto& typed = arr.as<primitive_array<std::int64_t>>();
+
+            typed_view<std::int64_t> view(arr);
+            REQUIRE_EQ(view.size(), size - offset);
+            for (std::size_t i = 0; i < view.size(); ++i)
+            {
+                CHECK_EQ(view.has_value(i), typed[i].has_value());
+                CHECK_EQ(view.value(i), typed[i].get());
+            }
+            CHECK_FALSE(view.has_value(1));
+            CHECK_FALSE(view.has_value(5));
+
+            CHECK_THROWS_AS(typed_view<std::int32_t>{arr}, std::runtime_error);
+        }
+    }
+}
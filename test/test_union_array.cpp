@@ -21,6 +21,8 @@
 #include "../test/external_array_data_creation.hpp"
 
 #include "sparrow/layout/union_array.hpp"
+#include "sparrow/layout/union_kernels.hpp"
+#include "sparrow/layout/variable_size_binary_array.hpp"
 
 namespace sparrow
 {
@@ -185,6 +187,58 @@ namespace sparrow
                 }, uarr[3]);
                 
             }
+
+            SUBCASE("partition")
+            {
+                const union_partition partition = uarr.partition();
+                REQUIRE_EQ(partition.children_count(), 2);
+                CHECK_EQ(uarr.child_index(1), 1);
+                CHECK_EQ(std::vector<std::size_t>(partition.rows_of(0).begin(), partition.rows_of(0).end()), std::vector<std::size_t>{0, 2});
+                CHECK_EQ(std::vector<std::size_t>(partition.rows_of(1).begin(), partition.rows_of(1).end()), std::vector<std::size_t>{1, 3});
+                CHECK_EQ(std::vector<std::size_t>(partition.indices_of(1).begin(), partition.indices_of(1).end()), std::vector<std::size_t>{1, 3});
+            }
+
+            SUBCASE("union_scan")
+            {
+                float float_sum = 0.f;
+                std::size_t uint16_count = 0;
+                union_scan(uarr, [&](const auto& batch) {
+                    using child_type = std::decay_t<decltype(batch.child)>;
+                    CHECK_FALSE(batch.contiguous());
+                    if constexpr (std::is_same_v<child_type, primitive_array<float>>)
+                    {
+                        CHECK_EQ(batch.child_index, 0);
+                        for (std::size_t index : batch.indices)
+                        {
+                            float_sum += batch.child[index].value();
+                        }
+                    }
+                    else if constexpr (std::is_same_v<child_type, primitive_array<std::uint16_t>>)
+                    {
+                        uint16_count += batch.size();
+                    }
+                    else
+                    {
+                        CHECK(false);
+                    }
+                });
+                CHECK_EQ(float_sum, 2.0f);
+                CHECK_EQ(uint16_count, 2);
+            }
+
+            SUBCASE("split_union")
+            {
+                const std::vector<array> children = split_union(uarr);
+                REQUIRE_EQ(children.size(), 2);
+                const auto& floats = children[0].as<primitive_array<float>>();
+                REQUIRE_EQ(floats.size(), 2);
+                CHECK_EQ(floats[0].value(), 0.0f);
+                CHECK_EQ(floats[1].value(), 2.0f);
+                const auto& uints = children[1].as<primitive_array<std::uint16_t>>();
+                REQUIRE_EQ(uints.size(), 2);
+                CHECK_EQ(uints[0].value(), 1);
+                CHECK_EQ(uints[1].value(), 3);
+            }
         }
 
         TEST_CASE("dense_union")
@@ -230,6 +284,31 @@ namespace sparrow
                 }
             }
 
+            SUBCASE("union_scan")
+            {
+                std::size_t batches = 0;
+                union_scan(uarr, [&](const auto& batch) {
+                    ++batches;
+                    CHECK(batch.contiguous());
+                    CHECK_EQ(batch.size(), 2);
+                    CHECK_EQ(batch.indices.front(), 0);
+                });
+                CHECK_EQ(batches, 2);
+            }
+
+            SUBCASE("split_union")
+            {
+                const std::vector<array> children = split_union(uarr);
+                REQUIRE_EQ(children.size(), 2);
+                const auto& floats = children[0].as<primitive_array<float>>();
+                REQUIRE_EQ(floats.size(), 2);
+                CHECK_EQ(floats[0].value(), 0.0f);
+                CHECK_EQ(floats[1].value(), 1.0f);
+                const auto& uints = children[1].as<primitive_array<std::uint16_t>>();
+                REQUIRE_EQ(uints.size(), 2);
+                CHECK_EQ(uints[1].value(), 1);
+            }
+
             // 0 
             std::visit([](auto&& arg) {
                 using inner_type = std::decay_t< typename std::decay_t<decltype(arg)>::value_type>;
@@ -286,6 +365,71 @@ namespace sparrow
             
             }, uarr[3]);
         }
+
+        TEST_CASE("split_union slices")
+        {
+            std::vector<ArrowArray> children_arrays(2);
+            std::vector<ArrowSchema> children_schemas(2);
+            test::fill_schema_and_array<float>(children_schemas[0], children_arrays[0], 5, 0, {2});
+            test::fill_schema_and_array<std::string>(children_schemas[1], children_arrays[1], 5, 0, {3});
+
+            // Elements 1 to 3 of the floats and 2 to 3 of the strings.
+            std::vector<std::uint8_t> type_ids = {3, 3, 4, 3, 4};
+            std::vector<std::int32_t> offsets = {1, 2, 2, 3, 3};
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            test::fill_schema_and_array_for_dense_union(
+                schema, arr, std::move(children_schemas), std::move(children_arrays), type_ids, offsets, "+ud:3,4"
+            );
+            const dense_union_array uarr(arrow_proxy(std::move(arr), std::move(schema)));
+
+            const std::vector<array> children = split_union(uarr);
+            REQUIRE_EQ(children.size(), 2);
+            const auto& floats = children[0].as<primitive_array<float>>();
+            REQUIRE_EQ(floats.size(), 3);
+            CHECK_EQ(floats[0].value(), 1.0f);
+            CHECK_FALSE(floats[1].has_value());
+            CHECK_EQ(floats[2].value(), 3.0f);
+
+            const std::vector<std::string> words = test::make_testing_words(5);
+            const auto& strings = children[1].as<string_array>();
+            REQUIRE_EQ(strings.size(), 2);
+            CHECK_EQ(strings[0].value(), words[2]);
+            CHECK_FALSE(strings[1].has_value());
+        }
+
+        TEST_CASE("split_union out of range offsets")
+        {
+            std::vector<ArrowArray> children_arrays(2);
+            std::vector<ArrowSchema> children_schemas(2);
+            test::fill_schema_and_array<float>(children_schemas[0], children_arrays[0], 3, 0, {});
+            test::fill_schema_and_array<std::string>(children_schemas[1], children_arrays[1], 3, 0, {});
+
+            // Offsets 5 and 9 are past the end of the children; the gathered
+            // elements are null instead of being read out of bounds.
+            std::vector<std::uint8_t> type_ids = {3, 3, 3, 4, 4};
+            std::vector<std::int32_t> offsets = {0, 5, 2, 9, 1};
+            ArrowArray arr{};
+            ArrowSchema schema{};
+            test::fill_schema_and_array_for_dense_union(
+                schema, arr, std::move(children_schemas), std::move(children_arrays), type_ids, offsets, "+ud:3,4"
+            );
+            const dense_union_array uarr(arrow_proxy(std::move(arr), std::move(schema)));
+
+            const std::vector<array> children = split_union(uarr);
+            REQUIRE_EQ(children.size(), 2);
+            const auto& floats = children[0].as<primitive_array<float>>();
+            REQUIRE_EQ(floats.size(), 3);
+            CHECK_EQ(floats[0].value(), 0.0f);
+            CHECK_FALSE(floats[1].has_value());
+            CHECK_EQ(floats[2].value(), 2.0f);
+
+            const std::vector<std::string> words = test::make_testing_words(3);
+            const auto& strings = children[1].as<string_array>();
+            REQUIRE_EQ(strings.size(), 2);
+            CHECK_FALSE(strings[0].has_value());
+            CHECK_EQ(strings[1].value(), words[1]);
+        }
     }
 
 
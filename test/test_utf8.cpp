@@ -0,0 +1,100 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "sparrow/utils/utf8.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        std::size_t find_invalid(std::string_view str)
+        {
+            return find_invalid_utf8(reinterpret_cast<const std::uint8_t*>(str.data()), str.size());
+        }
+    }
+
+    TEST_SUITE("utf8")
+    {
+        TEST_CASE("valid")
+        {
+            CHECK(is_valid_utf8(""));
+            CHECK(is_valid_utf8("ascii only"));
+            CHECK(is_valid_utf8("a long ascii string that spans several blocks of eight bytes"));
+            CHECK(is_valid_utf8("caf\xC3\xA9"));                       // U+00E9
+            CHECK(is_valid_utf8("\xE2\x82\xAC 10"));                   // U+20AC
+            CHECK(is_valid_utf8("\xF0\x9F\x98\x80"));                  // U+1F600
+            CHECK(is_valid_utf8("\xF4\x8F\xBF\xBF"));                  // U+10FFFF
+            CHECK(is_valid_utf8("\xED\x9F\xBF"));                      // U+D7FF
+            CHECK(is_valid_utf8("abcdefgh\xC3\xA9" "abcdefgh\xE2\x82\xAC"));
+        }
+
+        TEST_CASE("invalid")
+        {
+            SUBCASE("unexpected continuation byte")
+            {
+                CHECK_FALSE(is_valid_utf8("\x80"));
+                CHECK_EQ(find_invalid("abc\xBF"), 3u);
+            }
+
+            SUBCASE("truncated sequence")
+            {
+                CHECK_FALSE(is_valid_utf8("\xC3"));
+                CHECK_FALSE(is_valid_utf8("\xE2\x82"));
+                CHECK_EQ(find_invalid("abcdefghij\xF0\x9F\x98"), 10u);
+            }
+
+            SUBCASE("overlong encoding")
+            {
+                CHECK_FALSE(is_valid_utf8("\xC0\xAF"));
+                CHECK_FALSE(is_valid_utf8("\xC1\xBF"));
+                CHECK_FALSE(is_valid_utf8("\xE0\x80\xAF"));
+                CHECK_FALSE(is_valid_utf8("\xF0\x80\x80\xAF"));
+            }
+
+            SUBCASE("surrogates")
+            {
+                CHECK_FALSE(is_valid_utf8("\xED\xA0\x80"));
+                CHECK_FALSE(is_valid_utf8("\xED\xBF\xBF"));
+            }
+
+            SUBCASE("out of range")
+            {
+                CHECK_FALSE(is_valid_utf8("\xF4\x90\x80\x80"));
+                CHECK_FALSE(is_valid_utf8("\xF5\x80\x80\x80"));
+                CHECK_FALSE(is_valid_utf8("\xFF"));
+            }
+
+            SUBCASE("invalid continuation byte")
+            {
+                CHECK_FALSE(is_valid_utf8("\xE2\x28\xA1"));
+                CHECK_FALSE(is_valid_utf8("\xF0\x9F\x28\x80"));
+            }
+        }
+
+        TEST_CASE("is_utf8_continuation_byte")
+        {
+            CHECK(is_utf8_continuation_byte(0x80));
+            CHECK(is_utf8_continuation_byte(0xBF));
+            CHECK_FALSE(is_utf8_continuation_byte(0x7F));
+            CHECK_FALSE(is_utf8_continuation_byte(0xC3));
+        }
+    }
+}
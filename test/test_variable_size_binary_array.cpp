@@ -17,7 +17,12 @@
 
 #include "../test/external_array_data_creation.hpp"
 #include "doctest/doctest.h"
+#include "sparrow/array.hpp"
+#include "sparrow/array_factory.hpp"
+#include "sparrow/layout/array_access.hpp"
+#include "sparrow/layout/borrowed_proxy.hpp"
 #include "sparrow/layout/variable_size_binary_array.hpp"
+#include "sparrow/layout/variable_size_binary_array_builder.hpp"
 
 
 namespace sparrow
@@ -39,7 +44,7 @@ namespace sparrow
     private:
 
         static_assert(std::same_as<layout_type::inner_value_type, std::string>);
-        // static_assert(std::same_as<layout_type::inner_reference, sparrow::variable_size_binary_reference<layout_type>>);
+        static_assert(std::same_as<layout_type::inner_reference, sparrow::variable_size_binary_reference<layout_type>>);
         static_assert(std::same_as<layout_type::inner_const_reference, std::string_view>);
         using const_value_iterator = layout_type::const_value_iterator;
         static_assert(std::same_as<const_value_iterator::value_type, std::string>);
@@ -132,18 +137,42 @@ namespace sparrow
                 REQUIRE(cref8.has_value());
                 CHECK_EQ(cref8.value(), "now");
             }
-        }
 
-        // TEST_CASE("value_iterator")
-        // {
-        //     SUBCASE("ordering")
-        //     {
-        //     }
+            SUBCASE("mutable")
+            {
+                layout_type array(std::move(m_arrow_proxy));
+                // Values of the same size are overwritten in place
+                const auto* data_before = array.get_arrow_proxy().buffers()[2].data();
+                array[0].value() = "once";
+                CHECK_EQ(array.get_arrow_proxy().buffers()[2].data(), data_before);
+                array[2].value() = "spacetime";
+                array[8].value() = std::string("");
+                CHECK_EQ(array[0].value(), "once");
+                CHECK_FALSE(array[1].has_value());
+                CHECK_EQ(array[2].value(), "spacetime");
+                CHECK_EQ(array[3].value(), "I");
+                CHECK_EQ(array[7].value(), "code");
+                CHECK_EQ(array[8].value(), "");
+
+                array[3].value() = array[5].value();
+                CHECK_EQ(array[3].value(), "writing");
+                CHECK_EQ(array[5].value(), "writing");
+                CHECK_EQ(array.size(), m_length - m_offset);
+            }
+        }
 
-        //     SUBCASE("equality")
-        //     {
-        //     }
-        // }
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "mutable iterator")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            auto it = array.begin();
+            CHECK_EQ(it->value(), "upon");
+            ++it;
+            it->get() = "an";
+            CHECK_EQ(it->get(), "an");
+            ++it;
+            CHECK_EQ(it->value(), "time");
+            CHECK_EQ(array[1].get(), "an");
+        }
 
         TEST_CASE_FIXTURE(variable_size_binary_fixture, "const_value_iterator")
         {
@@ -240,5 +269,417 @@ namespace sparrow
 
             CHECK_EQ(it, array.end());
         }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "resize")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const auto initial_size = array.size();
+            array.resize(initial_size + 2, make_nullable<std::string>("again"));
+            REQUIRE_EQ(array.size(), initial_size + 2);
+            CHECK_EQ(array[initial_size - 1].value(), "now");
+            CHECK_EQ(array[initial_size].value(), "again");
+            CHECK_EQ(array[initial_size + 1].value(), "again");
+
+            array.resize(3, make_nullable<std::string>("unused"));
+            REQUIRE_EQ(array.size(), 3);
+            CHECK_EQ(array[0].value(), "upon");
+            CHECK_FALSE(array[1].has_value());
+            CHECK_EQ(array[2].value(), "time");
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "insert")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const auto initial_size = array.size();
+
+            SUBCASE("single value")
+            {
+                const auto it = array.insert(sparrow::next(array.cbegin(), 1), make_nullable<std::string>("the"));
+                CHECK_EQ(it, sparrow::next(array.begin(), 1));
+                REQUIRE_EQ(array.size(), initial_size + 1);
+                CHECK_EQ(array[0].value(), "upon");
+                CHECK_EQ(array[1].value(), "the");
+                CHECK_FALSE(array[2].has_value());
+                CHECK_EQ(array[3].value(), "time");
+                CHECK_EQ(array[9].value(), "now");
+            }
+
+            SUBCASE("repeated value")
+            {
+                array.insert(array.cbegin(), make_nullable<std::string>("la"), 3);
+                REQUIRE_EQ(array.size(), initial_size + 3);
+                CHECK_EQ(array[0].value(), "la");
+                CHECK_EQ(array[1].value(), "la");
+                CHECK_EQ(array[2].value(), "la");
+                CHECK_EQ(array[3].value(), "upon");
+            }
+
+            SUBCASE("range")
+            {
+                const std::vector<nullable<std::string>> values{
+                    make_nullable<std::string>("and"),
+                    make_nullable<std::string>("then", false),
+                    make_nullable<std::string>("again")
+                };
+                array.insert(array.cend(), values);
+                REQUIRE_EQ(array.size(), initial_size + 3);
+                CHECK_EQ(array[initial_size - 1].value(), "now");
+                CHECK_EQ(array[initial_size].value(), "and");
+                CHECK_FALSE(array[initial_size + 1].has_value());
+                CHECK_EQ(array[initial_size + 2].value(), "again");
+            }
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "erase")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const auto initial_size = array.size();
+
+            SUBCASE("single value")
+            {
+                const auto it = array.erase(array.cbegin());
+                CHECK_EQ(it, array.begin());
+                REQUIRE_EQ(array.size(), initial_size - 1);
+                CHECK_FALSE(array[0].has_value());
+                CHECK_EQ(array[1].value(), "time");
+                CHECK_EQ(array[7].value(), "now");
+            }
+
+            SUBCASE("range")
+            {
+                array.erase(sparrow::next(array.cbegin(), 2), sparrow::next(array.cbegin(), 6));
+                REQUIRE_EQ(array.size(), initial_size - 4);
+                CHECK_EQ(array[0].value(), "upon");
+                CHECK_FALSE(array[1].has_value());
+                CHECK_EQ(array[2].value(), "clean");
+                CHECK_EQ(array[3].value(), "code");
+                CHECK_EQ(array[4].value(), "now");
+            }
+        }
+
+        TEST_CASE("insert and erase on a sliced array")
+        {
+            string_array_builder builder;
+            for (int i = 0; i < 16; ++i)
+            {
+                if (i == 2 || i == 9 || i == 12)
+                {
+                    builder.push_back(nullval);
+                }
+                else
+                {
+                    builder.push_back("v" + std::to_string(i));
+                }
+            }
+            arrow_proxy proxy = detail::array_access::extract_arrow_proxy(builder.finish());
+            // The slice starts in the middle of the second byte of the bitmap.
+            proxy.set_offset(9);
+            proxy.set_length(5);
+            // Elements: null, v10, v11, null, v13
+            string_array ar(std::move(proxy));
+
+            const auto check_elements = [&ar](const std::vector<nullable<std::string>>& expected)
+            {
+                REQUIRE_EQ(ar.size(), expected.size());
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                {
+                    REQUIRE_EQ(ar[i].has_value(), expected[i].has_value());
+                    if (expected[i].has_value())
+                    {
+                        CHECK_EQ(ar[i].value(), expected[i].value());
+                    }
+                }
+            };
+
+            SUBCASE("insert")
+            {
+                const auto it = ar.insert(sparrow::next(ar.cbegin(), 1), make_nullable<std::string>("new"));
+                CHECK_EQ(it, sparrow::next(ar.begin(), 1));
+                check_elements({nullval, "new", "v10", "v11", nullval, "v13"});
+
+                ar.insert(ar.cend(), make_nullable<std::string>("x", false), 2);
+                check_elements({nullval, "new", "v10", "v11", nullval, "v13", nullval, nullval});
+            }
+
+            SUBCASE("erase")
+            {
+                const auto it = ar.erase(sparrow::next(ar.cbegin(), 1));
+                CHECK_EQ(it, sparrow::next(ar.begin(), 1));
+                check_elements({nullval, "v11", nullval, "v13"});
+
+                ar.erase(ar.cbegin(), sparrow::next(ar.cbegin(), 2));
+                check_elements({nullval, "v13"});
+            }
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "push_back")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const auto initial_size = array.size();
+            array.push_back(make_nullable<std::string>("again"));
+            array.push_back(make_nullable<std::string>("and", false));
+            REQUIRE_EQ(array.size(), initial_size + 2);
+            CHECK_EQ(array[initial_size].value(), "again");
+            CHECK_FALSE(array[initial_size + 1].has_value());
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "pop_back")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const auto initial_size = array.size();
+            array.pop_back();
+            REQUIRE_EQ(array.size(), initial_size - 1);
+            CHECK_EQ(array[initial_size - 2].value(), "code");
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "apply_edits")
+        {
+            layout_type array(std::move(m_arrow_proxy));
+            const auto initial_size = array.size();
+
+            SUBCASE("empty")
+            {
+                layout_type::edits_type edits;
+                CHECK(edits.empty());
+                array.apply_edits(edits);
+                CHECK_EQ(array[0].value(), "upon");
+                CHECK_EQ(array.size(), initial_size);
+            }
+
+            SUBCASE("point updates")
+            {
+                layout_type::edits_type edits;
+                edits.set(8, "later")
+                    .set(0, std::string("once"))
+                    .set(1, "an")
+                    .set(3, nullval)
+                    .set(5, std::string_view(""))
+                    .set(8, "tomorrow");
+                CHECK_EQ(edits.size(), 6);
+                array.apply_edits(edits);
+
+                REQUIRE_EQ(array.size(), initial_size);
+                CHECK_EQ(array[0].value(), "once");
+                REQUIRE(array[1].has_value());
+                CHECK_EQ(array[1].value(), "an");
+                CHECK_EQ(array[2].value(), "time");
+                CHECK_FALSE(array[3].has_value());
+                CHECK_FALSE(array[4].has_value());
+                CHECK_EQ(array[5].value(), "");
+                CHECK_EQ(array[6].value(), "clean");
+                CHECK_EQ(array[7].value(), "code");
+                CHECK_EQ(array[8].value(), "tomorrow");
+                CHECK_EQ(array.get_arrow_proxy().null_count(), 2);
+
+                edits.clear();
+                CHECK(edits.empty());
+            }
+
+            SUBCASE("null count")
+            {
+                layout_type::edits_type edits;
+                edits.set(0, nullval).set(2, nullval).set(4, "once");
+                array.apply_edits(edits);
+                CHECK_FALSE(array[0].has_value());
+                CHECK_FALSE(array[1].has_value());
+                CHECK_FALSE(array[2].has_value());
+                CHECK_EQ(array[4].value(), "once");
+                CHECK_EQ(array.get_arrow_proxy().null_count(), 3);
+
+                edits.clear();
+                edits.set(0, "a").set(1, "b").set(2, "c");
+                array.apply_edits(edits);
+                CHECK_EQ(array[1].value(), "b");
+                CHECK_EQ(array.get_arrow_proxy().null_count(), 0);
+            }
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "validate_buffers")
+        {
+            SUBCASE("valid")
+            {
+                const layout_type array(m_arrow_proxy, validate_buffers);
+                CHECK(array.is_validated());
+                CHECK(array.get_arrow_proxy().flags() == m_arrow_proxy.flags());
+
+                const layout_type copy(array);
+                CHECK(copy.is_validated());
+            }
+
+            SUBCASE("reset on modification")
+            {
+                layout_type array(m_arrow_proxy, validate_buffers);
+                REQUIRE(array.is_validated());
+                array[0].value() = "once";
+                CHECK_FALSE(array.is_validated());
+
+                layout_type edited(m_arrow_proxy, validate_buffers);
+                layout_type::edits_type edits;
+                edits.set(0, "once");
+                edited.apply_edits(edits);
+                CHECK_FALSE(edited.is_validated());
+            }
+
+            SUBCASE("not requested")
+            {
+                const layout_type array(m_arrow_proxy);
+                CHECK_FALSE(array.is_validated());
+            }
+
+            SUBCASE("invalid UTF-8")
+            {
+                // First byte of "time"
+                const auto value_begin = m_arrow_proxy.buffers()[1].data<std::int32_t>()[m_offset + 2];
+                m_arrow_proxy.buffers()[2].data<std::uint8_t>()[value_begin] = 0xFF;
+                CHECK_THROWS_AS(layout_type(m_arrow_proxy, validate_buffers), std::invalid_argument);
+                m_arrow_proxy.set_data_type(data_type::BINARY);
+                CHECK_NOTHROW(binary_array(m_arrow_proxy, validate_buffers));
+            }
+
+            SUBCASE("invalid UTF-8 in null value")
+            {
+                // First byte of "a", which is null
+                const auto value_begin = m_arrow_proxy.buffers()[1].data<std::int32_t>()[m_offset + 1];
+                m_arrow_proxy.buffers()[2].data<std::uint8_t>()[value_begin] = 0xFF;
+                const layout_type array(m_arrow_proxy, validate_buffers);
+                CHECK(array.is_validated());
+            }
+
+            SUBCASE("decreasing offsets")
+            {
+                auto* offsets = m_arrow_proxy.buffers()[1].data<std::int32_t>();
+                offsets[m_offset + 3] = offsets[m_offset + 1];
+                CHECK_THROWS_AS(layout_type(m_arrow_proxy, validate_buffers), std::invalid_argument);
+            }
+        }
+
+        TEST_CASE("data_type")
+        {
+            CHECK_EQ(format_to_data_type("u"), data_type::STRING);
+            CHECK_EQ(format_to_data_type("U"), data_type::LARGE_STRING);
+            CHECK_EQ(format_to_data_type("z"), data_type::BINARY);
+            CHECK_EQ(format_to_data_type("Z"), data_type::LARGE_BINARY);
+            CHECK_EQ(data_type_to_format(data_type::LARGE_STRING), "U");
+            CHECK_EQ(data_type_to_format(data_type::LARGE_BINARY), "Z");
+
+            CHECK_EQ(detail::get_data_type_from_array<string_array>::get(), data_type::STRING);
+            CHECK_EQ(detail::get_data_type_from_array<big_string_array>::get(), data_type::LARGE_STRING);
+            CHECK_EQ(detail::get_data_type_from_array<binary_array>::get(), data_type::BINARY);
+            CHECK_EQ(detail::get_data_type_from_array<big_binary_array>::get(), data_type::LARGE_BINARY);
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "binary_array")
+        {
+            m_arrow_proxy.set_data_type(data_type::BINARY);
+            const binary_array ar(m_arrow_proxy);
+            REQUIRE(ar[0].has_value());
+            const std::span<const byte_t> value = ar[0].value();
+            CHECK_EQ(value.size(), 4u);
+            CHECK_EQ(static_cast<char>(value[0]), 'u');
+
+            const big_binary_array big_ar = to_large_offsets(ar);
+            CHECK_EQ(big_ar.get_arrow_proxy().data_type(), data_type::LARGE_BINARY);
+            CHECK_EQ(big_ar[0].value().size(), 4u);
+
+            binary_array mutable_ar(m_arrow_proxy);
+            const std::vector<byte_t> bytes{byte_t(1), byte_t(2)};
+            binary_array::edits_type edits;
+            edits.set(0, bytes);
+            mutable_ar.apply_edits(edits);
+            CHECK_EQ(mutable_ar[0].value().size(), 2u);
+            mutable_ar.push_back(make_nullable(bytes));
+            CHECK_EQ(mutable_ar[mutable_ar.size() - 1].value().size(), 2u);
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "to_large_offsets")
+        {
+            const layout_type ar(m_arrow_proxy);
+            const big_string_array big_ar = to_large_offsets(ar);
+            CHECK_EQ(big_ar.get_arrow_proxy().data_type(), data_type::LARGE_STRING);
+            CHECK_EQ(big_ar.get_arrow_proxy().format(), "U");
+            REQUIRE_EQ(big_ar.size(), ar.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(big_ar[i], ar[i]);
+            }
+            CHECK(fits_small_offsets(big_ar));
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "to_small_offsets")
+        {
+            const layout_type ar(m_arrow_proxy);
+            big_string_array big_ar = to_large_offsets(layout_type(m_arrow_proxy));
+            const auto* data_ptr = big_ar.get_arrow_proxy().buffers()[2].data();
+
+            const layout_type small_ar = to_small_offsets(std::move(big_ar));
+            CHECK_EQ(small_ar.get_arrow_proxy().data_type(), data_type::STRING);
+            // The data buffer is moved, not copied
+            CHECK_EQ(small_ar.get_arrow_proxy().buffers()[2].data(), data_ptr);
+            CHECK_EQ(small_ar, ar);
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "fits_small_offsets")
+        {
+            big_string_array big_ar = to_large_offsets(layout_type(m_arrow_proxy));
+            auto& proxy = big_ar.get_arrow_proxy();
+            const std::size_t last = proxy.length() + proxy.offset();
+            // Fakes a huge last value without allocating the data; the array
+            // is not read after this point.
+            proxy.buffers()[1].data<std::int64_t>()[last] = std::int64_t(1) << 32;
+            CHECK_FALSE(fits_small_offsets(big_ar));
+            CHECK_THROWS_AS(to_small_offsets(std::move(big_ar)), std::runtime_error);
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "array_factory")
+        {
+            big_string_array big_ar = to_large_offsets(layout_type(m_arrow_proxy));
+            const auto w = array_factory(big_ar.get_arrow_proxy());
+            CHECK_EQ(w->data_type(), data_type::LARGE_STRING);
+            CHECK_EQ(w->kind(), array_kind::LARGE_STRING);
+
+            array ar(std::move(big_ar));
+            REQUIRE_NE(ar.try_as<big_string_array>(), nullptr);
+            CHECK_EQ(ar.try_as<string_array>(), nullptr);
+            CHECK_EQ(ar.as<big_string_array>()[0].value(), "upon");
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "binary array_factory")
+        {
+            arrow_proxy proxy(m_arrow_proxy);
+            proxy.set_data_type(data_type::BINARY);
+            const binary_array binary_ar(std::move(proxy));
+            const auto w = array_factory(binary_ar.get_arrow_proxy());
+            CHECK_EQ(w->kind(), array_kind::BINARY);
+
+            const array ar(to_large_offsets(binary_ar));
+            REQUIRE_NE(ar.try_as<big_binary_array>(), nullptr);
+            CHECK_EQ(ar.try_as<binary_array>(), nullptr);
+            const auto value = ar.as<big_binary_array>()[0].value();
+            REQUIRE_EQ(value.size(), 4u);
+            CHECK_EQ(static_cast<char>(value[0]), 'u');
+            CHECK_EQ(ar.size(), binary_ar.size());
+            CHECK_EQ(ar[0].has_value(), binary_ar[0].has_value());
+        }
+
+        TEST_CASE_FIXTURE(variable_size_binary_fixture, "offsets conversion of external buffers")
+        {
+            const layout_type ar(m_arrow_proxy);
+            arrow_proxy external = detail::make_borrowed_proxy(detail::borrow_parts(m_arrow_proxy));
+            REQUIRE_FALSE(external.is_created_with_sparrow());
+            const auto* data_ptr = m_arrow_proxy.buffers()[2].data();
+
+            big_string_array big_ar = to_large_offsets(layout_type(std::move(external)));
+            // The data buffer is shared, not copied
+            CHECK_EQ(big_ar.get_arrow_proxy().buffers()[2].data(), data_ptr);
+            REQUIRE_EQ(big_ar.size(), ar.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(big_ar[i], ar[i]);
+            }
+
+            const layout_type small_ar = to_small_offsets(std::move(big_ar));
+            CHECK_EQ(small_ar.get_arrow_proxy().buffers()[2].data(), data_ptr);
+            CHECK_EQ(small_ar, ar);
+        }
     }
 }
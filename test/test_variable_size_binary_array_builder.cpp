@@ -0,0 +1,135 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sparrow/layout/variable_size_binary_array_builder.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    using string_builder_types = std::tuple<string_array_builder, big_string_array_builder>;
+
+    TEST_SUITE("variable_size_binary_array_builder")
+    {
+        TEST_CASE_TEMPLATE_DEFINE("push_back", B, push_back_id)
+        {
+            B builder;
+            CHECK_EQ(builder.size(), 0u);
+
+            std::vector<std::string> expected;
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                expected.push_back(std::string(i % 17, static_cast<char>('a' + i % 26)));
+                builder.push_back(expected.back());
+            }
+            CHECK_EQ(builder.size(), expected.size());
+            CHECK_EQ(builder.null_count(), 0u);
+
+            const auto ar = builder.finish();
+            CHECK_EQ(builder.size(), 0u);
+            REQUIRE_EQ(ar.size(), expected.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                REQUIRE(ar[i].has_value());
+                CHECK_EQ(ar[i].value(), expected[i]);
+            }
+        }
+
+        TEST_CASE_TEMPLATE_APPLY(push_back_id, string_builder_types);
+
+        TEST_CASE("nulls")
+        {
+            string_array_builder builder;
+            for (std::size_t i = 0; i < 20; ++i)
+            {
+                if (i == 11 || i == 16 || i == 17)
+                {
+                    builder.push_back(nullval);
+                }
+                else
+                {
+                    builder.push_back(std::to_string(i));
+                }
+            }
+            CHECK_EQ(builder.null_count(), 3u);
+
+            const auto ar = builder.finish();
+            CHECK_EQ(ar.get_arrow_proxy().null_count(), 3);
+            REQUIRE_EQ(ar.size(), 20u);
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                if (i == 11 || i == 16 || i == 17)
+                {
+                    CHECK_FALSE(ar[i].has_value());
+                }
+                else
+                {
+                    REQUIRE(ar[i].has_value());
+                    CHECK_EQ(ar[i].value(), std::to_string(i));
+                }
+            }
+        }
+
+        TEST_CASE("reserve")
+        {
+            string_array_builder builder;
+            builder.reserve(3, 12);
+            builder.push_back("upon");
+            builder.push_back(nullval);
+            builder.push_back("a time");
+            CHECK_EQ(builder.data_size(), 10u);
+
+            const auto ar = builder.finish();
+            REQUIRE_EQ(ar.size(), 3u);
+            CHECK_EQ(ar[0].value(), "upon");
+            CHECK_FALSE(ar[1].has_value());
+            CHECK_EQ(ar[2].value(), "a time");
+            CHECK_EQ(ar.get_arrow_proxy().buffers()[2].size(), 10u);
+        }
+
+        TEST_CASE("reuse after finish")
+        {
+            string_array_builder builder;
+            builder.push_back(nullval);
+            builder.push_back("first");
+            [[maybe_unused]] const auto ar = builder.finish();
+
+            builder.push_back("second");
+            const auto ar2 = builder.finish();
+            REQUIRE_EQ(ar2.size(), 1u);
+            CHECK_EQ(ar2[0].value(), "second");
+            CHECK_EQ(ar2.get_arrow_proxy().null_count(), 0);
+        }
+
+        TEST_CASE("binary")
+        {
+            binary_array_builder builder;
+            const std::vector<byte_t> value = {byte_t{1}, byte_t{2}, byte_t{3}};
+            builder.push_back(value);
+            builder.push_back(nullval);
+            const auto ar = builder.finish();
+            CHECK_EQ(ar.get_arrow_proxy().data_type(), data_type::BINARY);
+            REQUIRE_EQ(ar.size(), 2u);
+            CHECK_EQ(ar[0].value().size(), 3u);
+            CHECK_EQ(ar[0].value()[2], byte_t{3});
+            CHECK_FALSE(ar[1].has_value());
+        }
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/layout/variable_size_binary_kernels.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        template <class B>
+        auto make_log_array()
+        {
+            B builder;
+            builder.push_back("GET /index.html");
+            builder.push_back(nullval);
+            builder.push_back("POST /api/v1/items");
+            builder.push_back("get /img.png");
+            builder.push_back("");
+            builder.push_back("caf\xC3\xA9 au lait");
+            return builder.finish();
+        }
+
+        std::vector<bool> to_vector(const validity_bitmap& bitmap)
+        {
+            return std::vector<bool>(bitmap.begin(), bitmap.end());
+        }
+    }
+
+    TEST_SUITE("variable_size_binary_kernels")
+    {
+        TEST_CASE("starts_with")
+        {
+            const auto ar = make_log_array<string_array_builder>();
+            CHECK_EQ(to_vector(starts_with(ar, "GET")), std::vector<bool>{true, false, false, false, false, false});
+            CHECK_EQ(to_vector(starts_with(ar, "")), std::vector<bool>{true, false, true, true, true, true});
+            CHECK_EQ(
+                to_vector(starts_with(ar, "GET /index.html and more")),
+                std::vector<bool>{false, false, false, false, false, false}
+            );
+        }
+
+        TEST_CASE("ends_with")
+        {
+            const auto ar = make_log_array<big_string_array_builder>();
+            CHECK_EQ(to_vector(ends_with(ar, ".html")), std::vector<bool>{true, false, false, false, false, false});
+            CHECK_EQ(to_vector(ends_with(ar, "l")), std::vector<bool>{true, false, false, false, false, false});
+            CHECK_EQ(to_vector(ends_with(ar, "t")), std::vector<bool>{false, false, false, false, false, true});
+        }
+
+        TEST_CASE("contains")
+        {
+            const auto ar = make_log_array<string_array_builder>();
+            CHECK_EQ(to_vector(contains(ar, "/i")), std::vector<bool>{true, false, true, true, false, false});
+            CHECK_EQ(to_vector(contains(ar, "api/v1")), std::vector<bool>{false, false, true, false, false, false});
+            CHECK_EQ(to_vector(contains(ar, "\xC3\xA9")), std::vector<bool>{false, false, false, false, false, true});
+            CHECK_EQ(to_vector(contains(ar, "zzz")), std::vector<bool>{false, false, false, false, false, false});
+
+            SUBCASE("with offset")
+            {
+                auto proxy = ar.get_arrow_proxy();
+                proxy.set_offset(2);
+                proxy.set_length(ar.size() - 2);
+                const string_array shifted(std::move(proxy));
+                CHECK_EQ(to_vector(contains(shifted, "/i")), std::vector<bool>{true, true, false, false});
+            }
+        }
+
+        TEST_CASE("utf8_length")
+        {
+            const auto ar = make_log_array<string_array_builder>();
+            const primitive_array<std::int32_t> lengths = utf8_length(ar);
+            REQUIRE_EQ(lengths.size(), ar.size());
+            CHECK_EQ(lengths[0].value(), 15);
+            CHECK_FALSE(lengths[1].has_value());
+            CHECK_EQ(lengths[4].value(), 0);
+            CHECK_EQ(lengths[5].value(), 12);
+        }
+
+        TEST_CASE("substring")
+        {
+            const auto ar = make_log_array<string_array_builder>();
+            const string_array sub = substring(ar, 4, 6);
+            REQUIRE_EQ(sub.size(), ar.size());
+            CHECK_EQ(sub[0].value(), "/index");
+            CHECK_FALSE(sub[1].has_value());
+            CHECK_EQ(sub[2].value(), " /api/");
+            CHECK_EQ(sub[3].value(), "/img.p");
+            CHECK_EQ(sub[4].value(), "");
+
+            const string_array tail = substring(ar, 13);
+            CHECK_EQ(tail[0].value(), "ml");
+            CHECK_EQ(tail[3].value(), "");
+        }
+
+        TEST_CASE("substring_view")
+        {
+            auto ar = make_log_array<string_array_builder>();
+            const std::uint8_t* data = ar.get_arrow_proxy().buffers()[2].data();
+
+            SUBCASE("long values")
+            {
+                const string_view_array sub = substring_view(std::move(ar), 0, 13);
+                REQUIRE_EQ(sub.size(), 6u);
+                // The data buffer is shared with the source array
+                CHECK_EQ(sub.get_arrow_proxy().buffers()[2].data(), data);
+                CHECK_EQ(sub[0].value(), "GET /index.ht");
+                CHECK_FALSE(sub[1].has_value());
+                CHECK_EQ(sub[2].value(), "POST /api/v1/");
+                CHECK_EQ(sub[3].value(), "get /img.png");
+                CHECK_EQ(sub[4].value(), "");
+            }
+
+            SUBCASE("short values")
+            {
+                const string_view_array sub = substring_view(std::move(ar), 5, 5);
+                CHECK_EQ(sub[0].value(), "index");
+                CHECK_EQ(sub[2].value(), "/api/");
+                CHECK_EQ(sub[3].value(), "img.p");
+                CHECK_EQ(sub[5].value(), " au l");
+            }
+        }
+
+        TEST_CASE("ascii case folding")
+        {
+            const auto ar = make_log_array<string_array_builder>();
+            const string_array lower = ascii_lower(ar);
+            CHECK_EQ(lower[0].value(), "get /index.html");
+            CHECK_EQ(lower[2].value(), "post /api/v1/items");
+            CHECK_EQ(lower[5].value(), "caf\xC3\xA9 au lait");
+            // The source is left untouched
+            CHECK_EQ(ar[0].value(), "GET /index.html");
+
+            const string_array upper = ascii_upper(ar);
+            CHECK_EQ(upper[3].value(), "GET /IMG.PNG");
+            CHECK_EQ(upper[5].value(), "CAF\xC3\xA9 AU LAIT");
+
+            SUBCASE("in place")
+            {
+                auto source = make_log_array<string_array_builder>();
+                const std::uint8_t* data = source.get_arrow_proxy().buffers()[2].data();
+                const string_array res = ascii_upper(std::move(source));
+                CHECK_EQ(res.get_arrow_proxy().buffers()[2].data(), data);
+                CHECK_EQ(res[0].value(), "GET /INDEX.HTML");
+            }
+        }
+    }
+}
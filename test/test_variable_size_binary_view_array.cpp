@@ -0,0 +1,337 @@
+// Copyright 2024 Man Group Operations Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or mplied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "sparrow/array.hpp"
+#include "sparrow/array_factory.hpp"
+#include "sparrow/layout/variable_size_binary_view_array.hpp"
+
+#include "doctest/doctest.h"
+
+namespace sparrow
+{
+    namespace
+    {
+        const std::vector<std::string> words = {
+            "short",
+            "a string longer than 12 bytes",
+            "",
+            "exactly12abc",
+            "thirteen char",
+            "x",
+            "another quite long value"
+        };
+
+        buffer<std::uint8_t> make_bitmap(std::size_t size, const std::vector<std::size_t>& false_positions)
+        {
+            validity_bitmap bitmap(size, true);
+            for (const auto i : false_positions)
+            {
+                bitmap.set(i, false);
+            }
+            return std::move(bitmap).extract_storage();
+        }
+
+        // Builds a "vu" array where the long values are spread over two data buffers
+        arrow_proxy make_view_proxy(std::size_t offset, const std::vector<std::size_t>& false_positions)
+        {
+            std::vector<buffer<std::uint8_t>> data(2);
+            buffer<std::uint8_t> views(words.size() * binary_view_size);
+            for (std::size_t i = 0; i < words.size(); ++i)
+            {
+                const auto& word = words[i];
+                const auto* bytes = reinterpret_cast<const std::uint8_t*>(word.data());
+                auto& target = data[i % 2];
+                const auto data_offset = static_cast<std::int32_t>(target.size());
+                if (word.size() > binary_view_inline_capacity)
+                {
+                    target.insert(target.cend(), bytes, bytes + word.size());
+                }
+                detail::write_view(
+                    views.data() + i * binary_view_size,
+                    bytes,
+                    static_cast<std::int32_t>(word.size()),
+                    static_cast<std::int32_t>(i % 2),
+                    data_offset
+                );
+            }
+            buffer<std::uint8_t> sizes(2 * sizeof(std::int64_t));
+            const std::int64_t sizes_data[2] = {
+                static_cast<std::int64_t>(data[0].size()),
+                static_cast<std::int64_t>(data[1].size())
+            };
+            std::memcpy(sizes.data(), sizes_data, sizeof(sizes_data));
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(make_bitmap(words.size(), false_positions));
+            buffers.push_back(std::move(views));
+            buffers.push_back(std::move(data[0]));
+            buffers.push_back(std::move(data[1]));
+            buffers.push_back(std::move(sizes));
+
+            ArrowSchema schema = make_arrow_schema(
+                std::string_view("vu"),
+                std::nullopt,
+                std::nullopt,
+                std::nullopt,
+                0,
+                nullptr,
+                nullptr
+            );
+            ArrowArray arr = make_arrow_array(
+                static_cast<std::int64_t>(words.size() - offset),
+                static_cast<std::int64_t>(false_positions.size()),
+                static_cast<std::int64_t>(offset),
+                std::move(buffers),
+                0,
+                nullptr,
+                nullptr
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+
+        arrow_proxy make_string_proxy(std::size_t offset, const std::vector<std::size_t>& false_positions)
+        {
+            buffer<std::uint8_t> offsets((words.size() + 1) * sizeof(std::int32_t));
+            buffer<std::uint8_t> data(0);
+            auto* offsets_data = offsets.data<std::int32_t>();
+            offsets_data[0] = 0;
+            for (std::size_t i = 0; i < words.size(); ++i)
+            {
+                const auto* bytes = reinterpret_cast<const std::uint8_t*>(words[i].data());
+                data.insert(data.cend(), bytes, bytes + words[i].size());
+                offsets_data[i + 1] = static_cast<std::int32_t>(data.size());
+            }
+
+            std::vector<buffer<std::uint8_t>> buffers;
+            buffers.push_back(make_bitmap(words.size(), false_positions));
+            buffers.push_back(std::move(offsets));
+            buffers.push_back(std::move(data));
+
+            ArrowSchema schema = make_arrow_schema(
+                std::string_view("u"),
+                std::nullopt,
+                std::nullopt,
+                std::nullopt,
+                0,
+                nullptr,
+                nullptr
+            );
+            ArrowArray arr = make_arrow_array(
+                static_cast<std::int64_t>(words.size() - offset),
+                static_cast<std::int64_t>(false_positions.size()),
+                static_cast<std::int64_t>(offset),
+                std::move(buffers),
+                0,
+                nullptr,
+                nullptr
+            );
+            return arrow_proxy(std::move(arr), std::move(schema));
+        }
+    }
+
+    TEST_SUITE("variable_size_binary_view_array")
+    {
+        TEST_CASE("data_type")
+        {
+            CHECK_EQ(format_to_data_type("vu"), data_type::STRING_VIEW);
+            CHECK_EQ(format_to_data_type("vz"), data_type::BINARY_VIEW);
+            CHECK_EQ(data_type_to_format(data_type::STRING_VIEW), "vu");
+            CHECK_EQ(data_type_to_format(data_type::BINARY_VIEW), "vz");
+        }
+
+        TEST_CASE("buffers")
+        {
+            const arrow_proxy proxy = make_view_proxy(0, {});
+            REQUIRE_EQ(proxy.buffers().size(), 5u);
+            CHECK_EQ(proxy.buffers()[1].size(), words.size() * binary_view_size);
+            CHECK_EQ(proxy.buffers()[2].size(), words[4].size() + words[6].size());
+            CHECK_EQ(proxy.buffers()[3].size(), words[1].size());
+            CHECK_EQ(proxy.buffers()[4].size(), 2 * sizeof(std::int64_t));
+        }
+
+        TEST_CASE("operator[]")
+        {
+            const std::size_t offset = 1;
+            const string_view_array ar(make_view_proxy(offset, {3}));
+            REQUIRE_EQ(ar.size(), words.size() - offset);
+            CHECK_EQ(ar.data_buffer_count(), 2u);
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                if (i + offset == 3)
+                {
+                    CHECK_FALSE(ar[i].has_value());
+                }
+                else
+                {
+                    REQUIRE(ar[i].has_value());
+                    CHECK_EQ(ar[i].value(), words[i + offset]);
+                }
+            }
+        }
+
+        TEST_CASE("iterator")
+        {
+            const string_view_array ar(make_view_proxy(0, {}));
+            std::size_t i = 0;
+            for (const auto& v : ar)
+            {
+                CHECK_EQ(v.value(), words[i++]);
+            }
+            CHECK_EQ(i, words.size());
+        }
+
+        TEST_CASE("copy")
+        {
+            const string_view_array ar(make_view_proxy(0, {2}));
+            const string_view_array ar2(ar);
+            CHECK_EQ(ar, ar2);
+        }
+
+        TEST_CASE("value_equals")
+        {
+            const string_view_array ar(make_view_proxy(0, {}));
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK(ar.value_equals(i, words[i]));
+                CHECK(ar.value_equals(i, i));
+            }
+            CHECK_FALSE(ar.value_equals(0, "shorT"));
+            CHECK_FALSE(ar.value_equals(0, "shor"));
+            CHECK_FALSE(ar.value_equals(1, "a string longer than 12 byteS"));
+            CHECK_FALSE(ar.value_equals(1, 6));
+        }
+
+        TEST_CASE("value_compare")
+        {
+            const string_view_array ar(make_view_proxy(0, {}));
+            const std::vector<std::string_view> probes = {
+                "",
+                "a",
+                "a string",
+                "a string longer than 12 bytes",
+                "a string longer than 13 bytes",
+                "exactly12abb",
+                "exactly12abcd",
+                "short",
+                "zzz"
+            };
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                for (const auto probe : probes)
+                {
+                    CHECK_EQ(ar.value_compare(i, probe), std::string_view(words[i]) <=> probe);
+                }
+            }
+        }
+
+        TEST_CASE("value_starts_with")
+        {
+            const string_view_array ar(make_view_proxy(0, {}));
+            CHECK(ar.value_starts_with(0, ""));
+            CHECK(ar.value_starts_with(0, "sh"));
+            CHECK(ar.value_starts_with(0, "short"));
+            CHECK_FALSE(ar.value_starts_with(0, "shorts"));
+            CHECK(ar.value_starts_with(1, "a string longer"));
+            CHECK_FALSE(ar.value_starts_with(1, "a string Longer"));
+            CHECK_FALSE(ar.value_starts_with(2, "a"));
+        }
+
+        TEST_CASE("value_hash")
+        {
+            const string_view_array ar(make_view_proxy(0, {}));
+            // Long values are in a single data buffer here, at other offsets.
+            const string_view_array other = to_view_array(string_array(make_string_proxy(0, {})));
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(ar.value_hash(i), other.value_hash(i));
+            }
+            // "short", "", "exactly12abc" and "x" are inlined
+            CHECK_NE(ar.value_hash(0), ar.value_hash(2));
+            CHECK_NE(ar.value_hash(0), ar.value_hash(3));
+            CHECK_NE(ar.value_hash(0), ar.value_hash(5));
+            CHECK_NE(ar.value_hash(2), ar.value_hash(5));
+
+            SUBCASE("padding of inline values is ignored")
+            {
+                arrow_proxy proxy = make_view_proxy(0, {});
+                std::uint8_t* x_view = proxy.buffers()[1].data() + 5 * binary_view_size;
+                std::memset(x_view + detail::view_prefix_pos + 1, 0xAB, binary_view_size - detail::view_prefix_pos - 1);
+                const string_view_array padded(std::move(proxy));
+                CHECK_EQ(padded[5].value(), "x");
+                CHECK_EQ(padded.value_hash(5), ar.value_hash(5));
+            }
+        }
+
+        TEST_CASE("to_view_array")
+        {
+            const std::size_t offset = 2;
+            string_array source(make_string_proxy(offset, {4}));
+            const string_array expected(source);
+            const auto* data_ptr = source.get_arrow_proxy().buffers()[2].data();
+
+            const string_view_array ar = to_view_array(std::move(source));
+            CHECK_EQ(ar.get_arrow_proxy().format(), "vu");
+            CHECK_EQ(ar.data_buffer_count(), 1u);
+            // The data buffer of the source is reused
+            CHECK_EQ(ar.get_arrow_proxy().buffers()[2].data(), data_ptr);
+            REQUIRE_EQ(ar.size(), expected.size());
+            for (std::size_t i = 0; i < ar.size(); ++i)
+            {
+                CHECK_EQ(ar[i], expected[i]);
+            }
+
+            const string_view_array ar2 = to_view_array(expected);
+            CHECK_EQ(ar2, ar);
+        }
+
+        TEST_CASE("array_factory")
+        {
+            const auto w = array_factory(make_view_proxy(0, {}));
+            CHECK_EQ(w->data_type(), data_type::STRING_VIEW);
+            CHECK_EQ(w->kind(), array_kind::STRING_VIEW);
+
+            array ar(string_view_array(make_view_proxy(0, {})));
+            REQUIRE_NE(ar.try_as<string_view_array>(), nullptr);
+            CHECK_EQ(ar.size(), words.size());
+            CHECK_EQ(std::get<nullable<std::string_view>>(ar[1]).value(), words[1]);
+        }
+
+        TEST_CASE("binary view array_factory")
+        {
+            arrow_proxy proxy = make_view_proxy(0, {});
+            proxy.set_data_type(data_type::BINARY_VIEW);
+            const auto w = array_factory(proxy);
+            CHECK_EQ(w->data_type(), data_type::BINARY_VIEW);
+            CHECK_EQ(w->kind(), array_kind::BINARY_VIEW);
+
+            const array ar(binary_view_array(std::move(proxy)));
+            REQUIRE_NE(ar.try_as<binary_view_array>(), nullptr);
+            CHECK_EQ(ar.try_as<string_view_array>(), nullptr);
+            REQUIRE_EQ(ar.size(), words.size());
+            for (std::size_t i = 0; i < words.size(); ++i)
+            {
+                const auto value = ar.as<binary_view_array>()[i].value();
+                const std::string bytes(reinterpret_cast<const char*>(value.data()), value.size());
+                CHECK_EQ(bytes, words[i]);
+            }
+        }
+    }
+}